@@ -1,37 +1,130 @@
 // decode.cpp
 #include "encoding.h"
 #include "jis2unicode.h"
+#include "simd.h"
+#include "utf8.h"
+#include <algorithm>
+#include <cstring>
+#include <thread>
 
 namespace {
-	// UTF-16 LE/BE decoder
-	unsigned int decode_utf16(int *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size)
+	/* Widen a run of ASCII characters (without NUL) into dest.
+	 * This is the common first stage of the byte oriented decoders.
+	 * Returns the length of the run.
+	 */
+	unsigned int widen_ascii(int *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size)
 	{
-		int high = 1, low = 0; // for endian
-		unsigned char b1, b2;
-		int code1, code2;
-		unsigned int len = 0;
+		const unsigned int size = src_size < dest_size ? src_size : dest_size;
+		unsigned int i = 0;
 
-		if (src_size < 2) return 0;
+#ifdef ENCODING_USE_SSE2
+		const __m128i zero = _mm_setzero_si128();
+		for (; size - i >= 16; i += 16) {
+			const __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+			if (_mm_movemask_epi8(v) | _mm_movemask_epi8(_mm_cmpeq_epi8(v, zero))) break;
+			const __m128i lo = _mm_unpacklo_epi8(v, zero), hi = _mm_unpackhi_epi8(v, zero);
+			_mm_storeu_si128((__m128i *)(dest + i), _mm_unpacklo_epi16(lo, zero));
+			_mm_storeu_si128((__m128i *)(dest + i + 4), _mm_unpackhi_epi16(lo, zero));
+			_mm_storeu_si128((__m128i *)(dest + i + 8), _mm_unpacklo_epi16(hi, zero));
+			_mm_storeu_si128((__m128i *)(dest + i + 12), _mm_unpackhi_epi16(hi, zero));
+		}
+#endif
+		// rest of the run (0x01~0x7f)
+		for (; i < size && (unsigned char)(src[i] - 1) < 0x7f; ++i) dest[i] = (int)src[i];
+		return i;
+	}
 
-		// recognize BOM
-		b1 = src[0], b2 = src[1];
-		if (b1 == 0xff && b2 == 0xfe) {
-			// little endian
-			src += 2, src_size -= 2;
-		} else if (b1 == 0xfe && b2 == 0xff) {
-			// big endian
-			src += 2, src_size -= 2;
-			high = 0, low = 1;
+#ifdef ENCODING_USE_SSE2
+	/* Decode a block of 8 UTF-16 code units with SSE2.
+	 * The block is decoded up to the first high surrogate or NUL, which are left
+	 * to the scalar decoder. Returns the number of code units decoded.
+	 */
+	unsigned int decode_utf16_block(int *dest, const unsigned char *src, bool big_endian)
+	{
+		const __m128i zero = _mm_setzero_si128();
+		__m128i v = _mm_loadu_si128((const __m128i *)src);
+		// byte swapping
+		if (big_endian) v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+
+		const __m128i stop = _mm_or_si128(
+			_mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16((short)0xfc00)), _mm_set1_epi16((short)0xd800)),
+			_mm_cmpeq_epi16(v, zero));
+		const unsigned int mask = (unsigned int)_mm_movemask_epi8(stop);
+		if (!mask) {
+			_mm_storeu_si128((__m128i *)dest, _mm_unpacklo_epi16(v, zero));
+			_mm_storeu_si128((__m128i *)(dest + 4), _mm_unpackhi_epi16(v, zero));
+			return 8;
 		}
 
+		// partial block
+		unsigned short units[8];
+		const unsigned int n = Encoding::ctz(mask) >> 1;
+		_mm_storeu_si128((__m128i *)units, v);
+		for (unsigned int k = 0; k < n; ++k) dest[k] = (int)units[k];
+		return n;
+	}
+
+	/* Count the codepoints in a block of 8 UTF-16 code units with SSE2.
+	 * A pair is a high surrogate followed by a low surrogate, so the count is the
+	 * number of code units minus the number of such pairs. The block is counted
+	 * up to the first NUL, and a high surrogate at the end of the block is left
+	 * for the next step. Returns the number of code units consumed.
+	 */
+	unsigned int count_utf16_block(const unsigned char *src, bool big_endian, unsigned int &chars)
+	{
+		const __m128i zero = _mm_setzero_si128();
+		__m128i v = _mm_loadu_si128((const __m128i *)src);
+		// byte swapping
+		if (big_endian) v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+
+		const __m128i tag = _mm_and_si128(v, _mm_set1_epi16((short)0xfc00));
+		const __m128i hs = _mm_cmpeq_epi16(tag, _mm_set1_epi16((short)0xd800));
+		const __m128i ls = _mm_cmpeq_epi16(tag, _mm_set1_epi16((short)0xdc00));
+		const __m128i nul = _mm_cmpeq_epi16(v, zero);
+		// 1 bit per code unit
+		const unsigned int high = (unsigned int)_mm_movemask_epi8(_mm_packs_epi16(hs, zero));
+		const unsigned int low = (unsigned int)_mm_movemask_epi8(_mm_packs_epi16(ls, zero));
+		const unsigned int end = (unsigned int)_mm_movemask_epi8(_mm_packs_epi16(nul, zero)) | (high & 0x80);
+
+		// whole block
+		if (!end) {
+			chars = 8 - Encoding::popcount(high & (low >> 1));
+			return 8;
+		}
+		const unsigned int units = Encoding::ctz(end);
+		chars = units - Encoding::popcount(high & (low >> 1) & (((1u << units) - 1) >> 1));
+		return units;
+	}
+#endif
+
+	/* UTF-16 LE/BE decoder (after BOM)
+	 * If read is given, decoding stops before a sequence which may be completed by
+	 * the following text, and *read is set to the number of bytes consumed.
+	 */
+	unsigned int decode_utf16_body(int *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size, bool big_endian, unsigned int *read)
+	{
+		const int high = big_endian ? 0 : 1, low = 1 - high; // for endian
+		int code1, code2;
+		unsigned int len = 0;
+
 		if (!dest) {
 			// counting
-			for (unsigned int i = 0; i < src_size - 1; i += 2, ++len) {
+			for (unsigned int i = 0; i + 1 < src_size; i += 2, ++len) {
+#ifdef ENCODING_USE_SSE2
+				// 8 code units blocks
+				while (src_size - i >= 16) {
+					unsigned int chars;
+					const unsigned int units = count_utf16_block(src + i, high == 0, chars);
+					if (!units) break;
+					i += 2 * units, len += chars;
+				}
+				if (i + 1 >= src_size) break;
+#endif
 				code1 = ((int)src[i + high] << 8) | (int)src[i + low];
 				// end of text
 				if (code1 == 0x0000) break;
 				// surrogate pair
-				if ((code1 & 0xfc00) == 0xd800 && i < src_size - 3) {
+				if ((code1 & 0xfc00) == 0xd800 && i + 3 < src_size) {
 					code2 = ((int)src[i + 2 + high] << 8) | (int)src[i + 2 + low];
 					if ((code2 & 0xfc00) == 0xdc00) i += 2;
 				}
@@ -40,12 +133,24 @@ namespace {
 		}
 
 		// decoding
-		for (unsigned int i = 0; i < src_size - 1 && len < dest_size; i += 2, ++len) {
+		unsigned int i;
+		for (i = 0; i + 1 < src_size && len < dest_size; i += 2, ++len) {
+#ifdef ENCODING_USE_SSE2
+			// 8 code units blocks without high surrogates and NUL
+			while (src_size - i >= 16 && dest_size - len >= 8) {
+				const unsigned int units = decode_utf16_block(dest + len, src + i, high == 0);
+				i += 2 * units, len += units;
+				if (units < 8) break;
+			}
+			if (i + 1 >= src_size || len >= dest_size) break;
+#endif
 			code1 = ((int)src[i + high] << 8) | (int)src[i + low];
 			// end of text
 			if (code1 == 0x0000) break;
+			// the low surrogate may follow
+			if (read && (code1 & 0xfc00) == 0xd800 && i + 3 >= src_size) break;
 			// surrogate pair
-			if ((code1 & 0xfc00) == 0xd800 && i < src_size - 3) {
+			if ((code1 & 0xfc00) == 0xd800 && i + 3 < src_size) {
 				code2 = ((int)src[i + 2 + high] << 8) | (int)src[i + 2 + low];
 				if ((code2 & 0xfc00) == 0xdc00) {
 					dest[len] = (((code1 & 0x0003ff) << 10) | (code2 & 0x0003ff)) + 0x010000;
@@ -55,51 +160,226 @@ namespace {
 			}
 			else dest[len] = code1;
 		}
+		if (read) *read = i;
 		return len;
 	}
 
-	// UTF-8 decoder
-	unsigned int decode_utf8(int *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size)
+	// UTF-16 LE/BE decoder
+	unsigned int decode_utf16(int *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size)
 	{
-		unsigned char b1, b2;
-		unsigned int len = 0;
+		bool big_endian = false;
+
+		if (src_size < 2) return 0;
 
 		// recognize BOM
-		if (src_size > 3)
-			if (src[0] == 0xef && src[1] == 0xbb && src[2] == 0xbf)
-				src += 3, src_size -= 3;
+		if (src[0] == 0xff && src[1] == 0xfe) {
+			// little endian
+			src += 2, src_size -= 2;
+		} else if (src[0] == 0xfe && src[1] == 0xff) {
+			// big endian
+			src += 2, src_size -= 2;
+			big_endian = true;
+		}
+
+		return decode_utf16_body(dest, dest_size, src, src_size, big_endian, nullptr);
+	}
+
+#ifdef ENCODING_USE_SSSE3
+	/* Shuffle table which packs the 16-bit lanes selected by an 8 bits mask
+	 * to the lower lanes.
+	 */
+	struct PackTable {
+		unsigned char index[256][16];
+
+		PackTable()
+		{
+			for (int mask = 0; mask < 256; ++mask) {
+				int n = 0;
+				for (int lane = 0; lane < 8; ++lane) {
+					if (!(mask >> lane & 1)) continue;
+					index[mask][n++] = (unsigned char)(2 * lane);
+					index[mask][n++] = (unsigned char)(2 * lane + 1);
+				}
+				while (n < 16) index[mask][n++] = 0x80;
+			}
+		}
+	};
+
+	// Store the 16-bit lanes of codes selected by mask as 32-bit values.
+	// Returns the end of the stored codepoints. 8 values are always written.
+	int *pack_utf16_lanes(int *dest, __m128i codes, unsigned int mask)
+	{
+		static const PackTable table;
+		const __m128i zero = _mm_setzero_si128();
+		codes = _mm_shuffle_epi8(codes, _mm_loadu_si128((const __m128i *)table.index[mask]));
+		_mm_storeu_si128((__m128i *)dest, _mm_unpacklo_epi16(codes, zero));
+		_mm_storeu_si128((__m128i *)(dest + 4), _mm_unpackhi_epi16(codes, zero));
+		return dest + Encoding::popcount(mask);
+	}
+
+	// Assemble 1~3 bytes sequences which begin at each byte of b0 (8 bytes in 16-bit lanes).
+	// b1 and b2 are the following bytes.
+	__m128i assemble_utf8_lanes(__m128i b0, __m128i b1, __m128i b2)
+	{
+		const __m128i low6 = _mm_set1_epi16(0x3f);
+		const __m128i c2 = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(b0, _mm_set1_epi16(0x1f)), 6), _mm_and_si128(b1, low6));
+		const __m128i c3 = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(b0, 12),
+			_mm_slli_epi16(_mm_and_si128(b1, low6), 6)), _mm_and_si128(b2, low6));
+		const __m128i is1 = _mm_cmplt_epi16(b0, _mm_set1_epi16(0x80));
+		const __m128i is2 = _mm_cmplt_epi16(b0, _mm_set1_epi16(0xe0));
+		const __m128i c = _mm_or_si128(_mm_and_si128(is2, c2), _mm_andnot_si128(is2, c3));
+		return _mm_or_si128(_mm_and_si128(is1, b0), _mm_andnot_si128(is1, c));
+	}
+#endif
+
+#ifdef ENCODING_USE_SSE2
+	/* SSE2 fast path of the UTF-8 decoder.
+	 * src is processed in 16 bytes blocks while it consists of ASCII (without NUL)
+	 * and well-formed 2~4 bytes sequences, that is, while the scalar decoder would
+	 * not find any error (including overlong forms, surrogates and codepoints above
+	 * U+10FFFF, which are checked by the first two bytes). Sequences may straddle blocks.
+	 * If dest is nullptr, characters are only counted.
+	 * Returns the number of bytes consumed (src is left at a character boundary)
+	 * and adds the number of codepoints to len.
+	 * The codepoints after len may be overwritten within dest_size.
+	 */
+	unsigned int decode_utf8_blocks(int *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size, unsigned int &len)
+	{
+		const __m128i zero = _mm_setzero_si128();
+		// continuation bytes expected at the beginning of the block and
+		// the position of their first byte
+		unsigned int carry = 0, last = 0;
+		unsigned int i = 0, n = len;
+
+		// 3 bytes after a block are read for the sequence which straddles it.
+		while (src_size - i >= 16 + 3 && (!dest || dest_size - n >= 16)) {
+			const __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+			const unsigned int high = (unsigned int)_mm_movemask_epi8(v);
+			const unsigned int nul = Encoding::byte_mask(v, 0x00);
+
+			// ASCII only
+			if (!(high | nul | carry)) {
+				if (dest) {
+					const __m128i lo = _mm_unpacklo_epi8(v, zero), hi = _mm_unpackhi_epi8(v, zero);
+					_mm_storeu_si128((__m128i *)(dest + n), _mm_unpacklo_epi16(lo, zero));
+					_mm_storeu_si128((__m128i *)(dest + n + 4), _mm_unpackhi_epi16(lo, zero));
+					_mm_storeu_si128((__m128i *)(dest + n + 8), _mm_unpacklo_epi16(hi, zero));
+					_mm_storeu_si128((__m128i *)(dest + n + 12), _mm_unpackhi_epi16(hi, zero));
+				}
+				i += 16, n += 16;
+				continue;
+			}
+
+			// byte classes (signed comparison: 0x80~0xbf < 0xc0 < ... < 0xff < 0x00)
+			const unsigned int cont = (unsigned int)_mm_movemask_epi8(_mm_cmplt_epi8(v, _mm_set1_epi8((char)0xc0)));
+			const unsigned int ge_c2 = (unsigned int)_mm_movemask_epi8(_mm_cmpgt_epi8(v, _mm_set1_epi8((char)0xc1))) & high;
+			const unsigned int ge_e0 = (unsigned int)_mm_movemask_epi8(_mm_cmpgt_epi8(v, _mm_set1_epi8((char)0xdf))) & high;
+			const unsigned int ge_f0 = (unsigned int)_mm_movemask_epi8(_mm_cmpgt_epi8(v, _mm_set1_epi8((char)0xef))) & high;
+			const unsigned int ge_f5 = (unsigned int)_mm_movemask_epi8(_mm_cmpgt_epi8(v, _mm_set1_epi8((char)0xf4))) & high;
+			const unsigned int lead4 = ge_f0 & ~ge_f5;
+			const unsigned int expected = carry | (ge_c2 & ~ge_f5) << 1 | (ge_e0 & ~ge_f5) << 2 | lead4 << 3;
+			// C0, C1, F5~FF, NUL or continuation bytes which don't follow a first byte
+			if ((high & ~cont & ~ge_c2) | ge_f5 | nul | ((expected & 0xffff) ^ cont)) break;
+			// the second bytes of E0, ED, F0 and F4 have narrower ranges (rare in text)
+			const __m128i special = _mm_or_si128(
+				_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8((char)0xe0)), _mm_cmpeq_epi8(v, _mm_set1_epi8((char)0xed))),
+				_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8((char)0xf0)), _mm_cmpeq_epi8(v, _mm_set1_epi8((char)0xf4))));
+			if (_mm_movemask_epi8(special)) {
+				const __m128i v1 = _mm_loadu_si128((const __m128i *)(src + i + 1));
+				if ((Encoding::byte_mask(v, 0xe0) & Encoding::range_mask(v1, 0x80, 0x9f))
+					| (Encoding::byte_mask(v, 0xed) & Encoding::range_mask(v1, 0xa0, 0xbf))
+					| (Encoding::byte_mask(v, 0xf0) & Encoding::range_mask(v1, 0x80, 0x8f))
+					| (Encoding::byte_mask(v, 0xf4) & Encoding::range_mask(v1, 0x90, 0xbf))) break;
+			}
+
+			const unsigned int leads = ~cont & 0xffff;
+			if (dest) {
+				int *p = dest + n;
+#ifdef ENCODING_USE_SSSE3
+				// without 4 bytes sequences: assemble all lanes, then pack the first bytes.
+				if (!lead4) {
+					const __m128i v1 = _mm_loadu_si128((const __m128i *)(src + i + 1));
+					const __m128i v2 = _mm_loadu_si128((const __m128i *)(src + i + 2));
+					p = pack_utf16_lanes(p, assemble_utf8_lanes(
+						_mm_unpacklo_epi8(v, zero), _mm_unpacklo_epi8(v1, zero), _mm_unpacklo_epi8(v2, zero)), leads & 0xff);
+					pack_utf16_lanes(p, assemble_utf8_lanes(
+						_mm_unpackhi_epi8(v, zero), _mm_unpackhi_epi8(v1, zero), _mm_unpackhi_epi8(v2, zero)), leads >> 8);
+				}
+				else
+#endif
+				for (unsigned int rest = leads; rest; rest &= rest - 1) {
+					const unsigned char *s = src + i + Encoding::ctz(rest);
+					if (s[0] <= 0x7f) *p++ = (int)s[0];
+					else if (s[0] <= 0xdf) *p++ = (s[0] & 0x1f) << 6 | (s[1] & 0x3f);
+					else if (s[0] <= 0xef) *p++ = (s[0] & 0x0f) << 12 | (s[1] & 0x3f) << 6 | (s[2] & 0x3f);
+					else *p++ = (s[0] & 0x07) << 18 | (s[1] & 0x3f) << 12 | (s[2] & 0x3f) << 6 | (s[3] & 0x3f);
+				}
+			}
+			carry = expected >> 16;
+			if (carry) last = i + Encoding::bsr(leads);
+			i += 16, n += Encoding::popcount(leads);
+		}
+
+		// the sequence which straddles the last block is left to the scalar decoder.
+		if (carry) i = last, --n;
+		len = n;
+		return i;
+	}
+#endif
+
+	/* UTF-8 decoder (after BOM)
+	 * read is the same as decode_utf16_body.
+	 */
+	unsigned int decode_utf8_body(int *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size, unsigned int *read)
+	{
+		unsigned char b1;
+		int codepoint, bytes;
+		unsigned int len = 0;
+
+#ifdef ENCODING_USE_SSE2
+		unsigned int block = 0; // where the SSE2 path is tried next
+#endif
 
 		if (!dest) {
 			// counting
 			for (unsigned int i = 0; i < src_size; ++i, ++len) {
+#ifdef ENCODING_USE_SSE2
+				// blocks without errors (retried 16 bytes after an error)
+				if (i >= block) {
+					i += decode_utf8_blocks(nullptr, 0, src + i, src_size - i, len);
+					block = i + 16;
+					if (i >= src_size) break;
+				}
+#endif
 				b1 = src[i];
 				// end of text
 				if (b1 == 0x00) break;
-				// 1 byte sequence (ASCII compatible)/other errors
-				if (b1 < 0xc2 || 0xfd < b1) continue;
-				// 2~6 bytes sequence
-				unsigned char sup = 0xdf;
-				for (int bytes = 2; bytes <= 6; ++bytes) {
-					if (b1 <= sup && i <= src_size - bytes) {
-						bool p = true;
-						for (int n = 1; n < bytes; ++n) {
-							b2 = src[i + n];
-							if (b2 < 0x80 || 0xbf < b2) {
-								p = false;
-								break;
-							}
-						}
-						if (p) i += bytes - 1;
-						break;
-					}
-					sup = (sup >> 1) | 0x80;
-				}
+				// 1 byte sequence (ASCII compatible)
+				if (b1 <= 0x7f) continue;
+				// 2~4 bytes sequence (an error consumes 1 byte)
+				bytes = Encoding::utf8_sequence(src + i, src_size - i, codepoint);
+				if (bytes > 0) i += bytes - 1;
 			}
 			return len;
 		}
 
 		// decoding
-		for (unsigned int i = 0; i < src_size && len < dest_size; ++i, ++len) {
+		unsigned int i;
+		for (i = 0; i < src_size && len < dest_size; ++i, ++len) {
+			// run of ASCII characters
+			if ((unsigned char)(src[i] - 1) < 0x7f) {
+				const unsigned int n = widen_ascii(dest + len, dest_size - len, src + i, src_size - i);
+				i += n, len += n;
+				if (i >= src_size || len >= dest_size) break;
+			}
+#ifdef ENCODING_USE_SSE2
+			// blocks without errors (retried 16 bytes after an error)
+			if (i >= block) {
+				i += decode_utf8_blocks(dest, dest_size, src + i, src_size - i, len);
+				block = i + 16;
+				if (i >= src_size || len >= dest_size) break;
+			}
+#endif
 			b1 = src[i];
 			// end of text
 			if (b1 == 0x00) break;
@@ -108,66 +388,102 @@ namespace {
 				dest[len] = (int)b1;
 				continue;
 			}
-			// other errors
-			else if (b1 < 0xc2 || 0xfd < b1) {
-				dest[len] = Encoding::UNICODE_BAD_SEQUENCE;
-				continue;
-			}
-			// 2~6 bytes sequence
-			unsigned char sup = 0xdf, mask = 0x1f;
-			for (int bytes = 2; bytes <= 6; ++bytes) {
-				if (b1 <= sup && i <= src_size - bytes) {
-					dest[len] = b1 & mask;
-					bool p = true;
-					for (int n = 1; n < bytes; ++n) {
-						b2 = src[i + n];
-						if (b2 < 0x80 || 0xbf < b2) {
-							dest[len] = Encoding::UNICODE_BAD_SEQUENCE;
-							p = false;
-							break;
-						}
-						dest[len] = dest[len] << 6 | (b2 & 0x3f);
-					}
-					if (p) i += bytes - 1;
-					break;
-				}
-				sup = (sup >> 1) | 0x80;
-				mask >>= 1;
+			// 2~4 bytes sequence
+			bytes = Encoding::utf8_sequence(src + i, src_size - i, codepoint);
+			if (bytes > 0) {
+				dest[len] = codepoint;
+				i += bytes - 1;
 			}
+			// the rest of the sequence may follow
+			else if (bytes < 0 && read) break;
+			// bad sequence (truncated sequence is also an error, they consume 1 byte)
+			else dest[len] = Encoding::UNICODE_BAD_SEQUENCE;
 		}
+		if (read) *read = i;
 		return len;
 	}
 
-	// Shift_JIS decoder
-	unsigned int decode_shiftjis(int *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size)
+	// UTF-8 decoder
+	unsigned int decode_utf8(int *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size)
 	{
-		const int KU_SIZE = 94;
-		const int offset[] = {
-			-1,  0*KU_SIZE,  2*KU_SIZE,  4*KU_SIZE,  6*KU_SIZE,  8*KU_SIZE, 10*KU_SIZE, 12*KU_SIZE,
-			14*KU_SIZE, 16*KU_SIZE, 18*KU_SIZE, 20*KU_SIZE, 22*KU_SIZE, 24*KU_SIZE, 26*KU_SIZE, 28*KU_SIZE,
-			30*KU_SIZE, 32*KU_SIZE, 34*KU_SIZE, 36*KU_SIZE, 38*KU_SIZE, 40*KU_SIZE, 42*KU_SIZE, 44*KU_SIZE,
-			46*KU_SIZE, 48*KU_SIZE, 50*KU_SIZE, 52*KU_SIZE, 54*KU_SIZE, 56*KU_SIZE, 58*KU_SIZE, 60*KU_SIZE,
-			-1, -1, -1, -1, -1, -1, -1, -1,
-			-1, -1, -1, -1, -1, -1, -1, -1,
-			-1, -1, -1, -1, -1, -1, -1, -1,
-			-1, -1, -1, -1, -1, -1, -1, -1,
-			-1, -1, -1, -1, -1, -1, -1, -1,
-			-1, -1, -1, -1, -1, -1, -1, -1,
-			-1, -1, -1, -1, -1, -1, -1, -1,
-			-1, -1, -1, -1, -1, -1, -1, -1,
-			62*KU_SIZE, 64*KU_SIZE, 66*KU_SIZE, 68*KU_SIZE, 70*KU_SIZE, 72*KU_SIZE, 74*KU_SIZE, 76*KU_SIZE,
-			78*KU_SIZE, 80*KU_SIZE, 82*KU_SIZE, 84*KU_SIZE, 86*KU_SIZE, 88*KU_SIZE, 90*KU_SIZE, 92*KU_SIZE,
-			(94+ 0)*KU_SIZE, (94+ 2)*KU_SIZE, (94+ 4)*KU_SIZE, (94+12)*KU_SIZE, (94+14)*KU_SIZE, (94+78)*KU_SIZE, (94+80)*KU_SIZE, (94+82)*KU_SIZE,
-			(94+84)*KU_SIZE, (94+86)*KU_SIZE, (94+88)*KU_SIZE, (94+90)*KU_SIZE, (94+92)*KU_SIZE, -1, -1, -1
-		};
+		// recognize BOM
+		if (src_size > 3)
+			if (src[0] == 0xef && src[1] == 0xbb && src[2] == 0xbf)
+				src += 3, src_size -= 3;
 
+		return decode_utf8_body(dest, dest_size, src, src_size, nullptr);
+	}
+
+#ifdef ENCODING_USE_SSE2
+	/* Count the characters in a 16 bytes block of Shift_JIS text which begins at a
+	 * character boundary. The bytes are classified with SSE2 and only the non single
+	 * byte characters are visited one by one. A non single byte character at the end
+	 * of the block is left for the next step. Returns the number of bytes consumed.
+	 * A two character sequence of JIS X 0213 is counted as 2 characters.
+	 * Profile is a mapping profile of jis2unicode.h.
+	 */
+	template <class Profile>
+	unsigned int count_shiftjis_block(const unsigned char *src, unsigned int &chars)
+	{
+		const __m128i v = _mm_loadu_si128((const __m128i *)src);
+		const unsigned int nul = Encoding::byte_mask(v, 0x00);
+		// ASCII & JIS X 0201 kana
+		const unsigned int single = Encoding::range_mask(v, 0x01, 0x7f) | Encoding::range_mask(v, 0xa1, 0xdf);
+		// valid first/second byte of 2 bytes sequence
+		const unsigned int lead = Encoding::range_mask(v, 0x81, 0x9f) | Encoding::range_mask(v, 0xe0, 0xfc);
+		const unsigned int trail = (Encoding::range_mask(v, 0x40, 0xfc) & ~Encoding::byte_mask(v, 0x7f)) >> 1;
+		unsigned int size = nul ? Encoding::ctz(nul) : 16;
+		unsigned int rest = ~single & ((1u << size) - 1);
+		unsigned int trails = 0, sequences = 0;
+
+		while (rest) {
+			const unsigned int p = Encoding::ctz(rest), bit = 1u << p;
+			// the second byte is in the next block
+			if (p == 15) {
+				size = 15;
+				break;
+			}
+			// 2 bytes sequence
+			if (lead & bit) {
+				if (trail & bit) {
+					++trails;
+					sequences += Profile::is_sequence(Profile::index(src[p], src[p + 1]));
+					rest &= ~(bit | bit << 1);
+					continue;
+				}
+			}
+			// bad sequence
+			rest &= rest - 1;
+		}
+		chars = size - trails + sequences;
+		return size;
+	}
+#endif
+
+	/* Shift_JIS decoder
+	 * read is the same as decode_utf16_body.
+	 * Profile is a mapping profile of jis2unicode.h (Shift_JIS or CP932).
+	 */
+	template <class Profile>
+	unsigned int decode_shiftjis(int *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size, unsigned int *read)
+	{
 		unsigned char b1, b2;
-		int codepoint;
+		int index;
 		unsigned int len = 0;
 
 		if (!dest) {
 			// counting
 			for (unsigned int i = 0; i < src_size; ++i, ++len) {
+#ifdef ENCODING_USE_SSE2
+				// 16 bytes blocks
+				while (src_size - i >= 16) {
+					unsigned int chars;
+					const unsigned int bytes = count_shiftjis_block<Profile>(src + i, chars);
+					if (!bytes) break;
+					i += bytes, len += chars;
+				}
+				if (i >= src_size) break;
+#endif
 				b1  = src[i];
 				// end of text
 				if (b1 == 0x00) break;
@@ -175,8 +491,12 @@ namespace {
 				if (Encoding::jisx0201_2_unicode[b1] == Encoding::UNICODE_BAD_SEQUENCE) {
 					if (++i >= src_size) break;
 					b2 = src[i];
+					index = Profile::index(b1, b2);
 					// correct sequence
-					if (offset[b1 - 0x80] != -1 && b2 != 0x7f && 0x40 <= b2 && b2 <= 0xfc) continue;
+					if (index >= 0) {
+						len += Profile::is_sequence(index);
+						continue;
+					}
 					// bad sequence
 					--i;
 				}
@@ -185,7 +505,39 @@ namespace {
 		}
 
 		// decoding
-		for (unsigned int i = 0; i < src_size && len < dest_size; ++i, ++len) {
+		unsigned int i;
+#ifdef ENCODING_USE_TABLE_DECODER
+		// table driven (see shiftjis_sequence), no branches on the forms of the sequences
+		unsigned int bytes;
+		for (i = 0; i < src_size && len < dest_size; i += bytes, ++len) {
+			// run of ASCII characters
+			if ((unsigned char)(src[i] - 1) < 0x7f) {
+				const unsigned int n = widen_ascii(dest + len, dest_size - len, src + i, src_size - i);
+				i += n, len += n;
+				if (i >= src_size || len >= dest_size) break;
+			}
+			// end of text
+			if (src[i] == 0x00) break;
+			bytes = Encoding::shiftjis_sequence<Profile>(src + i, src_size - i, dest[len]);
+			// truncated sequence
+			if (!bytes) break;
+			// two character sequence
+			if (dest[len] < 0) {
+				// stop before the sequence if it doesn't fit
+				if (len + 1 >= dest_size) break;
+				const int *sequence = Encoding::jisx0213_sequence(dest[len]);
+				dest[len] = sequence[0];
+				dest[++len] = sequence[1];
+			}
+		}
+#else
+		for (i = 0; i < src_size && len < dest_size; ++i, ++len) {
+			// run of ASCII characters
+			if ((unsigned char)(src[i] - 1) < 0x7f) {
+				const unsigned int n = widen_ascii(dest + len, dest_size - len, src + i, src_size - i);
+				i += n, len += n;
+				if (i >= src_size || len >= dest_size) break;
+			}
 			b1  = src[i];
 			// end of text
 			if (b1 == 0x00) break;
@@ -194,18 +546,23 @@ namespace {
 				dest[len] = Encoding::jisx0201_2_unicode[b1];
 			// 2 bytes sequence (JIS X 0208)
 			else {
-				if (++i >= src_size) break;
-				b2 = src[i];
+				if (i + 1 >= src_size) break;
+				b2 = src[++i];
+				index = Profile::index(b1, b2);
 				// correct sequence
-				if (offset[b1 - 0x80] != -1 && b2 != 0x7f && 0x40 <= b2 && b2 <= 0xfc) {
-					codepoint = offset[b1 - 0x80] + (b2 < 0x80 ? b2 : b2 - 1) - 0x40;
-					// jis x 0213 shifting
-					if (b1 >= 0xf0) {
-						if (b1 == 0xf0 && b2 >= 0x80) codepoint += 6*KU_SIZE;
-						else if (b1 == 0xf2 && b2 >= 0x80) codepoint += 6*KU_SIZE;
-						else if (b1 == 0xf4 && b2 >= 0x80) codepoint += 62*KU_SIZE;
+				if (index >= 0) {
+					dest[len] = Profile::codepoint(index);
+					// two character sequence
+					if (dest[len] < 0) {
+						// stop before the sequence if it doesn't fit
+						if (len + 1 >= dest_size) {
+							--i;
+							break;
+						}
+						const int *sequence = Encoding::jisx0213_sequence(dest[len]);
+						dest[len] = sequence[0];
+						dest[++len] = sequence[1];
 					}
-					dest[len] = Encoding::jisx0213_2_unicode[codepoint];
 				}
 				// bad sequence
 				else {
@@ -214,11 +571,63 @@ namespace {
 				}
 			}
 		}
+#endif
+		if (read) *read = i;
 		return len;
 	}
 
-	// EUC-JP decoder
-	unsigned int decode_eucjp(int *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size)
+#ifdef ENCODING_USE_SSE2
+	/* Count the characters in a 16 bytes block of EUC-JP text which begins at a
+	 * character boundary. Same as count_shiftjis_block, but a block with NUL is
+	 * left to the scalar counter because 0x8e may take it as the second byte.
+	 * Returns the number of bytes consumed.
+	 */
+	unsigned int count_eucjp_block(const unsigned char *src, unsigned int &chars)
+	{
+		const __m128i v = _mm_loadu_si128((const __m128i *)src);
+		if (Encoding::byte_mask(v, 0x00)) return 0;
+		const unsigned int multi = (unsigned int)_mm_movemask_epi8(v);
+		const unsigned int kana = Encoding::byte_mask(v, 0x8e);
+		const unsigned int plane2 = Encoding::byte_mask(v, 0x8f);
+		const unsigned int plane1 = Encoding::range_mask(v, 0xa1, 0xfe);
+		unsigned int size = 16, rest = multi, trails = 0, sequences = 0;
+
+		while (rest) {
+			const unsigned int p = Encoding::ctz(rest), bit = 1u << p;
+			// the following bytes are in the next block
+			if (p == 15 || (p == 14 && plane2 & bit)) {
+				size = p;
+				break;
+			}
+			// 3 bytes sequence (JIS X 0213 plane 2)
+			if (plane2 & bit) {
+				if ((plane1 >> (p + 1) & 3) == 3) {
+					trails += 2;
+					rest &= ~(bit * 7);
+					continue;
+				}
+			}
+			// 2 bytes sequence (JIS X 0201 kana/JIS X 0213 plane 1)
+			else if (kana & bit || plane1 & bit) {
+				if (kana & bit || plane1 & bit << 1) {
+					++trails;
+					if (plane1 & bit) sequences += Encoding::jisx0213_is_sequence((src[p] - 0xa1) * 94 + (src[p + 1] - 0xa1));
+					rest &= ~(bit * 3);
+					continue;
+				}
+			}
+			// bad sequence
+			rest &= rest - 1;
+		}
+		chars = size - trails + sequences;
+		return size;
+	}
+#endif
+
+	/* EUC-JP decoder
+	 * read is the same as decode_utf16_body.
+	 */
+	unsigned int decode_eucjp(int *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size, unsigned int *read)
 	{
 		unsigned char b1, b2, b3;
 		unsigned int len = 0;
@@ -226,6 +635,16 @@ namespace {
 		if (!dest) {
 			// counting
 			for (unsigned int i = 0; i < src_size; ++i, ++len) {
+#ifdef ENCODING_USE_SSE2
+				// 16 bytes blocks without NUL
+				while (src_size - i >= 16) {
+					unsigned int chars;
+					const unsigned int bytes = count_eucjp_block(src + i, chars);
+					if (!bytes) break;
+					i += bytes, len += chars;
+				}
+				if (i >= src_size) break;
+#endif
 				b1 = src[i];
 				// end of text
 				if (b1 == 0x00) break;
@@ -241,7 +660,11 @@ namespace {
 				else if (b1 >= 0x80) {
 					if (++i >= src_size) break;
 					b2 = src[i];
-					if (b1 == 0x8e || (0xa1 <= b1 && b1 <= 0xfe && 0xa1 <= b2 && b2 <= 0xfe)) continue;
+					if (b1 == 0x8e) continue;
+					if (0xa1 <= b1 && b1 <= 0xfe && 0xa1 <= b2 && b2 <= 0xfe) {
+						len += Encoding::jisx0213_is_sequence((b1 - 0xa1) * 94 + (b2 - 0xa1));
+						continue;
+					}
 					// bad sequence
 					--i;
 				}
@@ -250,7 +673,39 @@ namespace {
 		}
 
 		// decoding
-		for (unsigned int i = 0; i < src_size && len < dest_size; ++i, ++len) {
+		unsigned int i;
+#ifdef ENCODING_USE_TABLE_DECODER
+		// table driven (see eucjp_sequence), no branches on the forms of the sequences
+		unsigned int bytes;
+		for (i = 0; i < src_size && len < dest_size; i += bytes, ++len) {
+			// run of ASCII characters
+			if ((unsigned char)(src[i] - 1) < 0x7f) {
+				const unsigned int n = widen_ascii(dest + len, dest_size - len, src + i, src_size - i);
+				i += n, len += n;
+				if (i >= src_size || len >= dest_size) break;
+			}
+			// end of text
+			if (src[i] == 0x00) break;
+			bytes = Encoding::eucjp_sequence(src + i, src_size - i, dest[len]);
+			// truncated sequence
+			if (!bytes) break;
+			// two character sequence
+			if (dest[len] < 0) {
+				// stop before the sequence if it doesn't fit
+				if (len + 1 >= dest_size) break;
+				const int *sequence = Encoding::jisx0213_sequence(dest[len]);
+				dest[len] = sequence[0];
+				dest[++len] = sequence[1];
+			}
+		}
+#else
+		for (i = 0; i < src_size && len < dest_size; ++i, ++len) {
+			// run of ASCII characters
+			if ((unsigned char)(src[i] - 1) < 0x7f) {
+				const unsigned int n = widen_ascii(dest + len, dest_size - len, src + i, src_size - i);
+				i += n, len += n;
+				if (i >= src_size || len >= dest_size) break;
+			}
 			b1 = src[i];
 			// end of text
 			if (b1 == 0x00) break;
@@ -258,10 +713,11 @@ namespace {
 			if (b1 <= 0x7f) dest[len] = (int)b1;
 			// 3 bytes sequence (JIS X 0213 plane 2)
 			else if (b1 == 0x8f) {
-				if ((i += 2) >= src_size) break;
+				if (i + 2 >= src_size) break;
+				i += 2;
 				b2 = src[i - 1], b3 = src[i];
 				if (0xa1 <= b2 && b2 <= 0xfe && 0xa1 <= b3 && b3 <= 0xfe)
-					dest[len] = Encoding::jisx0213_2_unicode[(b2 - 0xa1 + 94) * 94 + (b3 - 0xa1)];
+					dest[len] = Encoding::jisx0213_codepoint((b2 - 0xa1 + 94) * 94 + (b3 - 0xa1));
 				// bad sequence
 				else {
 					dest[len] = Encoding::UNICODE_BAD_SEQUENCE;
@@ -270,13 +726,25 @@ namespace {
 			}
 			// 2 bytes sequence
 			else /* b1 >= 0x80 */ {
-				if (++i >= src_size) break;
-				b2 = src[i];
+				if (i + 1 >= src_size) break;
+				b2 = src[++i];
 				// JIS X 0201 kana
 				if (b1 == 0x8e) dest[len] = Encoding::jisx0201_2_unicode[b2];
 				// JIS X 0213 plane 1
-				else if (0xa1 <= b1 && b1 <= 0xfe && 0xa1 <= b2 && b2 <= 0xfe)
-					dest[len] = Encoding::jisx0213_2_unicode[(b1 - 0xa1) * 94 + (b2 - 0xa1)];
+				else if (0xa1 <= b1 && b1 <= 0xfe && 0xa1 <= b2 && b2 <= 0xfe) {
+					dest[len] = Encoding::jisx0213_codepoint((b1 - 0xa1) * 94 + (b2 - 0xa1));
+					// two character sequence
+					if (dest[len] < 0) {
+						// stop before the sequence if it doesn't fit
+						if (len + 1 >= dest_size) {
+							--i;
+							break;
+						}
+						const int *sequence = Encoding::jisx0213_sequence(dest[len]);
+						dest[len] = sequence[0];
+						dest[++len] = sequence[1];
+					}
+				}
 				// bad sequence
 				else {
 					dest[len] = Encoding::UNICODE_BAD_SEQUENCE;
@@ -284,8 +752,208 @@ namespace {
 				}
 			}
 		}
+#endif
+		if (read) *read = i;
 		return len;
 	}
+
+	/* Interleaved decoder of many short Shift_JIS texts
+	 * A character of Shift_JIS can't be decoded before the length of the
+	 * previous one is known, so a short text is decoded while waiting for the
+	 * loads from the tables. The batch decoder keeps BATCH_LANES texts in flight
+	 * and decodes a character of each lane in turn with shiftjis_sequence (no
+	 * branches on the forms), so that the loads of the lanes overlap each other.
+	 */
+	const unsigned int BATCH_LANES = 4;
+
+	struct BatchLane {
+		int *dest;
+		const unsigned char *src;
+		unsigned int dest_size, src_size;
+		// position in src and dest
+		unsigned int i, len;
+		// index of the text in the batch
+		unsigned int text;
+	};
+
+	/* Decode a character of a lane.
+	 * Returns false at the end of the text, where decode_shiftjis stops.
+	 */
+	template <class Profile>
+	inline bool decode_batch_step(BatchLane &lane)
+	{
+		if (lane.i >= lane.src_size || lane.len >= lane.dest_size) return false;
+		const unsigned char *src = lane.src + lane.i;
+		// end of text
+		if (src[0] == 0x00) return false;
+		int &codepoint = lane.dest[lane.len];
+		const unsigned int bytes = Encoding::shiftjis_sequence<Profile>(src, lane.src_size - lane.i, codepoint);
+		// truncated sequence
+		if (!bytes) return false;
+		// two character sequence
+		if (codepoint < 0) {
+			// stop before the sequence if it doesn't fit
+			if (lane.len + 1 >= lane.dest_size) return false;
+			const int *sequence = Encoding::jisx0213_sequence(codepoint);
+			lane.dest[lane.len] = sequence[0];
+			lane.dest[++lane.len] = sequence[1];
+		}
+		lane.i += bytes, ++lane.len;
+		return true;
+	}
+
+	/* Batch decoder of Shift_JIS
+	 * A lane takes the next text when its text ends, and the last texts are
+	 * finished by decode_shiftjis (the decoders can begin at a character boundary).
+	 * The texts without dest are counted by decode_shiftjis at once.
+	 * Returns the sum of lengths.
+	 */
+	template <class Profile>
+	unsigned int decode_batch(int *const *dest, const unsigned int *dest_size, const unsigned char *const *src, const unsigned int *src_size, unsigned int count, unsigned int *lengths)
+	{
+		BatchLane lanes[BATCH_LANES];
+		unsigned int next = 0, active = 0, total = 0;
+
+		// set the next text to a lane, false if no text is left
+		auto take = [&](BatchLane &lane) {
+			for (; next < count; ++next) {
+				// counting
+				if (!dest[next]) {
+					lengths[next] = decode_shiftjis<Profile>(nullptr, 0, src[next], src_size[next], nullptr);
+					total += lengths[next];
+					continue;
+				}
+				lane = BatchLane{dest[next], src[next], dest_size[next], src_size[next], 0, 0, next};
+				++next;
+				return true;
+			}
+			return false;
+		};
+
+		while (active < BATCH_LANES && take(lanes[active])) ++active;
+		// all lanes in flight
+		while (active == BATCH_LANES) {
+			for (unsigned int k = 0; k < BATCH_LANES; ++k) {
+				if (decode_batch_step<Profile>(lanes[k])) continue;
+				// end of text
+				lengths[lanes[k].text] = lanes[k].len;
+				total += lanes[k].len;
+				if (!take(lanes[k])) {
+					lanes[k] = lanes[--active];
+					break;
+				}
+			}
+		}
+		// rest of the last texts
+		for (unsigned int k = 0; k < active; ++k) {
+			BatchLane &lane = lanes[k];
+			lane.len += decode_shiftjis<Profile>(lane.dest + lane.len, lane.dest_size - lane.len, lane.src + lane.i, lane.src_size - lane.i, nullptr);
+			lengths[lane.text] = lane.len;
+			total += lane.len;
+		}
+		return total;
+	}
+
+	// dispatching to the decoders (after BOM)
+	unsigned int decode_body(int *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size, Encoding::EncodingType encoding, bool big_endian, unsigned int *read)
+	{
+		switch (encoding) {
+		case Encoding::UTF16: return decode_utf16_body(dest, dest_size, src, src_size, big_endian, read);
+		case Encoding::UTF8: return decode_utf8_body(dest, dest_size, src, src_size, read);
+		case Encoding::SHIFTJIS: return decode_shiftjis<Encoding::ShiftjisProfile>(dest, dest_size, src, src_size, read);
+		case Encoding::CP932: return decode_shiftjis<Encoding::Cp932Profile>(dest, dest_size, src, src_size, read);
+		case Encoding::EUCJP: return decode_eucjp(dest, dest_size, src, src_size, read);
+		default: break;
+		}
+		// unknown encoding
+		if (read) *read = src_size;
+		return 0;
+	}
+
+	// minimum length of a chunk which is decoded by a thread (tests/fuzz_test.cpp
+	// defines ENCODING_PARALLEL_CHUNK_SIZE to split short texts)
+#ifdef ENCODING_PARALLEL_CHUNK_SIZE
+	const unsigned int PARALLEL_CHUNK_SIZE = ENCODING_PARALLEL_CHUNK_SIZE;
+#else
+	const unsigned int PARALLEL_CHUNK_SIZE = 1 << 20;
+#endif
+
+	/* Length of the text until L'\0' which ends the text (the terminator is included,
+	 * since it can complete a bad sequence before it).
+	 */
+	unsigned int text_size(const unsigned char *src, unsigned int src_size, Encoding::EncodingType encoding)
+	{
+		if (encoding == Encoding::UTF16) {
+			for (unsigned int i = 0; i + 1 < src_size; i += 2)
+				if (src[i] == 0x00 && src[i + 1] == 0x00) return i + 2;
+			return src_size;
+		}
+		const unsigned char *p = src, *end = src + src_size;
+		while ((p = (const unsigned char *)std::memchr(p, 0x00, end - p))) {
+			// EUC-JP: 0x8e takes NUL as the second byte. the first 0x8e of a run is
+			// always the first byte, so the run of odd length takes the NUL.
+			if (encoding == Encoding::EUCJP) {
+				unsigned int run = 0;
+				while (p - run > src && p[-1 - (int)run] == 0x8e) ++run;
+				if (run & 1) {
+					++p;
+					continue;
+				}
+				// 0x8f needs 2 bytes to be a bad sequence
+				if (p > src && p[-1] == 0x8f && p + 1 < end) return (unsigned int)(p - src) + 2;
+			}
+			return (unsigned int)(p - src) + 1;
+		}
+		return src_size;
+	}
+
+	/* The first position in [pos, limit) where a character begins regardless of the
+	 * text before it, or limit. Decoding the text before it alone gives the same result.
+	 */
+	unsigned int find_boundary(const unsigned char *src, unsigned int pos, unsigned int limit, Encoding::EncodingType encoding, bool big_endian)
+	{
+		switch (encoding) {
+		case Encoding::UTF16:
+			// after a code unit which is not a high surrogate
+			for (pos += pos & 1; pos < limit; pos += 2)
+				if ((src[pos - 2 + (big_endian ? 0 : 1)] & 0xfc) != 0xd8) return pos;
+			break;
+		case Encoding::UTF8:
+			// not a continuation byte, or after 3 continuation bytes
+			for (; pos < limit; ++pos) {
+				if ((src[pos] & 0xc0) != 0x80) return pos;
+				unsigned int n = 1;
+				while (n <= 3 && (src[pos - n] & 0xc0) == 0x80) ++n;
+				if (n > 3) return pos;
+			}
+			break;
+		case Encoding::SHIFTJIS:
+		case Encoding::CP932:
+			// after a single byte which is not the second byte
+			for (; pos < limit; ++pos)
+				if (src[pos - 1] < 0x40 || src[pos - 1] == 0x7f) return pos;
+			break;
+		case Encoding::EUCJP:
+			// after ASCII which is not the second byte of a bad 3 bytes sequence
+			for (; pos < limit; ++pos)
+				if (src[pos - 1] < 0x80 && src[pos - 2] != 0x8f) return pos;
+			break;
+		default:
+			break;
+		}
+		return limit;
+	}
+
+	// run f(0), ..., f(n - 1) on n threads
+	template <class F>
+	void run_parallel(unsigned int n, const F &f)
+	{
+		std::vector<std::thread> workers;
+		for (unsigned int k = 1; k < n; ++k)
+			workers.emplace_back([&f, k] { f(k); });
+		f(0);
+		for (auto &w : workers) w.join();
+	}
 }
 
 unsigned int Encoding::decode(int *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size, EncodingType encoding)
@@ -297,10 +965,191 @@ unsigned int Encoding::decode(int *dest, unsigned int dest_size, const unsigned
 	switch (encoding) {
 	case UTF16: return ::decode_utf16(dest, dest_size, src, src_size);
 	case UTF8: return ::decode_utf8(dest, dest_size, src, src_size);
-	case SHIFTJIS: return ::decode_shiftjis(dest, dest_size, src, src_size);
-	case EUCJP: return ::decode_eucjp(dest, dest_size, src, src_size);
+	case SHIFTJIS: return ::decode_shiftjis<ShiftjisProfile>(dest, dest_size, src, src_size, nullptr);
+	case CP932: return ::decode_shiftjis<Cp932Profile>(dest, dest_size, src, src_size, nullptr);
+	case EUCJP: return ::decode_eucjp(dest, dest_size, src, src_size, nullptr);
 	}
 
 	// unknown encoding.
 	return 0;
 }
+
+std::vector<int> Encoding::decode(const unsigned char *src, unsigned int src_size, EncodingType encoding)
+{
+	// auto encoding judgement
+	if (encoding == NONE) encoding = getEncoding(src, src_size);
+
+	// decoding into the upper bound, then shrinking
+	std::vector<int> dest(decodeBound(src_size, encoding));
+	if (!dest.empty()) dest.resize(decode(&dest[0], (unsigned int)dest.size(), src, src_size, encoding));
+	dest.shrink_to_fit();
+	return dest;
+}
+
+unsigned int Encoding::decodeBound(unsigned int src_size, EncodingType encoding)
+{
+	// every codepoint consumes at least 1 code unit
+	if (encoding == UTF16) return src_size / 2;
+	return src_size;
+}
+
+Encoding::Decoder::Decoder(EncodingType encoding)
+	: initial_(encoding)
+{
+	reset();
+}
+
+void Encoding::Decoder::feed(std::vector<int> &dest, const unsigned char *src, unsigned int src_size)
+{
+	if (ended_ || !src_size) return;
+
+	if (!started_) {
+		// auto encoding judgement
+		if (encoding_ == NONE) encoding_ = getEncoding(src, src_size);
+		// waiting for the bytes to recognize BOM (same condition as decode())
+		const unsigned int head = encoding_ == UTF16 ? 2 : encoding_ == UTF8 ? 4 : 0;
+		while (pending_.size() < head && src_size) pending_.push_back(*src++), --src_size;
+		if (pending_.size() < head) return;
+		started_ = true;
+		// recognize BOM
+		if (encoding_ == UTF16) {
+			if (pending_[0] == 0xff && pending_[1] == 0xfe) pending_.clear();
+			else if (pending_[0] == 0xfe && pending_[1] == 0xff) pending_.clear(), big_endian_ = true;
+		} else if (encoding_ == UTF8) {
+			if (pending_[0] == 0xef && pending_[1] == 0xbb && pending_[2] == 0xbf)
+				pending_.erase(pending_.begin(), pending_.begin() + 3);
+		}
+	}
+
+	// the kept bytes and the head of the chunk (a sequence is at most 4 bytes,
+	// so the sequence which begins in the kept bytes ends here)
+	if (!pending_.empty()) {
+		const unsigned int kept = (unsigned int)pending_.size();
+		const unsigned int head = src_size < 8 ? src_size : 8;
+		pending_.insert(pending_.end(), src, src + head);
+		const unsigned int read = decodeChunk(dest, &pending_[0], (unsigned int)pending_.size(), false);
+		if (head == src_size || ended_) {
+			pending_.erase(pending_.begin(), pending_.begin() + read);
+			return;
+		}
+		pending_.clear();
+		src += read - kept, src_size -= read - kept;
+	}
+
+	// the rest of the chunk
+	const unsigned int read = decodeChunk(dest, src, src_size, false);
+	pending_.assign(src + read, src + src_size);
+}
+
+void Encoding::Decoder::finish(std::vector<int> &dest)
+{
+	if (!ended_ && !pending_.empty()) {
+		// the stream is too short to recognize BOM
+		if (!started_) {
+			const std::vector<int> rest = decode(&pending_[0], (unsigned int)pending_.size(), encoding_);
+			dest.insert(dest.end(), rest.begin(), rest.end());
+		}
+		else decodeChunk(dest, &pending_[0], (unsigned int)pending_.size(), true);
+	}
+	reset();
+}
+
+void Encoding::Decoder::reset()
+{
+	encoding_ = initial_;
+	started_ = ended_ = big_endian_ = false;
+	pending_.clear();
+}
+
+unsigned int Encoding::Decoder::decodeChunk(std::vector<int> &dest, const unsigned char *src, unsigned int src_size, bool last)
+{
+	const unsigned int len = (unsigned int)dest.size();
+	unsigned int read = src_size, n;
+	unsigned int *stop = last ? nullptr : &read;
+
+	if (!src_size) return 0;
+
+	// one more element not to pass nullptr
+	dest.resize(len + decodeBound(src_size, encoding_) + 1);
+	n = ::decode_body(&dest[len], (unsigned int)dest.size() - len, src, src_size, encoding_, big_endian_, stop);
+	dest.resize(len + n);
+
+	// end of text
+	if (read < src_size && src[read] == 0x00)
+		if (encoding_ != UTF16 || (read + 1 < src_size && src[read + 1] == 0x00)) ended_ = true;
+	return read;
+}
+
+unsigned int Encoding::decodeParallel(int *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size, EncodingType encoding, unsigned int threads)
+{
+	// auto encoding judgement
+	if (encoding == NONE) encoding = getEncoding(src, src_size);
+	if (!threads) threads = std::thread::hardware_concurrency();
+
+	// small text
+	if (threads <= 1 || src_size / PARALLEL_CHUNK_SIZE < 2)
+		return decode(dest, dest_size, src, src_size, encoding);
+
+	// recognize BOM
+	bool big_endian = false;
+	if (encoding == UTF16) {
+		if (src[0] == 0xff && src[1] == 0xfe) {
+			src += 2, src_size -= 2;
+		} else if (src[0] == 0xfe && src[1] == 0xff) {
+			src += 2, src_size -= 2;
+			big_endian = true;
+		}
+	} else if (encoding == UTF8) {
+		if (src[0] == 0xef && src[1] == 0xbb && src[2] == 0xbf)
+			src += 3, src_size -= 3;
+	}
+	src_size = ::text_size(src, src_size, encoding);
+
+	// splitting into chunks at character boundaries
+	const unsigned int n = std::min(threads, std::max(src_size / PARALLEL_CHUNK_SIZE, 1u));
+	std::vector<unsigned int> begin(1, 0);
+	for (unsigned int k = 1; k < n; ++k) {
+		const unsigned int pos = (unsigned int)((unsigned long long)src_size * k / n);
+		const unsigned int limit = (unsigned int)((unsigned long long)src_size * (k + 1) / n);
+		const unsigned int b = ::find_boundary(src, pos, limit, encoding, big_endian);
+		if (b < limit) begin.push_back(b);
+	}
+	begin.push_back(src_size);
+	const unsigned int chunks = (unsigned int)begin.size() - 1;
+
+	// counting each chunk, then the prefix sum gives the place of each chunk
+	std::vector<unsigned int> offset(chunks + 1, 0);
+	::run_parallel(chunks, [&](unsigned int k) {
+		offset[k + 1] = ::decode_body(nullptr, 0, src + begin[k], begin[k + 1] - begin[k], encoding, big_endian, nullptr);
+	});
+	for (unsigned int k = 0; k < chunks; ++k) offset[k + 1] += offset[k];
+	if (!dest) return offset[chunks];
+
+	// decoding each chunk into its place (the decoders may overwrite dest after
+	// the decoded text, so dest_size is limited to the place)
+	std::vector<unsigned int> length(chunks, 0);
+	::run_parallel(chunks, [&](unsigned int k) {
+		if (offset[k] < dest_size)
+			length[k] = ::decode_body(dest + offset[k], std::min(offset[k + 1], dest_size) - offset[k], src + begin[k], begin[k + 1] - begin[k], encoding, big_endian, nullptr);
+	});
+	// the chunk at dest_size may stop before a character (or a two character
+	// sequence) which doesn't fit
+	for (unsigned int k = 0; k < chunks; ++k)
+		if (offset[k + 1] >= dest_size) return offset[k] + length[k];
+	return offset[chunks];
+}
+
+unsigned int Encoding::decodeBatch(int *const *dest, const unsigned int *dest_size, const unsigned char *const *src, const unsigned int *src_size, unsigned int count, EncodingType encoding, unsigned int *lengths)
+{
+	// interleaved decoding
+	if (encoding == SHIFTJIS) return ::decode_batch<ShiftjisProfile>(dest, dest_size, src, src_size, count, lengths);
+	if (encoding == CP932) return ::decode_batch<Cp932Profile>(dest, dest_size, src, src_size, count, lengths);
+
+	// other encodings (and guessing) one by one
+	unsigned int total = 0;
+	for (unsigned int k = 0; k < count; ++k) {
+		lengths[k] = decode(dest[k], dest[k] ? dest_size[k] : 0, src[k], src_size[k], encoding);
+		total += lengths[k];
+	}
+	return total;
+}
@@ -0,0 +1,84 @@
+// decode_literal.h
+#ifndef INCLUDED_DECODE_LITERAL_H_
+#define INCLUDED_DECODE_LITERAL_H_
+
+#include "encoding.h"
+#include "jis2unicode.h"
+#include <array>
+#include <cstddef>
+
+namespace Encoding {
+	/** Transform Shift_JIS/EUC-JP/CP932 text into Unicode codepoint at compile time.
+	 *
+	 * Same as decode() with the same tables, but it can be evaluated in a
+	 * constant expression. The characters are decoded by shiftjis_sequence() and
+	 * eucjp_sequence() one by one. Intended for string literals, so it is not fast.
+	 *
+	 * @param dest Destination pointer for Unicode codepoint sequence or nullptr.
+	 * @param dest_size Maximum length of dest (without U'\0').
+	 * @param src Source text.
+	 * @param src_size Maximum length of src (without '\0').
+	 * @param encoding Encoding of src (SHIFTJIS, EUCJP or CP932).
+	 *
+	 * @retval The length of the text which is actually decoded.
+	 * If dest is nullptr, this function only counts the necessary size of dest.
+	 * Other encodings are not supported and return 0.
+	 */
+	constexpr unsigned int decodeLiteral(char32_t *dest, unsigned int dest_size, const char *src, unsigned int src_size, EncodingType encoding)
+	{
+		unsigned int len = 0;
+
+		if (encoding != SHIFTJIS && encoding != EUCJP && encoding != CP932) return 0;
+
+		for (unsigned int i = 0; i < src_size && (!dest || len < dest_size); ++len) {
+			// end of text
+			if (src[i] == 0x00) break;
+			// the sequence functions read unsigned bytes (3 bytes at most)
+			const unsigned int size = src_size - i < 3 ? src_size - i : 3;
+			unsigned char bytes[3] = {};
+			for (unsigned int k = 0; k < size; ++k) bytes[k] = (unsigned char)src[i + k];
+			int codepoint = 0;
+			const unsigned int length =
+				encoding == SHIFTJIS ? shiftjis_sequence<ShiftjisProfile>(bytes, size, codepoint) :
+				encoding == CP932 ? shiftjis_sequence<Cp932Profile>(bytes, size, codepoint) :
+				eucjp_sequence(bytes, size, codepoint);
+			// a sequence without the following bytes
+			if (!length) break;
+			// two character sequence
+			if (codepoint < 0) {
+				if (dest) {
+					// stop before the sequence if it doesn't fit
+					if (len + 1 >= dest_size) break;
+					dest[len] = (char32_t)jisx0213_sequence(codepoint)[0];
+					dest[len + 1] = (char32_t)jisx0213_sequence(codepoint)[1];
+				}
+				++len;
+			}
+			else if (dest) dest[len] = (char32_t)codepoint;
+			i += length;
+		}
+		return len;
+	}
+
+	/** Transform a Shift_JIS/EUC-JP/CP932 string literal into Unicode codepoint at compile time.
+	 *
+	 * USAGE:
+	 *   constexpr auto text = Encoding::decodeLiteral("\x82\xa0\x82\xa2", Encoding::SHIFTJIS);
+	 *     text: std::array<char32_t, 5> {0x3042, 0x3044, 0, 0, 0}
+	 *
+	 * @param src Source string literal.
+	 * @param encoding Encoding of src (SHIFTJIS, EUCJP or CP932).
+	 *
+	 * @retval Unicode codepoints padded with U'\0'. A character has at least 1
+	 * byte, so the text always fits and is terminated by U'\0'.
+	 */
+	template <std::size_t N>
+	constexpr std::array<char32_t, N> decodeLiteral(const char (&src)[N], EncodingType encoding)
+	{
+		std::array<char32_t, N> dest = {};
+		decodeLiteral(dest.data(), (unsigned int)(N - 1), src, (unsigned int)(N - 1), encoding);
+		return dest;
+	}
+}
+
+#endif // INCLUDED_DECODE_LITERAL_H_
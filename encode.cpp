@@ -1,34 +1,469 @@
 // encode.cpp
 #include "encoding.h"
 #include "jis2unicode.h"
+#include "simd.h"
+#include <cstring>
 
 namespace {
-	// UTF-16 LE/BE encoder
-	unsigned int encode_utf16(unsigned char *dest, unsigned int dest_size, const int *src, unsigned int src_size)
+	// whether a codepoint can be encoded (not a surrogate nor above U+10FFFF)
+	inline bool is_scalar_value(int codepoint)
 	{
-		// not implemented yet.
-		return 0;
+		return (unsigned int)codepoint <= 0x10ffff && (codepoint & 0xfffff800) != 0xd800;
 	}
 
+#ifdef ENCODING_USE_SSE2
+	/* Narrow a block of 8 codepoints into 16-bit lanes.
+	 * Returns false if the block has codepoints out of U+0001-U+FFFE or surrogates.
+	 */
+	inline bool narrow_bmp_block(const int *src, __m128i &codes)
+	{
+		// biased by 0x8000 for the signed saturation, so U+0001-U+FFFE are kept
+		// (0 and the negative codepoints become 0, U+FFFF and above 0xffff)
+		const __m128i bias = _mm_set1_epi32(0x8000);
+		const __m128i u = _mm_packs_epi32(_mm_sub_epi32(_mm_loadu_si128((const __m128i *)src), bias),
+			_mm_sub_epi32(_mm_loadu_si128((const __m128i *)(src + 4)), bias));
+		codes = _mm_xor_si128(u, _mm_set1_epi16((short)0x8000));
+		const __m128i bad = _mm_or_si128(_mm_or_si128(
+			_mm_cmpeq_epi16(codes, _mm_setzero_si128()), _mm_cmpeq_epi16(codes, _mm_set1_epi16(-1))),
+			_mm_cmpeq_epi16(_mm_and_si128(codes, _mm_set1_epi16((short)0xf800)), _mm_set1_epi16((short)0xd800)));
+		return !_mm_movemask_epi8(bad);
+	}
+#endif
+
+	// store a UTF-16 code unit in the byte order
+	inline void put_utf16(unsigned char *dest, unsigned int code, bool big_endian)
+	{
+		dest[big_endian ? 0 : 1] = (unsigned char)(code >> 8);
+		dest[big_endian ? 1 : 0] = (unsigned char)(code & 0xff);
+	}
+
+	/* UTF-16 LE/BE encoder
+	 * Blocks of 8 codepoints of the BMP are narrowed with SSE2, and the others
+	 * (surrogate pairs and U+FFFD for bad codepoints) are stored one by one.
+	 * bom: store BOM at the beginning.
+	 */
+	unsigned int encode_utf16(unsigned char *dest, unsigned int dest_size, const int *src, unsigned int src_size, bool big_endian, bool bom)
+	{
+		unsigned int i = 0, len = 0;
+
+		if (!dest) {
+			// counting
+			unsigned int pairs = 0;
+#ifdef ENCODING_USE_SSE2
+			// 4 codepoints blocks without NUL: 1 code unit, and 1 more for U+10000-U+10FFFF
+			__m128i extra = _mm_setzero_si128();
+			for (; src_size - i >= 4; i += 4) {
+				const __m128i c = _mm_loadu_si128((const __m128i *)(src + i));
+				if (_mm_movemask_epi8(_mm_cmpeq_epi32(c, _mm_setzero_si128()))) break;
+				extra = _mm_sub_epi32(extra, _mm_sub_epi32(_mm_cmpgt_epi32(c, _mm_set1_epi32(0xffff)), _mm_cmpgt_epi32(c, _mm_set1_epi32(0x10ffff))));
+			}
+			extra = _mm_add_epi32(extra, _mm_shuffle_epi32(extra, 0x4e));
+			extra = _mm_add_epi32(extra, _mm_shuffle_epi32(extra, 0xb1));
+			pairs = (unsigned int)_mm_cvtsi128_si32(extra);
+#endif
+			for (; i < src_size && src[i] != 0; ++i) pairs += 0x10000 <= src[i] && src[i] <= 0x10ffff;
+			return (bom ? 2 : 0) + 2 * (i + pairs);
+		}
+
+		// BOM
+		if (bom) {
+			if (dest_size < 2) return 0;
+			put_utf16(dest, 0xfeff, big_endian);
+			len = 2;
+		}
+
+		// encoding
+		for (; i < src_size; ++i) {
+#ifdef ENCODING_USE_SSE2
+			// 8 codepoints blocks of the BMP
+			__m128i codes;
+			while (src_size - i >= 8 && dest_size - len >= 16 && narrow_bmp_block(src + i, codes)) {
+				if (big_endian) codes = _mm_or_si128(_mm_slli_epi16(codes, 8), _mm_srli_epi16(codes, 8));
+				_mm_storeu_si128((__m128i *)(dest + len), codes);
+				i += 8, len += 16;
+			}
+			if (i >= src_size) break;
+#endif
+			int codepoint = src[i];
+			// end of text
+			if (codepoint == 0) break;
+			if (!is_scalar_value(codepoint)) codepoint = Encoding::UNICODE_BAD_SEQUENCE;
+			// stop before a character which doesn't fit
+			if (codepoint < 0x10000) {
+				if (dest_size - len < 2) break;
+				put_utf16(dest + len, (unsigned int)codepoint, big_endian);
+				len += 2;
+			} else {
+				// surrogate pair
+				if (dest_size - len < 4) break;
+				codepoint -= 0x10000;
+				put_utf16(dest + len, 0xd800 | (unsigned int)codepoint >> 10, big_endian);
+				put_utf16(dest + len + 2, 0xdc00 | (codepoint & 0x3ff), big_endian);
+				len += 4;
+			}
+		}
+		return len;
+	}
+
+	// length of the UTF-8 sequence of a codepoint (U+FFFD for a bad codepoint)
+	inline unsigned int utf8_length(int codepoint)
+	{
+		if (!is_scalar_value(codepoint)) return 3;
+		return codepoint < 0x80 ? 1 : codepoint < 0x800 ? 2 : codepoint < 0x10000 ? 3 : 4;
+	}
+
+	// store the UTF-8 sequence of a codepoint (U+FFFD for a bad codepoint)
+	inline void put_utf8(unsigned char *dest, int codepoint)
+	{
+		if (!is_scalar_value(codepoint)) codepoint = Encoding::UNICODE_BAD_SEQUENCE;
+		if (codepoint < 0x80) {
+			dest[0] = (unsigned char)codepoint;
+		} else if (codepoint < 0x800) {
+			dest[0] = (unsigned char)(0xc0 | codepoint >> 6);
+			dest[1] = (unsigned char)(0x80 | (codepoint & 0x3f));
+		} else if (codepoint < 0x10000) {
+			dest[0] = (unsigned char)(0xe0 | codepoint >> 12);
+			dest[1] = (unsigned char)(0x80 | (codepoint >> 6 & 0x3f));
+			dest[2] = (unsigned char)(0x80 | (codepoint & 0x3f));
+		} else {
+			dest[0] = (unsigned char)(0xf0 | codepoint >> 18);
+			dest[1] = (unsigned char)(0x80 | (codepoint >> 12 & 0x3f));
+			dest[2] = (unsigned char)(0x80 | (codepoint >> 6 & 0x3f));
+			dest[3] = (unsigned char)(0x80 | (codepoint & 0x3f));
+		}
+	}
+
+#ifdef ENCODING_USE_SSE2
+	/* Narrow a block of 16 ASCII codepoints (without NUL) into 16 bytes.
+	 * dest may be nullptr (checking only).
+	 * Returns false if the block has other codepoints (nothing is stored).
+	 */
+	inline bool narrow_ascii_block(unsigned char *dest, const int *src)
+	{
+		// the saturations keep the codepoints above 0x7f and the negative ones out of 0x01-0x7f
+		const __m128i lo = _mm_packs_epi32(_mm_loadu_si128((const __m128i *)src), _mm_loadu_si128((const __m128i *)(src + 4)));
+		const __m128i hi = _mm_packs_epi32(_mm_loadu_si128((const __m128i *)(src + 8)), _mm_loadu_si128((const __m128i *)(src + 12)));
+		const __m128i v = _mm_packus_epi16(lo, hi);
+		if (Encoding::range_mask(v, 0x01, 0x7f) != 0xffff) return false;
+		if (dest) _mm_storeu_si128((__m128i *)dest, v);
+		return true;
+	}
+
+#ifdef ENCODING_USE_SSSE3
+	/* Shuffle table which packs the UTF-8 sequences in the 32-bit lanes, and
+	 * the length of the packed sequences. The lower 4 bits of the index are the
+	 * lanes of 2 or 3 bytes, and the upper 4 bits are the lanes of 3 bytes.
+	 */
+	struct Utf8PackTable {
+		unsigned char index[256][16];
+		unsigned char length[256];
+
+		Utf8PackTable()
+		{
+			for (int mask = 0; mask < 256; ++mask) {
+				int n = 0;
+				for (int lane = 0; lane < 4; ++lane) {
+					const int length = 1 + (mask >> lane & 1) + (mask >> (lane + 4) & 1);
+					for (int k = 0; k < length; ++k) index[mask][n++] = (unsigned char)(4 * lane + k);
+				}
+				length[mask] = (unsigned char)n;
+				while (n < 16) index[mask][n++] = 0x80;
+			}
+		}
+	};
+#endif
+
+	/* Encode a block of 8 codepoints of the BMP (without NUL and surrogates).
+	 * The codepoints are narrowed to 16-bit lanes, and the sequences of 1~3 bytes
+	 * are made in 32-bit lanes, then packed. 32 bytes of dest must be available.
+	 * Returns the length of the UTF-8 text, or 0 if the block has other codepoints.
+	 */
+	inline unsigned int encode_utf8_block(unsigned char *dest, const int *src)
+	{
+		__m128i c;
+		if (!narrow_bmp_block(src, c)) return 0;
+		const __m128i u = _mm_xor_si128(c, _mm_set1_epi16((short)0x8000));
+
+		// the first 2 bytes and the third byte of each length (little endian)
+		const __m128i low6 = _mm_set1_epi16(0x3f);
+		const __m128i trail = _mm_or_si128(_mm_and_si128(c, low6), _mm_set1_epi16(0x80));
+		const __m128i head2 = _mm_or_si128(_mm_or_si128(_mm_srli_epi16(c, 6), _mm_set1_epi16(0xc0)), _mm_slli_epi16(trail, 8));
+		const __m128i middle = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(c, 6), low6), _mm_set1_epi16(0x80));
+		const __m128i head3 = _mm_or_si128(_mm_or_si128(_mm_srli_epi16(c, 12), _mm_set1_epi16(0xe0)), _mm_slli_epi16(middle, 8));
+		const __m128i multi = _mm_cmpgt_epi16(u, _mm_set1_epi16(0x7f - 0x8000));
+		const __m128i three = _mm_cmpgt_epi16(u, _mm_set1_epi16(0x7ff - 0x8000));
+		const __m128i head = _mm_or_si128(_mm_andnot_si128(multi, c),
+			_mm_or_si128(_mm_and_si128(three, head3), _mm_andnot_si128(three, _mm_and_si128(multi, head2))));
+		const __m128i tail = _mm_and_si128(three, trail);
+		const __m128i seq[2] = {_mm_unpacklo_epi16(head, tail), _mm_unpackhi_epi16(head, tail)};
+		// lanes of 2 or 3 bytes (bits 0-7) and lanes of 3 bytes (bits 8-15)
+		const unsigned int lengths = (unsigned int)_mm_movemask_epi8(_mm_packs_epi16(multi, three));
+
+		unsigned int n = 0;
+		for (int half = 0; half < 2; ++half) {
+			const unsigned int mask = (lengths >> (4 * half) & 0x0f) | (lengths >> (4 * half + 4) & 0xf0);
+#ifdef ENCODING_USE_SSSE3
+			static const Utf8PackTable table;
+			_mm_storeu_si128((__m128i *)(dest + n), _mm_shuffle_epi8(seq[half], _mm_loadu_si128((const __m128i *)table.index[mask])));
+			n += table.length[mask];
+#else
+			// each lane is stored as 4 bytes, and the next one overwrites the rest
+			unsigned int lanes[4];
+			_mm_storeu_si128((__m128i *)lanes, seq[half]);
+			for (int lane = 0; lane < 4; ++lane) {
+				std::memcpy(dest + n, &lanes[lane], 4);
+				n += 1 + (mask >> lane & 1) + (mask >> (lane + 4) & 1);
+			}
+#endif
+		}
+		return n;
+	}
+#endif
+
 	// UTF-8 encoder
 	unsigned int encode_utf8(unsigned char *dest, unsigned int dest_size, const int *src, unsigned int src_size)
 	{
-		// not implemented yet.
-		return 0;
+		unsigned int i = 0, len = 0;
+
+		if (!dest) {
+			// counting
+#ifdef ENCODING_USE_SSE2
+			// 4 codepoints blocks without NUL: 1 byte and 1 more for each limit which
+			// the codepoint exceeds (bad codepoints are 3 bytes of U+FFFD)
+			__m128i lengths = _mm_setzero_si128();
+			for (; src_size - i >= 4; i += 4) {
+				const __m128i c = _mm_loadu_si128((const __m128i *)(src + i));
+				if (_mm_movemask_epi8(_mm_cmpeq_epi32(c, _mm_setzero_si128()))) break;
+				const __m128i negative = _mm_cmplt_epi32(c, _mm_setzero_si128());
+				lengths = _mm_sub_epi32(lengths, _mm_add_epi32(_mm_add_epi32(negative, negative),
+					_mm_add_epi32(_mm_cmpgt_epi32(c, _mm_set1_epi32(0x7f)), _mm_cmpgt_epi32(c, _mm_set1_epi32(0x7ff)))));
+				lengths = _mm_sub_epi32(lengths, _mm_sub_epi32(_mm_cmpgt_epi32(c, _mm_set1_epi32(0xffff)), _mm_cmpgt_epi32(c, _mm_set1_epi32(0x10ffff))));
+			}
+			lengths = _mm_add_epi32(lengths, _mm_shuffle_epi32(lengths, 0x4e));
+			lengths = _mm_add_epi32(lengths, _mm_shuffle_epi32(lengths, 0xb1));
+			len = i + (unsigned int)_mm_cvtsi128_si32(lengths);
+#endif
+			for (; i < src_size && src[i] != 0; ++i) len += utf8_length(src[i]);
+			return len;
+		}
+
+		// encoding
+		for (; i < src_size; ++i) {
+#ifdef ENCODING_USE_SSE2
+			// 8 codepoints blocks of the BMP, 16 codepoints blocks of ASCII after an ASCII block
+			unsigned int bytes = 8;
+			while (src_size - i >= 8 && dest_size - len >= 32) {
+				if (bytes == 8 && src_size - i >= 16 && narrow_ascii_block(dest + len, src + i)) {
+					i += 16, len += 16;
+					continue;
+				}
+				bytes = encode_utf8_block(dest + len, src + i);
+				if (!bytes) break;
+				i += 8, len += bytes;
+			}
+			if (i >= src_size) break;
+#endif
+			// end of text
+			if (src[i] == 0) break;
+			// stop before a character which doesn't fit
+			const unsigned int n = utf8_length(src[i]);
+			if (dest_size - len < n) break;
+			put_utf8(dest + len, src[i]);
+			len += n;
+		}
+		return len;
 	}
 
-	// Shift_JIS encoder
-	unsigned int encode_shiftjis(unsigned char *dest, unsigned int dest_size, const int *src, unsigned int src_size)
+	/* Policies for the characters which are not in Shift_JIS/EUC-JP
+	 * The encoders are templates of a policy of encoding.h, so the policy is
+	 * chosen at compile time.
+	 *   stop           : whether the encoding stops before the character
+	 *   size(codepoint): bytes of the replacement (0: skipped)
+	 *   put(dest, codepoint): store the replacement
+	 */
+	template <class Policy>
+	struct Unmappable;
+
+	template <>
+	struct Unmappable<Encoding::SubstituteUnmappable> {
+		static constexpr bool stop = false;
+		static unsigned int size(int) { return 1; }
+		static void put(unsigned char *dest, int) { dest[0] = '?'; }
+	};
+
+	template <>
+	struct Unmappable<Encoding::ReferenceUnmappable> {
+		static constexpr bool stop = false;
+		// "&#" digits ";"
+		static unsigned int size(int codepoint)
+		{
+			if (!is_scalar_value(codepoint)) codepoint = Encoding::UNICODE_BAD_SEQUENCE;
+			unsigned int n = 4;
+			for (; codepoint >= 10; codepoint /= 10) ++n;
+			return n;
+		}
+		static void put(unsigned char *dest, int codepoint)
+		{
+			if (!is_scalar_value(codepoint)) codepoint = Encoding::UNICODE_BAD_SEQUENCE;
+			unsigned int n = size(codepoint);
+			dest[0] = '&', dest[1] = '#', dest[--n] = ';';
+			// digits from the last one
+			for (; n > 2; codepoint /= 10) dest[--n] = (unsigned char)('0' + codepoint % 10);
+		}
+	};
+
+	template <>
+	struct Unmappable<Encoding::SkipUnmappable> {
+		static constexpr bool stop = false;
+		static unsigned int size(int) { return 0; }
+		static void put(unsigned char *, int) {}
+	};
+
+	template <>
+	struct Unmappable<Encoding::StopUnmappable> {
+		static constexpr bool stop = true;
+		static unsigned int size(int) { return 0; }
+		static void put(unsigned char *, int) {}
+	};
+
+	/* Shift_JIS encoder
+	 * The codepoints are looked up by unicode_2_shiftjis, and the two character
+	 * sequences of JIS X 0213 are encoded as a character.
+	 */
+	template <class Policy>
+	unsigned int encode_shiftjis(unsigned char *dest, unsigned int dest_size, const int *src, unsigned int src_size, unsigned int *read)
 	{
-		// not implemented yet.
-		return 0;
+		unsigned int len = 0, i;
+#ifdef ENCODING_USE_SSE2
+		unsigned int block = 0;
+#endif
+
+		for (i = 0; i < src_size; ++i) {
+#ifdef ENCODING_USE_SSE2
+			// 16 codepoints blocks of ASCII (retried 16 codepoints after a failure)
+			if (i >= block) {
+				while (src_size - i >= 16 && (!dest || dest_size - len >= 16) && narrow_ascii_block(dest ? dest + len : nullptr, src + i))
+					i += 16, len += 16;
+				if (i >= src_size) break;
+				block = i + 16;
+			}
+#endif
+			const int codepoint = src[i];
+			// end of text
+			if (codepoint == 0) break;
+			int code = Encoding::unicode_2_shiftjis(codepoint);
+			// two character sequence (the second is consumed after the character is stored)
+			unsigned int second = 0;
+			if (i + 1 < src_size && Encoding::jisx0213_is_sequence_second(src[i + 1])) {
+				const int sequence = Encoding::unicode_2_jisx0213_sequence(codepoint, src[i + 1]);
+				if (sequence >= 0) code = Encoding::jisx0213_2_shiftjis(sequence), second = 1;
+			}
+			// not in Shift_JIS
+			if (code < 0) {
+				if (Unmappable<Policy>::stop) break;
+				const unsigned int n = Unmappable<Policy>::size(codepoint);
+				if (dest) {
+					if (dest_size - len < n) break;
+					Unmappable<Policy>::put(dest + len, codepoint);
+				}
+				len += n;
+				continue;
+			}
+
+			// stop before a character which doesn't fit
+			if (code > 0xff) {
+				if (dest) {
+					if (dest_size - len < 2) break;
+					dest[len] = (unsigned char)(code >> 8);
+					dest[len + 1] = (unsigned char)(code & 0xff);
+				}
+				len += 2;
+			} else {
+				if (dest) {
+					if (len >= dest_size) break;
+					dest[len] = (unsigned char)code;
+				}
+				++len;
+			}
+			i += second;
+		}
+		if (read) *read = i;
+		return len;
 	}
 
-	// EUC-JP encoder
-	unsigned int encode_eucjp(unsigned char *dest, unsigned int dest_size, const int *src, unsigned int src_size)
+	/* EUC-JP encoder
+	 * The codepoints are looked up by unicode_2_eucjp, and the two character
+	 * sequences of JIS X 0213 are encoded as a character.
+	 */
+	template <class Policy>
+	unsigned int encode_eucjp(unsigned char *dest, unsigned int dest_size, const int *src, unsigned int src_size, unsigned int *read)
 	{
-		// not implemented yet.
-		return 0;
+		unsigned int len = 0, i;
+#ifdef ENCODING_USE_SSE2
+		unsigned int block = 0;
+#endif
+
+		for (i = 0; i < src_size; ++i) {
+#ifdef ENCODING_USE_SSE2
+			// 16 codepoints blocks of ASCII (retried 16 codepoints after a failure)
+			if (i >= block) {
+				while (src_size - i >= 16 && (!dest || dest_size - len >= 16) && narrow_ascii_block(dest ? dest + len : nullptr, src + i))
+					i += 16, len += 16;
+				if (i >= src_size) break;
+				block = i + 16;
+			}
+#endif
+			const int codepoint = src[i];
+			// end of text
+			if (codepoint == 0) break;
+			int code = Encoding::unicode_2_eucjp(codepoint);
+			// two character sequence (the second is consumed after the character is stored)
+			unsigned int second = 0;
+			if (i + 1 < src_size && Encoding::jisx0213_is_sequence_second(src[i + 1])) {
+				const int sequence = Encoding::unicode_2_jisx0213_sequence(codepoint, src[i + 1]);
+				if (sequence >= 0) code = Encoding::jisx0213_2_eucjp(sequence), second = 1;
+			}
+			// not in EUC-JP
+			if (code < 0) {
+				if (Unmappable<Policy>::stop) break;
+				const unsigned int n = Unmappable<Policy>::size(codepoint);
+				if (dest) {
+					if (dest_size - len < n) break;
+					Unmappable<Policy>::put(dest + len, codepoint);
+				}
+				len += n;
+				continue;
+			}
+
+			// stop before a character which doesn't fit
+			if (code < 0x80) {
+				if (dest) {
+					if (len >= dest_size) break;
+					dest[len] = (unsigned char)code;
+				}
+				++len;
+			} else if (code & 0x80) {
+				// JIS X 0201 kana, JIS X 0213 plane 1
+				if (dest) {
+					if (dest_size - len < 2) break;
+					dest[len] = (unsigned char)(code >> 8);
+					dest[len + 1] = (unsigned char)(code & 0xff);
+				}
+				len += 2;
+			} else {
+				// JIS X 0213 plane 2
+				if (dest) {
+					if (dest_size - len < 3) break;
+					dest[len] = 0x8f;
+					dest[len + 1] = (unsigned char)(code >> 8);
+					dest[len + 2] = (unsigned char)((code & 0xff) | 0x80);
+				}
+				len += 3;
+			}
+			i += second;
+		}
+		if (read) *read = i;
+		return len;
 	}
 
 }
@@ -37,12 +472,33 @@ unsigned int Encoding::encode(unsigned char *dest, unsigned int dest_size, const
 {
 	// dispatching
 	switch (encoding) {
-	case UTF16: return ::encode_utf16(dest, dest_size, src, src_size);
+	case UTF16: return ::encode_utf16(dest, dest_size, src, src_size, false, true);
 	case UTF8: return ::encode_utf8(dest, dest_size, src, src_size);
-	case SHIFTJIS: return ::encode_shiftjis(dest, dest_size, src, src_size);
-	case EUCJP: return ::encode_eucjp(dest, dest_size, src, src_size);
+	case SHIFTJIS: return ::encode_shiftjis<SubstituteUnmappable>(dest, dest_size, src, src_size, nullptr);
+	case EUCJP: return ::encode_eucjp<SubstituteUnmappable>(dest, dest_size, src, src_size, nullptr);
+	case CP932: // decoding only
+	default: break;
 	}
 
 	// unknown encoding.
 	return 0;
-}
\ No newline at end of file
+}
+
+unsigned int Encoding::encodeUtf16(unsigned char *dest, unsigned int dest_size, const int *src, unsigned int src_size, bool big_endian, bool bom)
+{
+	return ::encode_utf16(dest, dest_size, src, src_size, big_endian, bom);
+}
+
+template <class Policy>
+unsigned int Encoding::encodeJis(unsigned char *dest, unsigned int dest_size, const int *src, unsigned int src_size, EncodingType encoding, unsigned int *read)
+{
+	if (encoding == SHIFTJIS) return ::encode_shiftjis<Policy>(dest, dest_size, src, src_size, read);
+	if (encoding == EUCJP) return ::encode_eucjp<Policy>(dest, dest_size, src, src_size, read);
+	if (read) *read = 0;
+	return 0;
+}
+
+template unsigned int Encoding::encodeJis<Encoding::SubstituteUnmappable>(unsigned char *, unsigned int, const int *, unsigned int, EncodingType, unsigned int *);
+template unsigned int Encoding::encodeJis<Encoding::ReferenceUnmappable>(unsigned char *, unsigned int, const int *, unsigned int, EncodingType, unsigned int *);
+template unsigned int Encoding::encodeJis<Encoding::SkipUnmappable>(unsigned char *, unsigned int, const int *, unsigned int, EncodingType, unsigned int *);
+template unsigned int Encoding::encodeJis<Encoding::StopUnmappable>(unsigned char *, unsigned int, const int *, unsigned int, EncodingType, unsigned int *);
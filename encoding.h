@@ -3,6 +3,8 @@
 #ifndef INCLUDED_ENCODING_H_
 #define INCLUDED_ENCODING_H_
 
+#include <vector>
+
 namespace Encoding {
 
 	/// Encoding type
@@ -13,10 +15,12 @@ namespace Encoding {
 		UTF16,
 		/// UTF-8 encoding
 		UTF8,
-		/// Shift_JIS/CP932 encoding
+		/// Shift_JIS encoding (JIS X 0213)
 		SHIFTJIS,
 		/// EUC-JP encoding
-		EUCJP
+		EUCJP,
+		/// CP932 (Windows-31J) encoding (Shift_JIS with the vendor extensions)
+		CP932
 	};
 
 	/// Unicode registered symbols
@@ -36,23 +40,256 @@ namespace Encoding {
 	 * @retval The length of the text which is actually decoded.
 	 * (with invalid code (0xfffd), without L'\0')
 	 * If dest is nullptr, this function only counts the necessary size of dest.
+	 * The elements of dest after the returned length may be overwritten.
 	 */
 	unsigned int decode(int *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size, EncodingType encoding);
 
-	/** Transform a specified encoding into Unicode codepoint.
+	/** Transform a specified encoding into Unicode codepoint with threads.
 	 *
-	 * @param dest Destination pointer for encoded text or nullptr.
+	 * The text is split at character boundaries, and the chunks are counted and
+	 * decoded on threads. The result is the same as decode().
+	 *
+	 * @param dest Destination pointer for Unicode codepoint sequence or nullptr.
 	 * @param dest_size Maximum length of dest (without L'\0').
+	 * @param src Source text.
+	 * @param src_size Maximum length of src (without L'\0').
+	 * @param encoding Encoding of src.
+	 * @param threads Number of threads (0: number of hardware threads).
+	 * 
+	 * @retval Same as decode().
+	 * Small text (a few MB) is decoded by the calling thread only.
+	 */
+	unsigned int decodeParallel(int *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size, EncodingType encoding, unsigned int threads = 0);
+
+	/** Transform many short texts of a specified encoding into Unicode codepoint.
+	 *
+	 * Shift_JIS and CP932 texts are decoded a few at a time in turn, so that the
+	 * lookups of the conversion table for the texts overlap each other. Texts of
+	 * the other encodings are decoded one by one. The result of each text is the
+	 * same as decode().
+	 *
+	 * @param dest Destination pointers for each text (nullptr: counting only).
+	 * @param dest_size Maximum lengths of dest (without L'\0').
+	 * @param src Source texts.
+	 * @param src_size Maximum lengths of src (without L'\0').
+	 * @param count Number of the texts.
+	 * @param encoding Encoding of the texts (NONE: guessed for each text).
+	 * @param lengths Set to the result of decode() for each text.
+	 * 
+	 * @retval The sum of lengths.
+	 */
+	unsigned int decodeBatch(int *const *dest, const unsigned int *dest_size, const unsigned char *const *src, const unsigned int *src_size, unsigned int count, EncodingType encoding, unsigned int *lengths);
+
+	/** Transform a specified encoding into Unicode codepoint in a single pass.
+	 *
+	 * @param src Source text.
+	 * @param src_size Maximum length of src (without L'\0').
+	 * @param encoding Encoding of src.
+	 * 
+	 * @retval Decoded codepoint sequence (with invalid code (0xfffd), without L'\0').
+	 */
+	std::vector<int> decode(const unsigned char *src, unsigned int src_size, EncodingType encoding);
+
+	/** Calculate an upper bound of the length of decoded text.
+	 *
+	 * @param src_size Length of source text.
+	 * @param encoding Encoding of source text.
+	 * 
+	 * @retval The maximum length which decode() can store from src_size bytes.
+	 * This function doesn't read the text, so it can be used to allocate dest
+	 * without the counting pass.
+	 */
+	unsigned int decodeBound(unsigned int src_size, EncodingType encoding);
+
+	/** Stateful decoder for a text which is given in chunks.
+	 *
+	 * A multibyte sequence which is split between chunks is kept until the next
+	 * chunk, and BOM is recognized only at the beginning of the stream, so feeding
+	 * all chunks and calling finish() gives the same result as decode() of the
+	 * whole text. At most a few bytes are kept between the calls.
+	 */
+	class Decoder {
+	public:
+		/** Constructor.
+		 *
+		 * @param encoding Encoding of the stream.
+		 * If encoding is NONE, it is guessed from the first chunk.
+		 */
+		explicit Decoder(EncodingType encoding);
+
+		/** Decode a chunk of the stream.
+		 *
+		 * @param dest Destination. Decoded codepoints are appended.
+		 * @param src Chunk of the text.
+		 * @param src_size Length of src.
+		 * 
+		 * The text after L'\0' is ignored, as decode() does.
+		 */
+		void feed(std::vector<int> &dest, const unsigned char *src, unsigned int src_size);
+
+		/** Decode the rest of the stream and return to the initial state.
+		 *
+		 * @param dest Destination. Decoded codepoints are appended.
+		 */
+		void finish(std::vector<int> &dest);
+
+		/// Discard the stream and return to the initial state.
+		void reset();
+
+	private:
+		unsigned int decodeChunk(std::vector<int> &dest, const unsigned char *src, unsigned int src_size, bool last);
+
+		EncodingType initial_, encoding_;
+		bool started_, ended_, big_endian_;
+		// bytes which are not decoded yet
+		std::vector<unsigned char> pending_;
+	};
+
+	/** Transform Unicode codepoint into a specified encoding.
+	 *
+	 * Surrogates (U+D800-U+DFFF), negative codepoints and codepoints above
+	 * U+10FFFF are encoded as U+FFFD. In Shift_JIS/EUC-JP, characters which are not
+	 * in JIS X 0213 nor JIS X 0201 are encoded as '?', and the two character
+	 * sequences of JIS X 0213 (U+304B U+309A etc.) as a character.
+	 *
+	 * @param dest Destination pointer for encoded text or nullptr.
+	 * @param dest_size Maximum length of dest (without '\0').
 	 * @param src Unicode codepoint sequence.
 	 * @param src_size Maximum length of src (without L'\0').
-	 * @param encoding Encoding of dest.
+	 * @param encoding Encoding of dest (UTF16: little endian with BOM, UTF8, SHIFTJIS, EUCJP).
 	 * 
-	 * @retval The length of the text which is actually encoded.
-	 * (without L'\0')
+	 * @retval The length of the text which is actually encoded (in bytes).
+	 * (without '\0')
+	 * A character which doesn't fit into dest is not stored.
 	 * If dest is nullptr, this function only counts the necessary size of dest.
+	 * CP932 is supported only in decoding (returns 0).
 	 */
 	unsigned int encode(unsigned char *dest, unsigned int dest_size, const int *src, unsigned int src_size, EncodingType encoding);
 
+	/** Transform Unicode codepoint into UTF-16 of a specified byte order.
+	 *
+	 * Same as encode() with UTF16, but the byte order and BOM are chosen.
+	 *
+	 * @param dest Destination pointer for UTF-16 text or nullptr.
+	 * @param dest_size Maximum length of dest (in bytes, without u'\0').
+	 * @param src Unicode codepoint sequence.
+	 * @param src_size Maximum length of src (without L'\0').
+	 * @param big_endian Byte order of dest (false: little endian).
+	 * @param bom Whether BOM (U+FEFF) is stored at the beginning of dest.
+	 * 
+	 * @retval Same as encode() (in bytes).
+	 */
+	unsigned int encodeUtf16(unsigned char *dest, unsigned int dest_size, const int *src, unsigned int src_size, bool big_endian, bool bom);
+
+	/// Policies for the characters which are not in Shift_JIS/EUC-JP (see encodeJis())
+	/// Substituted by '?' (same as encode())
+	struct SubstituteUnmappable {};
+	/// HTML numeric character reference (&#12354;, &#65533; for invalid codepoints)
+	struct ReferenceUnmappable {};
+	/// Skipped
+	struct SkipUnmappable {};
+	/// Encoding stops before the character
+	struct StopUnmappable {};
+
+	/** Transform Unicode codepoint into Shift_JIS/EUC-JP with a policy.
+	 *
+	 * Same as encode(), but the characters which are not in JIS X 0213 nor
+	 * JIS X 0201 are handled by Policy. The policy is chosen at compile time,
+	 * so the loop has no branches for it. Policy is one of SubstituteUnmappable,
+	 * ReferenceUnmappable, SkipUnmappable and StopUnmappable.
+	 *
+	 * @param dest Destination pointer for encoded text or nullptr.
+	 * @param dest_size Maximum length of dest (without '\0').
+	 * @param src Unicode codepoint sequence.
+	 * @param src_size Maximum length of src (without L'\0').
+	 * @param encoding Encoding of dest (SHIFTJIS or EUCJP).
+	 * @param read Set to the number of the codepoints which are encoded, or nullptr.
+	 * With StopUnmappable, src[*read] is the character which stopped counting
+	 * (dest is nullptr) if *read < src_size and src[*read] != 0.
+	 * 
+	 * @retval Same as encode() (in bytes).
+	 * Other encodings of dest are not supported (returns 0).
+	 */
+	template <class Policy>
+	unsigned int encodeJis(unsigned char *dest, unsigned int dest_size, const int *src, unsigned int src_size, EncodingType encoding, unsigned int *read = nullptr);
+
+	/** Transform Shift_JIS/EUC-JP text into UTF-8 directly.
+	 *
+	 * The result is the same as decode() followed by UTF-8 encoding, without
+	 * the intermediate codepoint sequence.
+	 *
+	 * @param dest Destination pointer for UTF-8 text or nullptr.
+	 * @param dest_size Maximum length of dest (without '\0').
+	 * @param src Source text.
+	 * @param src_size Maximum length of src (without '\0').
+	 * @param encoding Encoding of src (SHIFTJIS, EUCJP or CP932, NONE: guessed).
+	 * 
+	 * @retval The length of the text which is actually stored (in bytes).
+	 * A character which doesn't fit into dest is not stored.
+	 * If dest is nullptr, this function only counts the necessary size of dest.
+	 * Other encodings of src are not supported (returns 0).
+	 */
+	unsigned int decodeToUtf8(unsigned char *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size, EncodingType encoding);
+
+	/** Calculate an upper bound of the length of decodeToUtf8() result.
+	 *
+	 * @param src_size Length of source text (less than 0x55555556).
+	 * @param encoding Encoding of source text.
+	 * 
+	 * @retval The maximum length which decodeToUtf8() can store from src_size bytes.
+	 * 3 * src_size for SHIFTJIS, CP932, EUCJP and NONE, 0 for UTF16 and UTF8
+	 * (not supported by decodeToUtf8()).
+	 */
+	unsigned int decodeToUtf8Bound(unsigned int src_size, EncodingType encoding);
+
+	/** Transform a specified encoding into UTF-16 directly.
+	 *
+	 * The result is the same as decode() followed by UTF-16 encoding (characters
+	 * above U+FFFF become surrogate pairs, and codepoints above U+10FFFF from
+	 * broken UTF-8 become U+FFFD), without the intermediate codepoint sequence.
+	 *
+	 * @param dest Destination pointer for UTF-16 text (native endian) or nullptr.
+	 * @param dest_size Maximum length of dest (without u'\0').
+	 * @param src Source text.
+	 * @param src_size Maximum length of src (without '\0').
+	 * @param encoding Encoding of src.
+	 * 
+	 * @retval The length of the text which is actually stored (in code units).
+	 * A character which doesn't fit into dest is not stored.
+	 * If dest is nullptr, this function only counts the necessary size of dest.
+	 */
+	unsigned int decodeToUtf16(char16_t *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size, EncodingType encoding);
+
+	/** Calculate an upper bound of the length of decodeToUtf16() result.
+	 *
+	 * @param src_size Length of source text.
+	 * @param encoding Encoding of source text.
+	 * 
+	 * @retval The maximum length which decodeToUtf16() can store from src_size bytes.
+	 */
+	unsigned int decodeToUtf16Bound(unsigned int src_size, EncodingType encoding);
+
+	/** Transform a file of a specified encoding into Unicode codepoint.
+	 *
+	 * The file is mapped into memory and decoded without copying.
+	 *
+	 * @param dest Destination. It is replaced with the decoded codepoint sequence.
+	 * @param path Path of the file.
+	 * @param encoding Encoding of the file (NONE: guessed from the file).
+	 * 
+	 * @retval true if the file is read, false otherwise (dest is empty).
+	 */
+	bool decodeFile(std::vector<int> &dest, const char *path, EncodingType encoding);
+
+	/** Guess the encoding type of a file.
+	 *
+	 * @param path Path of the file.
+	 * 
+	 * @retval An EncodingType value which is guessed from the file,
+	 * or NONE if the file can't be read.
+	 */
+	EncodingType getEncodingOfFile(const char *path);
+
 	/** Guess the encoding type of text data.
 	 *
 	 * @param src Source text.
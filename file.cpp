@@ -0,0 +1,111 @@
+// file.cpp
+#include "encoding.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+	/* Read only mapping of a whole file.
+	 * data is nullptr if the file can't be mapped, and also for an empty file
+	 * (then size is 0 and ok() is true).
+	 */
+	class MappedFile {
+	public:
+		explicit MappedFile(const char *path);
+		~MappedFile();
+
+		bool ok() const { return ok_; }
+		const unsigned char *data() const { return data_; }
+		unsigned int size() const { return size_; }
+
+	private:
+		MappedFile(const MappedFile &) = delete;
+		MappedFile &operator=(const MappedFile &) = delete;
+
+		const unsigned char *data_;
+		unsigned int size_;
+		bool ok_;
+	};
+
+#ifdef _WIN32
+	MappedFile::MappedFile(const char *path)
+		: data_(nullptr), size_(0), ok_(false)
+	{
+		// the cache manager reads ahead for sequential scan
+		HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE) return;
+
+		LARGE_INTEGER size;
+		// the interface takes unsigned int lengths
+		if (GetFileSizeEx(file, &size) && size.QuadPart <= 0xffffffff) {
+			if (size.QuadPart == 0) ok_ = true;
+			else {
+				HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+				if (mapping) {
+					data_ = (const unsigned char *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+					// the view keeps the mapping
+					CloseHandle(mapping);
+					if (data_) size_ = (unsigned int)size.QuadPart, ok_ = true;
+				}
+			}
+		}
+		CloseHandle(file);
+	}
+
+	MappedFile::~MappedFile()
+	{
+		if (data_) UnmapViewOfFile(data_);
+	}
+#else
+	MappedFile::MappedFile(const char *path)
+		: data_(nullptr), size_(0), ok_(false)
+	{
+		const int fd = open(path, O_RDONLY);
+		if (fd < 0) return;
+
+		struct stat st;
+		// the interface takes unsigned int lengths
+		if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && (unsigned long long)st.st_size <= 0xffffffffull) {
+			if (st.st_size == 0) ok_ = true;
+			else {
+				void *p = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+				if (p != MAP_FAILED) {
+					// the decoders and the judgement read the text from the beginning to the end
+					madvise(p, (size_t)st.st_size, MADV_SEQUENTIAL);
+					data_ = (const unsigned char *)p, size_ = (unsigned int)st.st_size, ok_ = true;
+				}
+			}
+		}
+		// the mapping is kept after closing
+		close(fd);
+	}
+
+	MappedFile::~MappedFile()
+	{
+		if (data_) munmap((void *)data_, size_);
+	}
+#endif
+}
+
+bool Encoding::decodeFile(std::vector<int> &dest, const char *path, EncodingType encoding)
+{
+	const MappedFile file(path);
+	dest.clear();
+	if (!file.ok()) return false;
+	if (file.size()) dest = decode(file.data(), file.size(), encoding);
+	return true;
+}
+
+Encoding::EncodingType Encoding::getEncodingOfFile(const char *path)
+{
+	const MappedFile file(path);
+	if (!file.ok()) return NONE;
+	return getEncoding(file.data(), file.size());
+}
@@ -2,6 +2,10 @@
 #ifndef INCLUDED_JIS_2_UNICODE_H_
 #define INCLUDED_JIS_2_UNICODE_H_
 
+#include "encoding.h"
+#include "jisx0213_table.h"
+#include "cp932_table.h"
+
 namespace Encoding {
 	/** JIS X 0201 to Unicode translating table
 	 * 
@@ -11,19 +15,533 @@ namespace Encoding {
 	 *     unicode: unicode character
 	 *     jis    : JIS X 0201 character
 	*/
-	extern const int jisx0201_2_unicode[];
+	inline constexpr int jisx0201_2_unicode[256] = {
+		// ASCII Compatible
+		0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+		0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+		0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+		0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f,
+		0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+		0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f,
+		0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+		0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f,
+		0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+		0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+		0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+		0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f,
+		0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+		0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+		0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+		0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x007f,
+		// Shift_JIS First Byte
+		0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+		0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+		0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+		0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+		// Halfwidth Katakana
+		0xfffd, 0xff61, 0xff62, 0xff63, 0xff64, 0xff65, 0xff66, 0xff67,
+		0xff68, 0xff69, 0xff6a, 0xff6b, 0xff6c, 0xff6d, 0xff6e, 0xff6f,
+		0xff70, 0xff71, 0xff72, 0xff73, 0xff74, 0xff75, 0xff76, 0xff77,
+		0xff78, 0xff79, 0xff7a, 0xff7b, 0xff7c, 0xff7d, 0xff7e, 0xff7f,
+		0xff80, 0xff81, 0xff82, 0xff83, 0xff84, 0xff85, 0xff86, 0xff87,
+		0xff88, 0xff89, 0xff8a, 0xff8b, 0xff8c, 0xff8d, 0xff8e, 0xff8f,
+		0xff90, 0xff91, 0xff92, 0xff93, 0xff94, 0xff95, 0xff96, 0xff97,
+		0xff98, 0xff99, 0xff9a, 0xff9b, 0xff9c, 0xff9d, 0xff9e, 0xff9f,
+		// Shift_JIS First Byte
+		0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+		0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+		0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+		0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd
+	};
 
-	/** JIS X 0213 to Unicode translating table
+	/* JIS X 0213 to Unicode translating table (jisx0213_table.h)
 	 * 
-	 * Untranslatable character is translated into U+FFFD character.
+	 * The tables are generated by tools/jistable.cpp.
+	 *   jisx0213_2_unicode[]:
+	 *     Untranslatable character is translated into U+FFFD character.
+	 *     The entries are 16 bits (35 KB in total). Surrogates are never mapped,
+	 *     so they are used as escapes:
+	 *       0xd800 + n: jisx0213_2_unicode_supplementary[n] (above U+FFFF)
+	 *       0xdc00 + n: jisx0213_2_unicode_sequence[n] (two character sequence, plane 1 only)
+	 *     Use jisx0213_codepoint() to look up.
+	 *   unicode_2_jisx0213_bitmap[], unicode_2_jisx0213_rank[], unicode_2_jisx0213_value[]:
+	 *     Reverse table of the BMP. Bit (codepoint & 63) of bitmap[codepoint >> 6]
+	 *     is set if the codepoint is mapped, and rank[codepoint >> 6] is the number
+	 *     of the mapped codepoints before the word, so that the value is
+	 *     value[rank + (number of the set bits below the bit)]. A value is an
+	 *     index of jisx0213_2_unicode, or JISX0201_INDEX + byte of JIS X 0201
+	 *     (ASCII & kana, which take precedence) (32 KB in total).
+	 *     The fullwidth forms (U+FF01 etc.) which are decoded to ASCII are also
+	 *     mapped to their cells (see DEVIATIONS of tools/jistable.cpp).
+	 *   unicode_2_jisx0213_supplementary_key[], unicode_2_jisx0213_supplementary_index[]:
+	 *     Reverse table of U+10000 and above (sorted codepoints).
+	 *   Use unicode_2_jisx0213() to look up.
 	 * USAGE:
-	 * 	 unicode = jisx0213_2_unicode[(plane-1)*94*94 + (row-1)*94 + (col-1)];
+	 * 	 unicode = jisx0213_codepoint((plane-1)*94*94 + (row-1)*94 + (col-1));
 	 * 	   unicode: unicode character
 	 *     plane  : JIS X 0213 "kaku" [1:2]
 	 *     row    : JIS X 0213 "ku" [1:94]
 	 *     col    : JIS X 0213 "ten" [1:94]
 	*/
-	extern const int jisx0213_2_unicode[];
+
+	/** Unicode codepoint of an index of jisx0213_2_unicode.
+	 *
+	 * @retval The codepoint, or a negative value for a two character sequence
+	 *         (see jisx0213_sequence()).
+	*/
+	constexpr int jisx0213_codepoint(int index)
+	{
+		const int code = jisx0213_2_unicode[index];
+		// supplementary planes & sequences
+		if ((code & 0xf800) == 0xd800) {
+			if (code < 0xdc00) return jisx0213_2_unicode_supplementary[code - 0xd800];
+			return ~(code - 0xdc00);
+		}
+		return code;
+	}
+
+	/// Two codepoints of a negative value of jisx0213_codepoint()
+	constexpr const int *jisx0213_sequence(int codepoint)
+	{
+		return jisx0213_2_unicode_sequence[~codepoint];
+	}
+
+	/// Whether an index of jisx0213_2_unicode is a two character sequence
+	constexpr bool jisx0213_is_sequence(int index)
+	{
+		// the range check saves the table lookup for most of the characters
+		return (unsigned int)(index - JISX0213_SEQUENCE_FIRST) <= (unsigned int)(JISX0213_SEQUENCE_LAST - JISX0213_SEQUENCE_FIRST)
+			&& (jisx0213_2_unicode[index] & 0xfc00) == 0xdc00;
+	}
+
+	/// Number of the set bits (std::popcount is C++20)
+	constexpr int popcount64(unsigned long long bits)
+	{
+#if defined(__GNUC__) && defined(__POPCNT__)
+		return __builtin_popcountll(bits);
+#else
+		bits -= bits >> 1 & 0x5555555555555555ull;
+		bits = (bits & 0x3333333333333333ull) + (bits >> 2 & 0x3333333333333333ull);
+		bits = (bits + (bits >> 4)) & 0x0f0f0f0f0f0f0f0full;
+		return (int)(bits * 0x0101010101010101ull >> 56);
+#endif
+	}
+
+	/** Index of jisx0213_2_unicode of a Unicode codepoint.
+	 *
+	 * @retval The index, JISX0201_INDEX + byte for JIS X 0201, or -1 if the codepoint
+	 *         is not in JIS X 0213 nor JIS X 0201.
+	*/
+	constexpr int unicode_2_jisx0213(int codepoint)
+	{
+		// BMP (bitmap and rank)
+		if ((unsigned int)codepoint < 0x10000) {
+			const unsigned long long bits = unicode_2_jisx0213_bitmap[codepoint >> 6], bit = 1ull << (codepoint & 63);
+			if (!(bits & bit)) return -1;
+			return unicode_2_jisx0213_value[unicode_2_jisx0213_rank[codepoint >> 6] + popcount64(bits & (bit - 1))];
+		}
+		// supplementary planes (binary search, they are rare)
+		int lo = 0, hi = UNICODE_2_JISX0213_SUPPLEMENTARY_SIZE;
+		while (lo < hi) {
+			const int mid = (lo + hi) / 2;
+			if (unicode_2_jisx0213_supplementary_key[mid] < codepoint) lo = mid + 1;
+			else hi = mid;
+		}
+		if (lo < UNICODE_2_JISX0213_SUPPLEMENTARY_SIZE && unicode_2_jisx0213_supplementary_key[lo] == codepoint)
+			return unicode_2_jisx0213_supplementary_index[lo];
+		return -1;
+	}
+
+	// number of the two character sequences
+	inline constexpr int JISX0213_SEQUENCE_SIZE = (int)(sizeof(jisx0213_2_unicode_sequence) / sizeof(jisx0213_2_unicode_sequence[0]));
+
+	// indices of jisx0213_2_unicode of the two character sequences
+	struct JisSequenceTable {
+		short index[JISX0213_SEQUENCE_SIZE];
+	};
+
+	constexpr JisSequenceTable make_jisx0213_sequence_table()
+	{
+		JisSequenceTable table = {};
+		for (int index = JISX0213_SEQUENCE_FIRST; index <= JISX0213_SEQUENCE_LAST; ++index) {
+			const int code = jisx0213_2_unicode[index];
+			if ((code & 0xfc00) == 0xdc00) table.index[code - 0xdc00] = (short)index;
+		}
+		return table;
+	}
+
+	inline constexpr JisSequenceTable jisx0213_sequence_table = make_jisx0213_sequence_table();
+
+	/// Whether a codepoint may be the second of a two character sequence (U+02E5-U+0301 or U+309A)
+	constexpr bool jisx0213_is_sequence_second(int codepoint)
+	{
+		return (unsigned int)(codepoint - 0x02e5) <= 0x0301 - 0x02e5 || codepoint == 0x309a;
+	}
+
+	/** Index of jisx0213_2_unicode of a two character sequence.
+	 *
+	 * @retval The index, or -1 if the codepoints are not a sequence of JIS X 0213.
+	*/
+	constexpr int unicode_2_jisx0213_sequence(int first, int second)
+	{
+		if (!jisx0213_is_sequence_second(second)) return -1;
+		for (int n = 0; n < JISX0213_SEQUENCE_SIZE; ++n) {
+			if (jisx0213_2_unicode_sequence[n][0] == first && jisx0213_2_unicode_sequence[n][1] == second)
+				return jisx0213_sequence_table.index[n];
+		}
+		return -1;
+	}
+
+	/** Shift_JIS to JIS X 0213 index table
+	 * 
+	 * The table is generated at compile time from the first byte offsets and the
+	 * plane 2 shifting rules, so that the lookup has no branches.
+	 * USAGE:
+	 *   index = shiftjis_table.lead[b1 * 2 + (b2 >= 0x9f)] + shiftjis_table.trail[b2];
+	 *     index: index of jisx0213_2_unicode (negative: bad sequence)
+	 *     b1   : Shift_JIS first byte
+	 *     b2   : Shift_JIS second byte
+	*/
+	struct ShiftjisTable {
+		short lead[256 * 2];
+		short trail[256];
+	};
+
+	// Shift_JIS first byte to JIS X 0213 index (-1: not a first byte)
+	inline constexpr int shiftjis_offset[128] = {
+		-1,  0*94,  2*94,  4*94,  6*94,  8*94, 10*94, 12*94,
+		14*94, 16*94, 18*94, 20*94, 22*94, 24*94, 26*94, 28*94,
+		30*94, 32*94, 34*94, 36*94, 38*94, 40*94, 42*94, 44*94,
+		46*94, 48*94, 50*94, 52*94, 54*94, 56*94, 58*94, 60*94,
+		-1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1,
+		62*94, 64*94, 66*94, 68*94, 70*94, 72*94, 74*94, 76*94,
+		78*94, 80*94, 82*94, 84*94, 86*94, 88*94, 90*94, 92*94,
+		(94+ 0)*94, (94+ 2)*94, (94+ 4)*94, (94+12)*94, (94+14)*94, (94+78)*94, (94+80)*94, (94+82)*94,
+		(94+84)*94, (94+86)*94, (94+88)*94, (94+90)*94, (94+92)*94, -1, -1, -1
+	};
+
+	// invalid first/second byte (the sum of any entries with this is negative)
+	inline constexpr short SHIFTJIS_INVALID = -20000;
+
+	// cp932: the first bytes 0xf0-0xfc are rows 95-120 of cp932_2_unicode without shifting
+	constexpr ShiftjisTable make_shiftjis_table(bool cp932)
+	{
+		ShiftjisTable table = {};
+		for (int b1 = 0x00; b1 <= 0xff; ++b1) {
+			// the second row of the pair (second byte >= 0x9f)
+			for (int even = 0; even <= 1; ++even) {
+				int offset = b1 >= 0x80 ? shiftjis_offset[b1 - 0x80] : -1;
+				if (cp932 && 0xf0 <= b1 && b1 <= 0xfc) offset = (94 + (b1 - 0xf0) * 2) * 94;
+				// jis x 0213 shifting (the second rows of 0xf0, 0xf2 and 0xf4 are not the next rows)
+				else if (offset != -1 && even) {
+					if (b1 == 0xf0 || b1 == 0xf2) offset += 6*94;
+					else if (b1 == 0xf4) offset += 62*94;
+				}
+				table.lead[b1 * 2 + even] = (short)(offset == -1 ? SHIFTJIS_INVALID : offset - 0x40);
+			}
+		}
+		for (int b2 = 0x00; b2 <= 0xff; ++b2) {
+			const bool valid = 0x40 <= b2 && b2 <= 0xfc && b2 != 0x7f;
+			table.trail[b2] = (short)(valid ? (b2 < 0x80 ? b2 : b2 - 1) : SHIFTJIS_INVALID);
+		}
+		return table;
+	}
+
+	inline constexpr ShiftjisTable shiftjis_table = make_shiftjis_table(false);
+	inline constexpr ShiftjisTable cp932_table = make_shiftjis_table(true);
+
+	/** Index of a Shift_JIS 2 bytes sequence in jisx0213_2_unicode.
+	 *
+	 * @param b1 First byte
+	 * @param b2 Second byte
+	 * 
+	 * @retval The index, or a negative value for a bad sequence.
+	*/
+	constexpr int shiftjis_2_jisx0213(unsigned char b1, unsigned char b2)
+	{
+		return shiftjis_table.lead[b1 * 2 + (b2 >= 0x9f)] + shiftjis_table.trail[b2];
+	}
+
+	/** JIS X 0213 to Shift_JIS table
+	 *
+	 * The table is generated at compile time from shiftjis_table, so that the
+	 * encoder is the inverse of the decoder (including the irregular first bytes
+	 * of plane 2).
+	 *   row[]: Shift_JIS code of col 1 of each row ((plane-1)*94 + (row-1)),
+	 *          or SHIFTJIS_NO_ROW if the row is not in Shift_JIS. The last 3
+	 *          rows are JIS X 0201 (JISX0201_INDEX + byte), whose codes are
+	 *          the bytes of col 1 (0, 94 and 188).
+	 * Use jisx0213_2_shiftjis() to look up.
+	*/
+	inline constexpr int SHIFTJIS_NO_ROW = 0xffff;
+
+	struct JisShiftjisTable {
+		unsigned short row[2 * 94 + 3];
+	};
+
+	static_assert(JISX0201_INDEX == 2 * 94 * 94 && JISX0201_INDEX + 0xff < (2 * 94 + 3) * 94, "JIS X 0201 rows of jisx0213_2_shiftjis_table");
+
+	constexpr JisShiftjisTable make_jisx0213_2_shiftjis_table()
+	{
+		JisShiftjisTable table = {};
+		for (int row = 0; row < 2 * 94; ++row) table.row[row] = SHIFTJIS_NO_ROW;
+		for (int b1 = 0x81; b1 <= 0xfc; ++b1) {
+			// the first columns of the pair of rows
+			for (const int b2 : {0x40, 0x9f}) {
+				const int index = shiftjis_2_jisx0213((unsigned char)b1, (unsigned char)b2);
+				if (index >= 0) table.row[index / 94] = (unsigned short)(b1 << 8 | b2);
+			}
+		}
+		// JIS X 0201 (1 byte)
+		for (int row = 0; row < 3; ++row) table.row[2 * 94 + row] = (unsigned short)(row * 94);
+		return table;
+	}
+
+	inline constexpr JisShiftjisTable jisx0213_2_shiftjis_table = make_jisx0213_2_shiftjis_table();
+
+	/** Shift_JIS code of an index of jisx0213_2_unicode (or JISX0201_INDEX + byte).
+	 *
+	 * @retval The 2 bytes code (first byte << 8 | second byte), the 1 byte code,
+	 *         or -1 if the index is not in Shift_JIS.
+	*/
+	constexpr int jisx0213_2_shiftjis(int index)
+	{
+		const int row = index / 94, col = index - row * 94;
+		const int code = jisx0213_2_shiftjis_table.row[row];
+		if (code == SHIFTJIS_NO_ROW) return -1;
+		// the first rows of the pairs skip 0x7f (& for no branch on the column)
+		return code + col + ((col >= 0x7f - 0x40) & ((code & 0xff) == 0x40));
+	}
+
+	/** Shift_JIS code of a Unicode codepoint.
+	 *
+	 * @retval The 2 bytes code (first byte << 8 | second byte), the 1 byte code,
+	 *         or -1 if the codepoint is not in Shift_JIS.
+	*/
+	constexpr int unicode_2_shiftjis(int codepoint)
+	{
+		const int index = unicode_2_jisx0213(codepoint);
+		return index >= 0 ? jisx0213_2_shiftjis(index) : -1;
+	}
+
+	/** EUC-JP code of an index of jisx0213_2_unicode.
+	 *
+	 * @retval The 2 bytes code of plane 1 (first byte << 8 | second byte), or
+	 *         the last 2 bytes of plane 2 (after 0x8f) with the highest bit of
+	 *         the last byte cleared.
+	*/
+	constexpr int jisx0213_2_eucjp(int index)
+	{
+		const int row = index / 94, col = index - row * 94;
+		if (row < 94) return (row + 0xa1) << 8 | (col + 0xa1);
+		return (row - 94 + 0xa1) << 8 | (col + 0x21);
+	}
+
+	/** EUC-JP code of a Unicode codepoint.
+	 *
+	 * @retval The code, or -1 if the codepoint is not in EUC-JP.
+	 * USAGE:
+	 *   code < 0x80  : 1 byte (code)
+	 *   code & 0x80  : 2 bytes (code >> 8, code & 0xff)
+	 *   otherwise    : 3 bytes (0x8f, code >> 8, code & 0xff | 0x80)
+	*/
+	constexpr int unicode_2_eucjp(int codepoint)
+	{
+		const int index = unicode_2_jisx0213(codepoint);
+		// ASCII, JIS X 0201 kana (0x8e prefix)
+		if (index >= JISX0201_INDEX) return index - JISX0201_INDEX < 0x80 ? index - JISX0201_INDEX : 0x8e00 | (index - JISX0201_INDEX);
+		return index >= 0 ? jisx0213_2_eucjp(index) : -1;
+	}
+
+	/* CP932 (Windows-31J) to Unicode translating table (cp932_table.h)
+	 *
+	 * The table is generated by tools/cp932table.cpp. CP932 is Shift_JIS of
+	 * JIS X 0208 with the vendor extensions (NEC special characters in row 13,
+	 * NEC selected IBM extensions in rows 89-92 and IBM extensions in rows 115-119).
+	 * The 1 byte characters are the same as jisx0201_2_unicode.
+	 *   cp932_2_unicode[]:
+	 *     Untranslatable character (and the user-defined area of rows 95-114) is
+	 *     translated into U+FFFD character. All characters are in the BMP.
+	 * USAGE:
+	 *   unicode = cp932_2_unicode[cp932_index(b1, b2)];
+	*/
+
+	/** Index of a CP932 2 bytes sequence in cp932_2_unicode.
+	 *
+	 * @param b1 First byte
+	 * @param b2 Second byte
+	 * 
+	 * @retval The index, or a negative value for a bad sequence.
+	*/
+	constexpr int cp932_index(unsigned char b1, unsigned char b2)
+	{
+		return cp932_table.lead[b1 * 2 + (b2 >= 0x9f)] + cp932_table.trail[b2];
+	}
+
+	/** Mapping profiles of the Shift_JIS decoders
+	 *
+	 * The decoders are templates of a profile, so the mapping is chosen at
+	 * compile time and the inner loops have no branches for it.
+	 *   index(b1, b2)     : index of a 2 bytes sequence (negative: bad sequence)
+	 *   codepoint(index)  : same as jisx0213_codepoint()
+	 *   is_sequence(index): same as jisx0213_is_sequence()
+	*/
+	// Shift_JIS (JIS X 0213)
+	struct ShiftjisProfile {
+		static constexpr int index(unsigned char b1, unsigned char b2) { return shiftjis_2_jisx0213(b1, b2); }
+		static constexpr int codepoint(int index) { return jisx0213_codepoint(index); }
+		static constexpr bool is_sequence(int index) { return jisx0213_is_sequence(index); }
+	};
+
+	// CP932 (no characters above U+FFFF nor sequences)
+	struct Cp932Profile {
+		static constexpr int index(unsigned char b1, unsigned char b2) { return cp932_index(b1, b2); }
+		static constexpr int codepoint(int index) { return cp932_2_unicode[index]; }
+		static constexpr bool is_sequence(int) { return false; }
+	};
+
+	/* Shift_JIS and EUC-JP characters without nested branches
+	 *
+	 * A character is decoded from the class of its first byte and whether the
+	 * following bytes are valid, without branches on each form of the sequences
+	 * nor stepping back after a bad sequence (a bad sequence is always the first
+	 * byte only, and the next character begins at the second byte). The decoders
+	 * use them if ENCODING_USE_TABLE_DECODER is defined.
+	 *   Shift_JIS: jisx0201_2_unicode[] is the class (U+FFFD: first byte of
+	 *              2 bytes sequence), and the index of the profile tells whether
+	 *              the second byte is valid (negative: bad sequence).
+	 *   EUC-JP   : eucjp_class[] is the class, and eucjp_form[] is the form of
+	 *              the sequence of [class * 4 + valid(b2) * 2 + valid(b3)].
+	 * Use shiftjis_sequence() and eucjp_sequence() to decode.
+	*/
+
+	/** Decode a Shift_JIS character.
+	 *
+	 * @param src Beginning of the character (not NUL).
+	 * @param size Available bytes of src (at least 1).
+	 * @param codepoint Set to the codepoint (U+FFFD for a bad sequence, or a
+	 *        negative value for a two character sequence, see jisx0213_sequence()).
+	 *
+	 * @retval The length of the character (1 for a bad sequence), or 0 if src is
+	 * the first byte of a 2 bytes sequence without the second byte.
+	*/
+	template <class Profile>
+	constexpr unsigned int shiftjis_sequence(const unsigned char *src, unsigned int size, int &codepoint)
+	{
+		const unsigned char b1 = src[0];
+		// the single byte characters are also bad sequences as 2 bytes
+		const int single = jisx0201_2_unicode[b1];
+		if (size < 2) {
+			if (single == UNICODE_BAD_SEQUENCE) return 0;
+			codepoint = single;
+			return 1;
+		}
+		const int index = Profile::index(b1, src[1]);
+		const bool valid = index >= 0;
+		const int multi = Profile::codepoint(valid ? index : 0);
+		codepoint = valid ? multi : single;
+		return 1 + valid;
+	}
+
+	// classes of the first byte of EUC-JP
+	enum EucjpClass {
+		EUCJP_CLASS_ASCII = 0,
+		EUCJP_CLASS_KANA,   // 0x8e
+		EUCJP_CLASS_PLANE2, // 0x8f
+		EUCJP_CLASS_PLANE1, // 0xa1-0xfe
+		EUCJP_CLASS_BAD     // other bytes >= 0x80
+	};
+
+	inline constexpr unsigned char eucjp_class[256] = {
+		// 00-7f: ASCII
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		// 80-8f: 8e (kana), 8f (plane 2), others
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 1, 2,
+		// 90-9f: others
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		// a0: invalid, a1-fe: first byte of plane 1, ff: invalid
+		4, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4
+	};
+
+	// forms of EUC-JP sequences
+	enum EucjpForm {
+		EUCJP_ASCII = 0,
+		EUCJP_KANA,
+		EUCJP_PLANE1,
+		EUCJP_PLANE2,
+		EUCJP_BAD
+	};
+
+	// form of [class * 4 + valid(b2) * 2 + valid(b3)] (valid: 0xa1-0xfe)
+	inline constexpr unsigned char eucjp_form[5 * 4] = {
+		EUCJP_ASCII, EUCJP_ASCII, EUCJP_ASCII, EUCJP_ASCII,
+		// the second byte of kana is not checked
+		EUCJP_KANA, EUCJP_KANA, EUCJP_KANA, EUCJP_KANA,
+		EUCJP_BAD, EUCJP_BAD, EUCJP_BAD, EUCJP_PLANE2,
+		EUCJP_BAD, EUCJP_BAD, EUCJP_PLANE1, EUCJP_PLANE1,
+		EUCJP_BAD, EUCJP_BAD, EUCJP_BAD, EUCJP_BAD
+	};
+
+	// length of each form
+	inline constexpr unsigned char eucjp_length[5] = {1, 2, 2, 3, 1};
+
+	// masks which select the codepoint of each form
+	struct EucjpSelect {
+		int ascii, kana, jis, bad;
+		bool plane2;
+	};
+	inline constexpr EucjpSelect eucjp_select[5] = {
+		{-1, 0, 0, 0, false},
+		{0, -1, 0, 0, false},
+		{0, 0, -1, 0, false},
+		{0, 0, -1, 0, true},
+		{0, 0, 0, UNICODE_BAD_SEQUENCE, false}
+	};
+
+	// bytes which are needed to decode each class (even if it is a bad sequence)
+	inline constexpr unsigned char eucjp_need[5] = {1, 2, 3, 2, 2};
+
+	/** Decode an EUC-JP character.
+	 *
+	 * @param src Beginning of the character (not NUL).
+	 * @param size Available bytes of src (at least 1).
+	 * @param codepoint Same as shiftjis_sequence().
+	 *
+	 * @retval The length of the character (1 for a bad sequence), or 0 if src
+	 * needs more bytes than size to be decoded.
+	*/
+	constexpr unsigned int eucjp_sequence(const unsigned char *src, unsigned int size, int &codepoint)
+	{
+		const unsigned char b1 = src[0], type = eucjp_class[b1];
+		if (size < eucjp_need[type]) return 0;
+		const unsigned char b2 = size > 1 ? src[1] : 0, b3 = size > 2 ? src[2] : 0;
+		const unsigned int valid2 = (unsigned char)(b2 - 0xa1) < 94, valid3 = (unsigned char)(b3 - 0xa1) < 94;
+		const unsigned char form = eucjp_form[type * 4 + valid2 * 2 + valid3];
+		const EucjpSelect &select = eucjp_select[form];
+		// index of jisx0213_2_unicode (0 if not JIS X 0213)
+		const int index = ((select.plane2 ? b2 + 94 : b1) * 94 + (select.plane2 ? b3 : b2) - (0xa1 * 94 + 0xa1)) & select.jis;
+		codepoint = (b1 & select.ascii) | (jisx0201_2_unicode[b2] & select.kana) | (jisx0213_codepoint(index) & select.jis) | select.bad;
+		return eucjp_length[form];
+	}
 }
 
 #endif // INCLUDED_JIS_2_UNICODE_H_
@@ -0,0 +1,5107 @@
+// jisx0213_table.h
+// This file is generated by tools/jistable.cpp from data/jisx0213-2004-8bit-std.txt.
+#ifndef INCLUDED_JISX0213_TABLE_H_
+#define INCLUDED_JISX0213_TABLE_H_
+
+namespace Encoding {
+	/* This table is converted by "JIS X 0213:2004 8-bit code vs Unicode mapping table" from x0213.org.
+	 * License:
+	 * 	Copyright (C) 2001 earthian@tama.or.jp, All Rights Reserved.
+	 * 	Copyright (C) 2001 I'O, All Rights Reserved.
+	 * 	Copyright (C) 2009 Project X0213, All Rights Reserved.
+	 * 	You can use, modify, distribute this table freely.
+	 */
+
+	// JIS X 0213 to Unicode (see jis2unicode.h)
+	inline constexpr unsigned short jisx0213_2_unicode[17672] = {
+	// plane 1 row 1
+	0x3000, 0x3001, 0x3002, 0x002c, 0x002e, 0x30fb, 0x003a, 0x003b,
+	0x003f, 0x0021, 0x309b, 0x309c, 0x00b4, 0x0060, 0x00a8, 0x005e,
+	0x203e, 0x005f, 0x30fd, 0x30fe, 0x309d, 0x309e, 0x3003, 0x4edd,
+	0x3005, 0x3006, 0x3007, 0x30fc, 0x2014, 0x2010, 0x002f, 0x005c,
+	0x301c, 0x2016, 0x007c, 0x2026, 0x2025, 0x2018, 0x2019, 0x201c,
+	0x201d, 0x0028, 0x0029, 0x3014, 0x3015, 0x005b, 0x005d, 0x007b,
+	0x007d, 0x3008, 0x3009, 0x300a, 0x300b, 0x300c, 0x300d, 0x300e,
+	0x300f, 0x3010, 0x3011, 0x002b, 0x2212, 0x00b1, 0x00d7, 0x00f7,
+	0x003d, 0x2260, 0x003c, 0x003e, 0x2266, 0x2267, 0x221e, 0x2234,
+	0x2642, 0x2640, 0x00b0, 0x2032, 0x2033, 0x2103, 0x00a5, 0x0024,
+	0x00a2, 0x00a3, 0x0025, 0x0023, 0x0026, 0x002a, 0x0040, 0x00a7,
+	0x2606, 0x2605, 0x25cb, 0x25cf, 0x25ce, 0x25c7,
+	// plane 1 row 2
+	0x25c6, 0x25a1, 0x25a0, 0x25b3, 0x25b2, 0x25bd, 0x25bc, 0x203b,
+	0x3012, 0x2192, 0x2190, 0x2191, 0x2193, 0x3013, 0x0027, 0x0022,
+	0x002d, 0x007e, 0x3033, 0x3034, 0x3035, 0x303b, 0x303c, 0x30ff,
+	0x309f, 0x2208, 0x220b, 0x2286, 0x2287, 0x2282, 0x2283, 0x222a,
+	0x2229, 0x2284, 0x2285, 0x228a, 0x228b, 0x2209, 0x2205, 0x2305,
+	0x2306, 0x2227, 0x2228, 0x00ac, 0x21d2, 0x21d4, 0x2200, 0x2203,
+	0x2295, 0x2296, 0x2297, 0x2225, 0x2226, 0xff5f, 0xff60, 0x3018,
+	0x3019, 0x3016, 0x3017, 0x2220, 0x22a5, 0x2312, 0x2202, 0x2207,
+	0x2261, 0x2252, 0x226a, 0x226b, 0x221a, 0x223d, 0x221d, 0x2235,
+	0x222b, 0x222c, 0x2262, 0x2243, 0x2245, 0x2248, 0x2276, 0x2277,
+	0x2194, 0x212b, 0x2030, 0x266f, 0x266d, 0x266a, 0x2020, 0x2021,
+	0x00b6, 0x266e, 0x266b, 0x266c, 0x2669, 0x25ef,
+	// plane 1 row 3
+	0x25b7, 0x25b6, 0x25c1, 0x25c0, 0x2197, 0x2198, 0x2196, 0x2199,
+	0x21c4, 0x21e8, 0x21e6, 0x21e7, 0x21e9, 0x2934, 0x2935, 0x0030,
+	0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038,
+	0x0039, 0x29bf, 0x25c9, 0x303d, 0xfe46, 0xfe45, 0x25e6, 0x2022,
+	0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048,
+	0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050,
+	0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058,
+	0x0059, 0x005a, 0x2213, 0x2135, 0x210f, 0x33cb, 0x2113, 0x2127,
+	0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068,
+	0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070,
+	0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078,
+	0x0079, 0x007a, 0x30a0, 0x2013, 0x29fa, 0x29fb,
+	// plane 1 row 4
+	0x3041, 0x3042, 0x3043, 0x3044, 0x3045, 0x3046, 0x3047, 0x3048,
+	0x3049, 0x304a, 0x304b, 0x304c, 0x304d, 0x304e, 0x304f, 0x3050,
+	0x3051, 0x3052, 0x3053, 0x3054, 0x3055, 0x3056, 0x3057, 0x3058,
+	0x3059, 0x305a, 0x305b, 0x305c, 0x305d, 0x305e, 0x305f, 0x3060,
+	0x3061, 0x3062, 0x3063, 0x3064, 0x3065, 0x3066, 0x3067, 0x3068,
+	0x3069, 0x306a, 0x306b, 0x306c, 0x306d, 0x306e, 0x306f, 0x3070,
+	0x3071, 0x3072, 0x3073, 0x3074, 0x3075, 0x3076, 0x3077, 0x3078,
+	0x3079, 0x307a, 0x307b, 0x307c, 0x307d, 0x307e, 0x307f, 0x3080,
+	0x3081, 0x3082, 0x3083, 0x3084, 0x3085, 0x3086, 0x3087, 0x3088,
+	0x3089, 0x308a, 0x308b, 0x308c, 0x308d, 0x308e, 0x308f, 0x3090,
+	0x3091, 0x3092, 0x3093, 0x3094, 0x3095, 0x3096, 0xdc00, 0xdc01,
+	0xdc02, 0xdc03, 0xdc04, 0xfffd, 0xfffd, 0xfffd,
+	// plane 1 row 5
+	0x30a1, 0x30a2, 0x30a3, 0x30a4, 0x30a5, 0x30a6, 0x30a7, 0x30a8,
+	0x30a9, 0x30aa, 0x30ab, 0x30ac, 0x30ad, 0x30ae, 0x30af, 0x30b0,
+	0x30b1, 0x30b2, 0x30b3, 0x30b4, 0x30b5, 0x30b6, 0x30b7, 0x30b8,
+	0x30b9, 0x30ba, 0x30bb, 0x30bc, 0x30bd, 0x30be, 0x30bf, 0x30c0,
+	0x30c1, 0x30c2, 0x30c3, 0x30c4, 0x30c5, 0x30c6, 0x30c7, 0x30c8,
+	0x30c9, 0x30ca, 0x30cb, 0x30cc, 0x30cd, 0x30ce, 0x30cf, 0x30d0,
+	0x30d1, 0x30d2, 0x30d3, 0x30d4, 0x30d5, 0x30d6, 0x30d7, 0x30d8,
+	0x30d9, 0x30da, 0x30db, 0x30dc, 0x30dd, 0x30de, 0x30df, 0x30e0,
+	0x30e1, 0x30e2, 0x30e3, 0x30e4, 0x30e5, 0x30e6, 0x30e7, 0x30e8,
+	0x30e9, 0x30ea, 0x30eb, 0x30ec, 0x30ed, 0x30ee, 0x30ef, 0x30f0,
+	0x30f1, 0x30f2, 0x30f3, 0x30f4, 0x30f5, 0x30f6, 0xdc05, 0xdc06,
+	0xdc07, 0xdc08, 0xdc09, 0xdc0a, 0xdc0b, 0xdc0c,
+	// plane 1 row 6
+	0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398,
+	0x0399, 0x039a, 0x039b, 0x039c, 0x039d, 0x039e, 0x039f, 0x03a0,
+	0x03a1, 0x03a3, 0x03a4, 0x03a5, 0x03a6, 0x03a7, 0x03a8, 0x03a9,
+	0x2664, 0x2660, 0x2662, 0x2666, 0x2661, 0x2665, 0x2667, 0x2663,
+	0x03b1, 0x03b2, 0x03b3, 0x03b4, 0x03b5, 0x03b6, 0x03b7, 0x03b8,
+	0x03b9, 0x03ba, 0x03bb, 0x03bc, 0x03bd, 0x03be, 0x03bf, 0x03c0,
+	0x03c1, 0x03c3, 0x03c4, 0x03c5, 0x03c6, 0x03c7, 0x03c8, 0x03c9,
+	0x03c2, 0x24f5, 0x24f6, 0x24f7, 0x24f8, 0x24f9, 0x24fa, 0x24fb,
+	0x24fc, 0x24fd, 0x24fe, 0x2616, 0x2617, 0x3020, 0x260e, 0x2600,
+	0x2601, 0x2602, 0x2603, 0x2668, 0x25b1, 0x31f0, 0x31f1, 0x31f2,
+	0x31f3, 0x31f4, 0x31f5, 0x31f6, 0x31f7, 0x31f8, 0x31f9, 0xdc0d,
+	0x31fa, 0x31fb, 0x31fc, 0x31fd, 0x31fe, 0x31ff,
+	// plane 1 row 7
+	0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0401, 0x0416,
+	0x0417, 0x0418, 0x0419, 0x041a, 0x041b, 0x041c, 0x041d, 0x041e,
+	0x041f, 0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426,
+	0x0427, 0x0428, 0x0429, 0x042a, 0x042b, 0x042c, 0x042d, 0x042e,
+	0x042f, 0x23be, 0x23bf, 0x23c0, 0x23c1, 0x23c2, 0x23c3, 0x23c4,
+	0x23c5, 0x23c6, 0x23c7, 0x23c8, 0x23c9, 0x23ca, 0x23cb, 0x23cc,
+	0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0451, 0x0436,
+	0x0437, 0x0438, 0x0439, 0x043a, 0x043b, 0x043c, 0x043d, 0x043e,
+	0x043f, 0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446,
+	0x0447, 0x0448, 0x0449, 0x044a, 0x044b, 0x044c, 0x044d, 0x044e,
+	0x044f, 0x30f7, 0x30f8, 0x30f9, 0x30fa, 0x22da, 0x22db, 0x2153,
+	0x2154, 0x2155, 0x2713, 0x2318, 0x2423, 0x23ce,
+	// plane 1 row 8
+	0x2500, 0x2502, 0x250c, 0x2510, 0x2518, 0x2514, 0x251c, 0x252c,
+	0x2524, 0x2534, 0x253c, 0x2501, 0x2503, 0x250f, 0x2513, 0x251b,
+	0x2517, 0x2523, 0x2533, 0x252b, 0x253b, 0x254b, 0x2520, 0x252f,
+	0x2528, 0x2537, 0x253f, 0x251d, 0x2530, 0x2525, 0x2538, 0x2542,
+	0x3251, 0x3252, 0x3253, 0x3254, 0x3255, 0x3256, 0x3257, 0x3258,
+	0x3259, 0x325a, 0x325b, 0x325c, 0x325d, 0x325e, 0x325f, 0x32b1,
+	0x32b2, 0x32b3, 0x32b4, 0x32b5, 0x32b6, 0x32b7, 0x32b8, 0x32b9,
+	0x32ba, 0x32bb, 0x32bc, 0x32bd, 0x32be, 0x32bf, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0x25d0, 0x25d1,
+	0x25d2, 0x25d3, 0x203c, 0x2047, 0x2048, 0x2049, 0x01cd, 0x01ce,
+	0x01d0, 0x1e3e, 0x1e3f, 0x01f8, 0x01f9, 0x01d1, 0x01d2, 0x01d4,
+	0x01d6, 0x01d8, 0x01da, 0x01dc, 0xfffd, 0xfffd,
+	// plane 1 row 9
+	0x20ac, 0x00a0, 0x00a1, 0x00a4, 0x00a6, 0x00a9, 0x00aa, 0x00ab,
+	0x00ad, 0x00ae, 0x00af, 0x00b2, 0x00b3, 0x00b7, 0x00b8, 0x00b9,
+	0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf, 0x00c0, 0x00c1,
+	0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7, 0x00c8, 0x00c9,
+	0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf, 0x00d0, 0x00d1,
+	0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d8, 0x00d9, 0x00da,
+	0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df, 0x00e0, 0x00e1, 0x00e2,
+	0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7, 0x00e8, 0x00e9, 0x00ea,
+	0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef, 0x00f0, 0x00f1, 0x00f2,
+	0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x00f8, 0x00f9, 0x00fa, 0x00fb,
+	0x00fc, 0x00fd, 0x00fe, 0x00ff, 0x0100, 0x012a, 0x016a, 0x0112,
+	0x014c, 0x0101, 0x012b, 0x016b, 0x0113, 0x014d,
+	// plane 1 row 10
+	0x0104, 0x02d8, 0x0141, 0x013d, 0x015a, 0x0160, 0x015e, 0x0164,
+	0x0179, 0x017d, 0x017b, 0x0105, 0x02db, 0x0142, 0x013e, 0x015b,
+	0x02c7, 0x0161, 0x015f, 0x0165, 0x017a, 0x02dd, 0x017e, 0x017c,
+	0x0154, 0x0102, 0x0139, 0x0106, 0x010c, 0x0118, 0x011a, 0x010e,
+	0x0143, 0x0147, 0x0150, 0x0158, 0x016e, 0x0170, 0x0162, 0x0155,
+	0x0103, 0x013a, 0x0107, 0x010d, 0x0119, 0x011b, 0x010f, 0x0111,
+	0x0144, 0x0148, 0x0151, 0x0159, 0x016f, 0x0171, 0x0163, 0x02d9,
+	0x0108, 0x011c, 0x0124, 0x0134, 0x015c, 0x016c, 0x0109, 0x011d,
+	0x0125, 0x0135, 0x015d, 0x016d, 0x0271, 0x028b, 0x027e, 0x0283,
+	0x0292, 0x026c, 0x026e, 0x0279, 0x0288, 0x0256, 0x0273, 0x027d,
+	0x0282, 0x0290, 0x027b, 0x026d, 0x025f, 0x0272, 0x029d, 0x028e,
+	0x0261, 0x014b, 0x0270, 0x0281, 0x0127, 0x0295,
+	// plane 1 row 11
+	0x0294, 0x0266, 0x0298, 0x01c2, 0x0253, 0x0257, 0x0284, 0x0260,
+	0x0193, 0x0153, 0x0152, 0x0268, 0x0289, 0x0258, 0x0275, 0x0259,
+	0x025c, 0x025e, 0x0250, 0x026f, 0x028a, 0x0264, 0x028c, 0x0254,
+	0x0251, 0x0252, 0x028d, 0x0265, 0x02a2, 0x02a1, 0x0255, 0x0291,
+	0x027a, 0x0267, 0x025a, 0xdc0e, 0x01fd, 0x1f70, 0x1f71, 0xdc0f,
+	0xdc10, 0xdc11, 0xdc12, 0xdc13, 0xdc14, 0xdc15, 0xdc16, 0x1f72,
+	0x1f73, 0x0361, 0x02c8, 0x02cc, 0x02d0, 0x02d1, 0x0306, 0x203f,
+	0x030b, 0x0301, 0x0304, 0x0300, 0x030f, 0x030c, 0x0302, 0x02e5,
+	0x02e6, 0x02e7, 0x02e8, 0x02e9, 0xdc17, 0xdc18, 0x0325, 0x032c,
+	0x0339, 0x031c, 0x031f, 0x0320, 0x0308, 0x033d, 0x0329, 0x032f,
+	0x02de, 0x0324, 0x0330, 0x033c, 0x0334, 0x031d, 0x031e, 0x0318,
+	0x0319, 0x032a, 0x033a, 0x033b, 0x0303, 0x031a,
+	// plane 1 row 12
+	0x2776, 0x2777, 0x2778, 0x2779, 0x277a, 0x277b, 0x277c, 0x277d,
+	0x277e, 0x277f, 0x24eb, 0x24ec, 0x24ed, 0x24ee, 0x24ef, 0x24f0,
+	0x24f1, 0x24f2, 0x24f3, 0x24f4, 0x2170, 0x2171, 0x2172, 0x2173,
+	0x2174, 0x2175, 0x2176, 0x2177, 0x2178, 0x2179, 0x217a, 0x217b,
+	0x24d0, 0x24d1, 0x24d2, 0x24d3, 0x24d4, 0x24d5, 0x24d6, 0x24d7,
+	0x24d8, 0x24d9, 0x24da, 0x24db, 0x24dc, 0x24dd, 0x24de, 0x24df,
+	0x24e0, 0x24e1, 0x24e2, 0x24e3, 0x24e4, 0x24e5, 0x24e6, 0x24e7,
+	0x24e8, 0x24e9, 0x32d0, 0x32d1, 0x32d2, 0x32d3, 0x32d4, 0x32d5,
+	0x32d6, 0x32d7, 0x32d8, 0x32d9, 0x32da, 0x32db, 0x32dc, 0x32dd,
+	0x32de, 0x32df, 0x32e0, 0x32e1, 0x32e2, 0x32e3, 0x32fa, 0x32e9,
+	0x32e5, 0x32ed, 0x32ec, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0x2051, 0x2042,
+	// plane 1 row 13
+	0x2460, 0x2461, 0x2462, 0x2463, 0x2464, 0x2465, 0x2466, 0x2467,
+	0x2468, 0x2469, 0x246a, 0x246b, 0x246c, 0x246d, 0x246e, 0x246f,
+	0x2470, 0x2471, 0x2472, 0x2473, 0x2160, 0x2161, 0x2162, 0x2163,
+	0x2164, 0x2165, 0x2166, 0x2167, 0x2168, 0x2169, 0x216a, 0x3349,
+	0x3314, 0x3322, 0x334d, 0x3318, 0x3327, 0x3303, 0x3336, 0x3351,
+	0x3357, 0x330d, 0x3326, 0x3323, 0x332b, 0x334a, 0x333b, 0x339c,
+	0x339d, 0x339e, 0x338e, 0x338f, 0x33c4, 0x33a1, 0x216b, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0x337b, 0x301d,
+	0x301f, 0x2116, 0x33cd, 0x2121, 0x32a4, 0x32a5, 0x32a6, 0x32a7,
+	0x32a8, 0x3231, 0x3232, 0x3239, 0x337e, 0x337d, 0x337c, 0xfffd,
+	0xfffd, 0xfffd, 0x222e, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0x221f,
+	0x22bf, 0xfffd, 0xfffd, 0xfffd, 0x2756, 0x261e,
+	// plane 1 row 14
+	0x4ff1, 0xd800, 0x3402, 0x4e28, 0x4e2f, 0x4e30, 0x4e8d, 0x4ee1,
+	0x4efd, 0x4eff, 0x4f03, 0x4f0b, 0x4f60, 0x4f48, 0x4f49, 0x4f56,
+	0x4f5f, 0x4f6a, 0x4f6c, 0x4f7e, 0x4f8a, 0x4f94, 0x4f97, 0xfa30,
+	0x4fc9, 0x4fe0, 0x5001, 0x5002, 0x500e, 0x5018, 0x5027, 0x502e,
+	0x5040, 0x503b, 0x5041, 0x5094, 0x50cc, 0x50f2, 0x50d0, 0x50e6,
+	0xfa31, 0x5106, 0x5103, 0x510b, 0x511e, 0x5135, 0x514a, 0xfa32,
+	0x5155, 0x5157, 0x34b5, 0x519d, 0x51c3, 0x51ca, 0x51de, 0x51e2,
+	0x51ee, 0x5201, 0x34db, 0x5213, 0x5215, 0x5249, 0x5257, 0x5261,
+	0x5293, 0x52c8, 0xfa33, 0x52cc, 0x52d0, 0x52d6, 0x52db, 0xfa34,
+	0x52f0, 0x52fb, 0x5300, 0x5307, 0x531c, 0xfa35, 0x5361, 0x5363,
+	0x537d, 0x5393, 0x539d, 0x53b2, 0x5412, 0x5427, 0x544d, 0x549c,
+	0x546b, 0x5474, 0x547f, 0x5488, 0x5496, 0x54a1,
+	// plane 1 row 15
+	0x54a9, 0x54c6, 0x54ff, 0x550e, 0x552b, 0x5535, 0x5550, 0x555e,
+	0x5581, 0x5586, 0x558e, 0xfa36, 0x55ad, 0x55ce, 0xfa37, 0x5608,
+	0x560e, 0x563b, 0x5649, 0x5676, 0x5666, 0xfa38, 0x566f, 0x5671,
+	0x5672, 0x5699, 0x569e, 0x56a9, 0x56ac, 0x56b3, 0x56c9, 0x56ca,
+	0x570a, 0xd801, 0x5721, 0x572f, 0x5733, 0x5734, 0x5770, 0x5777,
+	0x577c, 0x579c, 0xfa0f, 0xd802, 0x57b8, 0x57c7, 0x57c8, 0x57cf,
+	0x57e4, 0x57ed, 0x57f5, 0x57f6, 0x57ff, 0x5809, 0xfa10, 0x5861,
+	0x5864, 0xfa39, 0x587c, 0x5889, 0x589e, 0xfa3a, 0x58a9, 0xd803,
+	0x58d2, 0x58ce, 0x58d4, 0x58da, 0x58e0, 0x58e9, 0x590c, 0x8641,
+	0x595d, 0x596d, 0x598b, 0x5992, 0x59a4, 0x59c3, 0x59d2, 0x59dd,
+	0x5a13, 0x5a23, 0x5a67, 0x5a6d, 0x5a77, 0x5a7e, 0x5a84, 0x5a9e,
+	0x5aa7, 0x5ac4, 0xd804, 0x5b19, 0x5b25, 0x525d,
+	// plane 1 row 16
+	0x4e9c, 0x5516, 0x5a03, 0x963f, 0x54c0, 0x611b, 0x6328, 0x59f6,
+	0x9022, 0x8475, 0x831c, 0x7a50, 0x60aa, 0x63e1, 0x6e25, 0x65ed,
+	0x8466, 0x82a6, 0x9bf5, 0x6893, 0x5727, 0x65a1, 0x6271, 0x5b9b,
+	0x59d0, 0x867b, 0x98f4, 0x7d62, 0x7dbe, 0x9b8e, 0x6216, 0x7c9f,
+	0x88b7, 0x5b89, 0x5eb5, 0x6309, 0x6697, 0x6848, 0x95c7, 0x978d,
+	0x674f, 0x4ee5, 0x4f0a, 0x4f4d, 0x4f9d, 0x5049, 0x56f2, 0x5937,
+	0x59d4, 0x5a01, 0x5c09, 0x60df, 0x610f, 0x6170, 0x6613, 0x6905,
+	0x70ba, 0x754f, 0x7570, 0x79fb, 0x7dad, 0x7def, 0x80c3, 0x840e,
+	0x8863, 0x8b02, 0x9055, 0x907a, 0x533b, 0x4e95, 0x4ea5, 0x57df,
+	0x80b2, 0x90c1, 0x78ef, 0x4e00, 0x58f1, 0x6ea2, 0x9038, 0x7a32,
+	0x8328, 0x828b, 0x9c2f, 0x5141, 0x5370, 0x54bd, 0x54e1, 0x56e0,
+	0x59fb, 0x5f15, 0x98f2, 0x6deb, 0x80e4, 0x852d,
+	// plane 1 row 17
+	0x9662, 0x9670, 0x96a0, 0x97fb, 0x540b, 0x53f3, 0x5b87, 0x70cf,
+	0x7fbd, 0x8fc2, 0x96e8, 0x536f, 0x9d5c, 0x7aba, 0x4e11, 0x7893,
+	0x81fc, 0x6e26, 0x5618, 0x5504, 0x6b1d, 0x851a, 0x9c3b, 0x59e5,
+	0x53a9, 0x6d66, 0x74dc, 0x958f, 0x5642, 0x4e91, 0x904b, 0x96f2,
+	0x834f, 0x990c, 0x53e1, 0x55b6, 0x5b30, 0x5f71, 0x6620, 0x66f3,
+	0x6804, 0x6c38, 0x6cf3, 0x6d29, 0x745b, 0x76c8, 0x7a4e, 0x9834,
+	0x82f1, 0x885b, 0x8a60, 0x92ed, 0x6db2, 0x75ab, 0x76ca, 0x99c5,
+	0x60a6, 0x8b01, 0x8d8a, 0x95b2, 0x698e, 0x53ad, 0x5186, 0x5712,
+	0x5830, 0x5944, 0x5bb4, 0x5ef6, 0x6028, 0x63a9, 0x63f4, 0x6cbf,
+	0x6f14, 0x708e, 0x7114, 0x7159, 0x71d5, 0x733f, 0x7e01, 0x8276,
+	0x82d1, 0x8597, 0x9060, 0x925b, 0x9d1b, 0x5869, 0x65bc, 0x6c5a,
+	0x7525, 0x51f9, 0x592e, 0x5965, 0x5f80, 0x5fdc,
+	// plane 1 row 18
+	0x62bc, 0x65fa, 0x6a2a, 0x6b27, 0x6bb4, 0x738b, 0x7fc1, 0x8956,
+	0x9d2c, 0x9d0e, 0x9ec4, 0x5ca1, 0x6c96, 0x837b, 0x5104, 0x5c4b,
+	0x61b6, 0x81c6, 0x6876, 0x7261, 0x4e59, 0x4ffa, 0x5378, 0x6069,
+	0x6e29, 0x7a4f, 0x97f3, 0x4e0b, 0x5316, 0x4eee, 0x4f55, 0x4f3d,
+	0x4fa1, 0x4f73, 0x52a0, 0x53ef, 0x5609, 0x590f, 0x5ac1, 0x5bb6,
+	0x5be1, 0x79d1, 0x6687, 0x679c, 0x67b6, 0x6b4c, 0x6cb3, 0x706b,
+	0x73c2, 0x798d, 0x79be, 0x7a3c, 0x7b87, 0x82b1, 0x82db, 0x8304,
+	0x8377, 0x83ef, 0x83d3, 0x8766, 0x8ab2, 0x5629, 0x8ca8, 0x8fe6,
+	0x904e, 0x971e, 0x868a, 0x4fc4, 0x5ce8, 0x6211, 0x7259, 0x753b,
+	0x81e5, 0x82bd, 0x86fe, 0x8cc0, 0x96c5, 0x9913, 0x99d5, 0x4ecb,
+	0x4f1a, 0x89e3, 0x56de, 0x584a, 0x58ca, 0x5efb, 0x5feb, 0x602a,
+	0x6094, 0x6062, 0x61d0, 0x6212, 0x62d0, 0x6539,
+	// plane 1 row 19
+	0x9b41, 0x6666, 0x68b0, 0x6d77, 0x7070, 0x754c, 0x7686, 0x7d75,
+	0x82a5, 0x87f9, 0x958b, 0x968e, 0x8c9d, 0x51f1, 0x52be, 0x5916,
+	0x54b3, 0x5bb3, 0x5d16, 0x6168, 0x6982, 0x6daf, 0x788d, 0x84cb,
+	0x8857, 0x8a72, 0x93a7, 0x9ab8, 0x6d6c, 0x99a8, 0x86d9, 0x57a3,
+	0x67ff, 0x86ce, 0x920e, 0x5283, 0x5687, 0x5404, 0x5ed3, 0x62e1,
+	0x64b9, 0x683c, 0x6838, 0x6bbb, 0x7372, 0x78ba, 0x7a6b, 0x899a,
+	0x89d2, 0x8d6b, 0x8f03, 0x90ed, 0x95a3, 0x9694, 0x9769, 0x5b66,
+	0x5cb3, 0x697d, 0x984d, 0x984e, 0x639b, 0x7b20, 0x6a2b, 0x6a7f,
+	0x68b6, 0x9c0d, 0x6f5f, 0x5272, 0x559d, 0x6070, 0x62ec, 0x6d3b,
+	0x6e07, 0x6ed1, 0x845b, 0x8910, 0x8f44, 0x4e14, 0x9c39, 0x53f6,
+	0x691b, 0x6a3a, 0x9784, 0x682a, 0x515c, 0x7ac3, 0x84b2, 0x91dc,
+	0x938c, 0x565b, 0x9d28, 0x6822, 0x8305, 0x8431,
+	// plane 1 row 20
+	0x7ca5, 0x5208, 0x82c5, 0x74e6, 0x4e7e, 0x4f83, 0x51a0, 0x5bd2,
+	0x520a, 0x52d8, 0x52e7, 0x5dfb, 0x559a, 0x582a, 0x59e6, 0x5b8c,
+	0x5b98, 0x5bdb, 0x5e72, 0x5e79, 0x60a3, 0x611f, 0x6163, 0x61be,
+	0x63db, 0x6562, 0x67d1, 0x6853, 0x68fa, 0x6b3e, 0x6b53, 0x6c57,
+	0x6f22, 0x6f97, 0x6f45, 0x74b0, 0x7518, 0x76e3, 0x770b, 0x7aff,
+	0x7ba1, 0x7c21, 0x7de9, 0x7f36, 0x7ff0, 0x809d, 0x8266, 0x839e,
+	0x89b3, 0x8acc, 0x8cab, 0x9084, 0x9451, 0x9593, 0x9591, 0x95a2,
+	0x9665, 0x97d3, 0x9928, 0x8218, 0x4e38, 0x542b, 0x5cb8, 0x5dcc,
+	0x73a9, 0x764c, 0x773c, 0x5ca9, 0x7feb, 0x8d0b, 0x96c1, 0x9811,
+	0x9854, 0x9858, 0x4f01, 0x4f0e, 0x5371, 0x559c, 0x5668, 0x57fa,
+	0x5947, 0x5b09, 0x5bc4, 0x5c90, 0x5e0c, 0x5e7e, 0x5fcc, 0x63ee,
+	0x673a, 0x65d7, 0x65e2, 0x671f, 0x68cb, 0x68c4,
+	// plane 1 row 21
+	0x6a5f, 0x5e30, 0x6bc5, 0x6c17, 0x6c7d, 0x757f, 0x7948, 0x5b63,
+	0x7a00, 0x7d00, 0x5fbd, 0x898f, 0x8a18, 0x8cb4, 0x8d77, 0x8ecc,
+	0x8f1d, 0x98e2, 0x9a0e, 0x9b3c, 0x4e80, 0x507d, 0x5100, 0x5993,
+	0x5b9c, 0x622f, 0x6280, 0x64ec, 0x6b3a, 0x72a0, 0x7591, 0x7947,
+	0x7fa9, 0x87fb, 0x8abc, 0x8b70, 0x63ac, 0x83ca, 0x97a0, 0x5409,
+	0x5403, 0x55ab, 0x6854, 0x6a58, 0x8a70, 0x7827, 0x6775, 0x9ecd,
+	0x5374, 0x5ba2, 0x811a, 0x8650, 0x9006, 0x4e18, 0x4e45, 0x4ec7,
+	0x4f11, 0x53ca, 0x5438, 0x5bae, 0x5f13, 0x6025, 0x6551, 0x673d,
+	0x6c42, 0x6c72, 0x6ce3, 0x7078, 0x7403, 0x7a76, 0x7aae, 0x7b08,
+	0x7d1a, 0x7cfe, 0x7d66, 0x65e7, 0x725b, 0x53bb, 0x5c45, 0x5de8,
+	0x62d2, 0x62e0, 0x6319, 0x6e20, 0x865a, 0x8a31, 0x8ddd, 0x92f8,
+	0x6f01, 0x79a6, 0x9b5a, 0x4ea8, 0x4eab, 0x4eac,
+	// plane 1 row 22
+	0x4f9b, 0x4fa0, 0x50d1, 0x5147, 0x7af6, 0x5171, 0x51f6, 0x5354,
+	0x5321, 0x537f, 0x53eb, 0x55ac, 0x5883, 0x5ce1, 0x5f37, 0x5f4a,
+	0x602f, 0x6050, 0x606d, 0x631f, 0x6559, 0x6a4b, 0x6cc1, 0x72c2,
+	0x72ed, 0x77ef, 0x80f8, 0x8105, 0x8208, 0x854e, 0x90f7, 0x93e1,
+	0x97ff, 0x9957, 0x9a5a, 0x4ef0, 0x51dd, 0x5c2d, 0x6681, 0x696d,
+	0x5c40, 0x66f2, 0x6975, 0x7389, 0x6850, 0x7c81, 0x50c5, 0x52e4,
+	0x5747, 0x5dfe, 0x9326, 0x65a4, 0x6b23, 0x6b3d, 0x7434, 0x7981,
+	0x79bd, 0x7b4b, 0x7dca, 0x82b9, 0x83cc, 0x887f, 0x895f, 0x8b39,
+	0x8fd1, 0x91d1, 0x541f, 0x9280, 0x4e5d, 0x5036, 0x53e5, 0x533a,
+	0x72d7, 0x7396, 0x77e9, 0x82e6, 0x8eaf, 0x99c6, 0x99c8, 0x99d2,
+	0x5177, 0x611a, 0x865e, 0x55b0, 0x7a7a, 0x5076, 0x5bd3, 0x9047,
+	0x9685, 0x4e32, 0x6adb, 0x91e7, 0x5c51, 0x5c48,
+	// plane 1 row 23
+	0x6398, 0x7a9f, 0x6c93, 0x9774, 0x8f61, 0x7aaa, 0x718a, 0x9688,
+	0x7c82, 0x6817, 0x7e70, 0x6851, 0x936c, 0x52f2, 0x541b, 0x85ab,
+	0x8a13, 0x7fa4, 0x8ecd, 0x90e1, 0x5366, 0x8888, 0x7941, 0x4fc2,
+	0x50be, 0x5211, 0x5144, 0x5553, 0x572d, 0x73ea, 0x578b, 0x5951,
+	0x5f62, 0x5f84, 0x6075, 0x6176, 0x6167, 0x61a9, 0x63b2, 0x643a,
+	0x656c, 0x666f, 0x6842, 0x6e13, 0x7566, 0x7a3d, 0x7cfb, 0x7d4c,
+	0x7d99, 0x7e4b, 0x7f6b, 0x830e, 0x834a, 0x86cd, 0x8a08, 0x8a63,
+	0x8b66, 0x8efd, 0x981a, 0x9d8f, 0x82b8, 0x8fce, 0x9be8, 0x5287,
+	0x621f, 0x6483, 0x6fc0, 0x9699, 0x6841, 0x5091, 0x6b20, 0x6c7a,
+	0x6f54, 0x7a74, 0x7d50, 0x8840, 0x8a23, 0x6708, 0x4ef6, 0x5039,
+	0x5026, 0x5065, 0x517c, 0x5238, 0x5263, 0x55a7, 0x570f, 0x5805,
+	0x5acc, 0x5efa, 0x61b2, 0x61f8, 0x62f3, 0x6372,
+	// plane 1 row 24
+	0x691c, 0x6a29, 0x727d, 0x72ac, 0x732e, 0x7814, 0x786f, 0x7d79,
+	0x770c, 0x80a9, 0x898b, 0x8b19, 0x8ce2, 0x8ed2, 0x9063, 0x9375,
+	0x967a, 0x9855, 0x9a13, 0x9e78, 0x5143, 0x539f, 0x53b3, 0x5e7b,
+	0x5f26, 0x6e1b, 0x6e90, 0x7384, 0x73fe, 0x7d43, 0x8237, 0x8a00,
+	0x8afa, 0x9650, 0x4e4e, 0x500b, 0x53e4, 0x547c, 0x56fa, 0x59d1,
+	0x5b64, 0x5df1, 0x5eab, 0x5f27, 0x6238, 0x6545, 0x67af, 0x6e56,
+	0x72d0, 0x7cca, 0x88b4, 0x80a1, 0x80e1, 0x83f0, 0x864e, 0x8a87,
+	0x8de8, 0x9237, 0x96c7, 0x9867, 0x9f13, 0x4e94, 0x4e92, 0x4f0d,
+	0x5348, 0x5449, 0x543e, 0x5a2f, 0x5f8c, 0x5fa1, 0x609f, 0x68a7,
+	0x6a8e, 0x745a, 0x7881, 0x8a9e, 0x8aa4, 0x8b77, 0x9190, 0x4e5e,
+	0x9bc9, 0x4ea4, 0x4f7c, 0x4faf, 0x5019, 0x5016, 0x5149, 0x516c,
+	0x529f, 0x52b9, 0x52fe, 0x539a, 0x53e3, 0x5411,
+	// plane 1 row 25
+	0x540e, 0x5589, 0x5751, 0x57a2, 0x597d, 0x5b54, 0x5b5d, 0x5b8f,
+	0x5de5, 0x5de7, 0x5df7, 0x5e78, 0x5e83, 0x5e9a, 0x5eb7, 0x5f18,
+	0x6052, 0x614c, 0x6297, 0x62d8, 0x63a7, 0x653b, 0x6602, 0x6643,
+	0x66f4, 0x676d, 0x6821, 0x6897, 0x69cb, 0x6c5f, 0x6d2a, 0x6d69,
+	0x6e2f, 0x6e9d, 0x7532, 0x7687, 0x786c, 0x7a3f, 0x7ce0, 0x7d05,
+	0x7d18, 0x7d5e, 0x7db1, 0x8015, 0x8003, 0x80af, 0x80b1, 0x8154,
+	0x818f, 0x822a, 0x8352, 0x884c, 0x8861, 0x8b1b, 0x8ca2, 0x8cfc,
+	0x90ca, 0x9175, 0x9271, 0x783f, 0x92fc, 0x95a4, 0x964d, 0x9805,
+	0x9999, 0x9ad8, 0x9d3b, 0x525b, 0x52ab, 0x53f7, 0x5408, 0x58d5,
+	0x62f7, 0x6fe0, 0x8c6a, 0x8f5f, 0x9eb9, 0x514b, 0x523b, 0x544a,
+	0x56fd, 0x7a40, 0x9177, 0x9d60, 0x9ed2, 0x7344, 0x6f09, 0x8170,
+	0x7511, 0x5ffd, 0x60da, 0x9aa8, 0x72db, 0x8fbc,
+	// plane 1 row 26
+	0x6b64, 0x9803, 0x4eca, 0x56f0, 0x5764, 0x58be, 0x5a5a, 0x6068,
+	0x61c7, 0x660f, 0x6606, 0x6839, 0x68b1, 0x6df7, 0x75d5, 0x7d3a,
+	0x826e, 0x9b42, 0x4e9b, 0x4f50, 0x53c9, 0x5506, 0x5d6f, 0x5de6,
+	0x5dee, 0x67fb, 0x6c99, 0x7473, 0x7802, 0x8a50, 0x9396, 0x88df,
+	0x5750, 0x5ea7, 0x632b, 0x50b5, 0x50ac, 0x518d, 0x6700, 0x54c9,
+	0x585e, 0x59bb, 0x5bb0, 0x5f69, 0x624d, 0x63a1, 0x683d, 0x6b73,
+	0x6e08, 0x707d, 0x91c7, 0x7280, 0x7815, 0x7826, 0x796d, 0x658e,
+	0x7d30, 0x83dc, 0x88c1, 0x8f09, 0x969b, 0x5264, 0x5728, 0x6750,
+	0x7f6a, 0x8ca1, 0x51b4, 0x5742, 0x962a, 0x583a, 0x698a, 0x80b4,
+	0x54b2, 0x5d0e, 0x57fc, 0x7895, 0x9dfa, 0x4f5c, 0x524a, 0x548b,
+	0x643e, 0x6628, 0x6714, 0x67f5, 0x7a84, 0x7b56, 0x7d22, 0x932f,
+	0x685c, 0x9bad, 0x7b39, 0x5319, 0x518a, 0x5237,
+	// plane 1 row 27
+	0x5bdf, 0x62f6, 0x64ae, 0x64e6, 0x672d, 0x6bba, 0x85a9, 0x96d1,
+	0x7690, 0x9bd6, 0x634c, 0x9306, 0x9bab, 0x76bf, 0x6652, 0x4e09,
+	0x5098, 0x53c2, 0x5c71, 0x60e8, 0x6492, 0x6563, 0x685f, 0x71e6,
+	0x73ca, 0x7523, 0x7b97, 0x7e82, 0x8695, 0x8b83, 0x8cdb, 0x9178,
+	0x9910, 0x65ac, 0x66ab, 0x6b8b, 0x4ed5, 0x4ed4, 0x4f3a, 0x4f7f,
+	0x523a, 0x53f8, 0x53f2, 0x55e3, 0x56db, 0x58eb, 0x59cb, 0x59c9,
+	0x59ff, 0x5b50, 0x5c4d, 0x5e02, 0x5e2b, 0x5fd7, 0x601d, 0x6307,
+	0x652f, 0x5b5c, 0x65af, 0x65bd, 0x65e8, 0x679d, 0x6b62, 0x6b7b,
+	0x6c0f, 0x7345, 0x7949, 0x79c1, 0x7cf8, 0x7d19, 0x7d2b, 0x80a2,
+	0x8102, 0x81f3, 0x8996, 0x8a5e, 0x8a69, 0x8a66, 0x8a8c, 0x8aee,
+	0x8cc7, 0x8cdc, 0x96cc, 0x98fc, 0x6b6f, 0x4e8b, 0x4f3c, 0x4f8d,
+	0x5150, 0x5b57, 0x5bfa, 0x6148, 0x6301, 0x6642,
+	// plane 1 row 28
+	0x6b21, 0x6ecb, 0x6cbb, 0x723e, 0x74bd, 0x75d4, 0x78c1, 0x793a,
+	0x800c, 0x8033, 0x81ea, 0x8494, 0x8f9e, 0x6c50, 0x9e7f, 0x5f0f,
+	0x8b58, 0x9d2b, 0x7afa, 0x8ef8, 0x5b8d, 0x96eb, 0x4e03, 0x53f1,
+	0x57f7, 0x5931, 0x5ac9, 0x5ba4, 0x6089, 0x6e7f, 0x6f06, 0x75be,
+	0x8cea, 0x5b9f, 0x8500, 0x7be0, 0x5072, 0x67f4, 0x829d, 0x5c61,
+	0x854a, 0x7e1e, 0x820e, 0x5199, 0x5c04, 0x6368, 0x8d66, 0x659c,
+	0x716e, 0x793e, 0x7d17, 0x8005, 0x8b1d, 0x8eca, 0x906e, 0x86c7,
+	0x90aa, 0x501f, 0x52fa, 0x5c3a, 0x6753, 0x707c, 0x7235, 0x914c,
+	0x91c8, 0x932b, 0x82e5, 0x5bc2, 0x5f31, 0x60f9, 0x4e3b, 0x53d6,
+	0x5b88, 0x624b, 0x6731, 0x6b8a, 0x72e9, 0x73e0, 0x7a2e, 0x816b,
+	0x8da3, 0x9152, 0x9996, 0x5112, 0x53d7, 0x546a, 0x5bff, 0x6388,
+	0x6a39, 0x7dac, 0x9700, 0x56da, 0x53ce, 0x5468,
+	// plane 1 row 29
+	0x5b97, 0x5c31, 0x5dde, 0x4fee, 0x6101, 0x62fe, 0x6d32, 0x79c0,
+	0x79cb, 0x7d42, 0x7e4d, 0x7fd2, 0x81ed, 0x821f, 0x8490, 0x8846,
+	0x8972, 0x8b90, 0x8e74, 0x8f2f, 0x9031, 0x914b, 0x916c, 0x96c6,
+	0x919c, 0x4ec0, 0x4f4f, 0x5145, 0x5341, 0x5f93, 0x620e, 0x67d4,
+	0x6c41, 0x6e0b, 0x7363, 0x7e26, 0x91cd, 0x9283, 0x53d4, 0x5919,
+	0x5bbf, 0x6dd1, 0x795d, 0x7e2e, 0x7c9b, 0x587e, 0x719f, 0x51fa,
+	0x8853, 0x8ff0, 0x4fca, 0x5cfb, 0x6625, 0x77ac, 0x7ae3, 0x821c,
+	0x99ff, 0x51c6, 0x5faa, 0x65ec, 0x696f, 0x6b89, 0x6df3, 0x6e96,
+	0x6f64, 0x76fe, 0x7d14, 0x5de1, 0x9075, 0x9187, 0x9806, 0x51e6,
+	0x521d, 0x6240, 0x6691, 0x66d9, 0x6e1a, 0x5eb6, 0x7dd2, 0x7f72,
+	0x66f8, 0x85af, 0x85f7, 0x8af8, 0x52a9, 0x53d9, 0x5973, 0x5e8f,
+	0x5f90, 0x6055, 0x92e4, 0x9664, 0x50b7, 0x511f,
+	// plane 1 row 30
+	0x52dd, 0x5320, 0x5347, 0x53ec, 0x54e8, 0x5546, 0x5531, 0x5617,
+	0x5968, 0x59be, 0x5a3c, 0x5bb5, 0x5c06, 0x5c0f, 0x5c11, 0x5c1a,
+	0x5e84, 0x5e8a, 0x5ee0, 0x5f70, 0x627f, 0x6284, 0x62db, 0x638c,
+	0x6377, 0x6607, 0x660c, 0x662d, 0x6676, 0x677e, 0x68a2, 0x6a1f,
+	0x6a35, 0x6cbc, 0x6d88, 0x6e09, 0x6e58, 0x713c, 0x7126, 0x7167,
+	0x75c7, 0x7701, 0x785d, 0x7901, 0x7965, 0x79f0, 0x7ae0, 0x7b11,
+	0x7ca7, 0x7d39, 0x8096, 0x83d6, 0x848b, 0x8549, 0x885d, 0x88f3,
+	0x8a1f, 0x8a3c, 0x8a54, 0x8a73, 0x8c61, 0x8cde, 0x91a4, 0x9266,
+	0x937e, 0x9418, 0x969c, 0x9798, 0x4e0a, 0x4e08, 0x4e1e, 0x4e57,
+	0x5197, 0x5270, 0x57ce, 0x5834, 0x58cc, 0x5b22, 0x5e38, 0x60c5,
+	0x64fe, 0x6761, 0x6756, 0x6d44, 0x72b6, 0x7573, 0x7a63, 0x84b8,
+	0x8b72, 0x91b8, 0x9320, 0x5631, 0x57f4, 0x98fe,
+	// plane 1 row 31
+	0x62ed, 0x690d, 0x6b96, 0x71ed, 0x7e54, 0x8077, 0x8272, 0x89e6,
+	0x98df, 0x8755, 0x8fb1, 0x5c3b, 0x4f38, 0x4fe1, 0x4fb5, 0x5507,
+	0x5a20, 0x5bdd, 0x5be9, 0x5fc3, 0x614e, 0x632f, 0x65b0, 0x664b,
+	0x68ee, 0x699b, 0x6d78, 0x6df1, 0x7533, 0x75b9, 0x771f, 0x795e,
+	0x79e6, 0x7d33, 0x81e3, 0x82af, 0x85aa, 0x89aa, 0x8a3a, 0x8eab,
+	0x8f9b, 0x9032, 0x91dd, 0x9707, 0x4eba, 0x4ec1, 0x5203, 0x5875,
+	0x58ec, 0x5c0b, 0x751a, 0x5c3d, 0x814e, 0x8a0a, 0x8fc5, 0x9663,
+	0x976d, 0x7b25, 0x8acf, 0x9808, 0x9162, 0x56f3, 0x53a8, 0x9017,
+	0x5439, 0x5782, 0x5e25, 0x63a8, 0x6c34, 0x708a, 0x7761, 0x7c8b,
+	0x7fe0, 0x8870, 0x9042, 0x9154, 0x9310, 0x9318, 0x968f, 0x745e,
+	0x9ac4, 0x5d07, 0x5d69, 0x6570, 0x67a2, 0x8da8, 0x96db, 0x636e,
+	0x6749, 0x6919, 0x83c5, 0x9817, 0x96c0, 0x88fe,
+	// plane 1 row 32
+	0x6f84, 0x647a, 0x5bf8, 0x4e16, 0x702c, 0x755d, 0x662f, 0x51c4,
+	0x5236, 0x52e2, 0x59d3, 0x5f81, 0x6027, 0x6210, 0x653f, 0x6574,
+	0x661f, 0x6674, 0x68f2, 0x6816, 0x6b63, 0x6e05, 0x7272, 0x751f,
+	0x76db, 0x7cbe, 0x8056, 0x58f0, 0x88fd, 0x897f, 0x8aa0, 0x8a93,
+	0x8acb, 0x901d, 0x9192, 0x9752, 0x9759, 0x6589, 0x7a0e, 0x8106,
+	0x96bb, 0x5e2d, 0x60dc, 0x621a, 0x65a5, 0x6614, 0x6790, 0x77f3,
+	0x7a4d, 0x7c4d, 0x7e3e, 0x810a, 0x8cac, 0x8d64, 0x8de1, 0x8e5f,
+	0x78a9, 0x5207, 0x62d9, 0x63a5, 0x6442, 0x6298, 0x8a2d, 0x7a83,
+	0x7bc0, 0x8aac, 0x96ea, 0x7d76, 0x820c, 0x8749, 0x4ed9, 0x5148,
+	0x5343, 0x5360, 0x5ba3, 0x5c02, 0x5c16, 0x5ddd, 0x6226, 0x6247,
+	0x64b0, 0x6813, 0x6834, 0x6cc9, 0x6d45, 0x6d17, 0x67d3, 0x6f5c,
+	0x714e, 0x717d, 0x65cb, 0x7a7f, 0x7bad, 0x7dda,
+	// plane 1 row 33
+	0x7e4a, 0x7fa8, 0x817a, 0x821b, 0x8239, 0x85a6, 0x8a6e, 0x8cce,
+	0x8df5, 0x9078, 0x9077, 0x92ad, 0x9291, 0x9583, 0x9bae, 0x524d,
+	0x5584, 0x6f38, 0x7136, 0x5168, 0x7985, 0x7e55, 0x81b3, 0x7cce,
+	0x564c, 0x5851, 0x5ca8, 0x63aa, 0x66fe, 0x66fd, 0x695a, 0x72d9,
+	0x758f, 0x758e, 0x790e, 0x7956, 0x79df, 0x7c97, 0x7d20, 0x7d44,
+	0x8607, 0x8a34, 0x963b, 0x9061, 0x9f20, 0x50e7, 0x5275, 0x53cc,
+	0x53e2, 0x5009, 0x55aa, 0x58ee, 0x594f, 0x723d, 0x5b8b, 0x5c64,
+	0x531d, 0x60e3, 0x60f3, 0x635c, 0x6383, 0x633f, 0x63bb, 0x64cd,
+	0x65e9, 0x66f9, 0x5de3, 0x69cd, 0x69fd, 0x6f15, 0x71e5, 0x4e89,
+	0x75e9, 0x76f8, 0x7a93, 0x7cdf, 0x7dcf, 0x7d9c, 0x8061, 0x8349,
+	0x8358, 0x846c, 0x84bc, 0x85fb, 0x88c5, 0x8d70, 0x9001, 0x906d,
+	0x9397, 0x971c, 0x9a12, 0x50cf, 0x5897, 0x618e,
+	// plane 1 row 34
+	0x81d3, 0x8535, 0x8d08, 0x9020, 0x4fc3, 0x5074, 0x5247, 0x5373,
+	0x606f, 0x6349, 0x675f, 0x6e2c, 0x8db3, 0x901f, 0x4fd7, 0x5c5e,
+	0x8cca, 0x65cf, 0x7d9a, 0x5352, 0x8896, 0x5176, 0x63c3, 0x5b58,
+	0x5b6b, 0x5c0a, 0x640d, 0x6751, 0x905c, 0x4ed6, 0x591a, 0x592a,
+	0x6c70, 0x8a51, 0x553e, 0x5815, 0x59a5, 0x60f0, 0x6253, 0x67c1,
+	0x8235, 0x6955, 0x9640, 0x99c4, 0x9a28, 0x4f53, 0x5806, 0x5bfe,
+	0x8010, 0x5cb1, 0x5e2f, 0x5f85, 0x6020, 0x614b, 0x6234, 0x66ff,
+	0x6cf0, 0x6ede, 0x80ce, 0x817f, 0x82d4, 0x888b, 0x8cb8, 0x9000,
+	0x902e, 0x968a, 0x9edb, 0x9bdb, 0x4ee3, 0x53f0, 0x5927, 0x7b2c,
+	0x918d, 0x984c, 0x9df9, 0x6edd, 0x7027, 0x5353, 0x5544, 0x5b85,
+	0x6258, 0x629e, 0x62d3, 0x6ca2, 0x6fef, 0x7422, 0x8a17, 0x9438,
+	0x6fc1, 0x8afe, 0x8338, 0x51e7, 0x86f8, 0x53ea,
+	// plane 1 row 35
+	0x53e9, 0x4f46, 0x9054, 0x8fb0, 0x596a, 0x8131, 0x5dfd, 0x7aea,
+	0x8fbf, 0x68da, 0x8c37, 0x72f8, 0x9c48, 0x6a3d, 0x8ab0, 0x4e39,
+	0x5358, 0x5606, 0x5766, 0x62c5, 0x63a2, 0x65e6, 0x6b4e, 0x6de1,
+	0x6e5b, 0x70ad, 0x77ed, 0x7aef, 0x7baa, 0x7dbb, 0x803d, 0x80c6,
+	0x86cb, 0x8a95, 0x935b, 0x56e3, 0x58c7, 0x5f3e, 0x65ad, 0x6696,
+	0x6a80, 0x6bb5, 0x7537, 0x8ac7, 0x5024, 0x77e5, 0x5730, 0x5f1b,
+	0x6065, 0x667a, 0x6c60, 0x75f4, 0x7a1a, 0x7f6e, 0x81f4, 0x8718,
+	0x9045, 0x99b3, 0x7bc9, 0x755c, 0x7af9, 0x7b51, 0x84c4, 0x9010,
+	0x79e9, 0x7a92, 0x8336, 0x5ae1, 0x7740, 0x4e2d, 0x4ef2, 0x5b99,
+	0x5fe0, 0x62bd, 0x663c, 0x67f1, 0x6ce8, 0x866b, 0x8877, 0x8a3b,
+	0x914e, 0x92f3, 0x99d0, 0x6a17, 0x7026, 0x732a, 0x82e7, 0x8457,
+	0x8caf, 0x4e01, 0x5146, 0x51cb, 0x558b, 0x5bf5,
+	// plane 1 row 36
+	0x5e16, 0x5e33, 0x5e81, 0x5f14, 0x5f35, 0x5f6b, 0x5fb4, 0x61f2,
+	0x6311, 0x66a2, 0x671d, 0x6f6e, 0x7252, 0x753a, 0x773a, 0x8074,
+	0x8139, 0x8178, 0x8776, 0x8abf, 0x8adc, 0x8d85, 0x8df3, 0x929a,
+	0x9577, 0x9802, 0x9ce5, 0x52c5, 0x6357, 0x76f4, 0x6715, 0x6c88,
+	0x73cd, 0x8cc3, 0x93ae, 0x9673, 0x6d25, 0x589c, 0x690e, 0x69cc,
+	0x8ffd, 0x939a, 0x75db, 0x901a, 0x585a, 0x6802, 0x63b4, 0x69fb,
+	0x4f43, 0x6f2c, 0x67d8, 0x8fbb, 0x8526, 0x7db4, 0x9354, 0x693f,
+	0x6f70, 0x576a, 0x58f7, 0x5b2c, 0x7d2c, 0x722a, 0x540a, 0x91e3,
+	0x9db4, 0x4ead, 0x4f4e, 0x505c, 0x5075, 0x5243, 0x8c9e, 0x5448,
+	0x5824, 0x5b9a, 0x5e1d, 0x5e95, 0x5ead, 0x5ef7, 0x5f1f, 0x608c,
+	0x62b5, 0x633a, 0x63d0, 0x68af, 0x6c40, 0x7887, 0x798e, 0x7a0b,
+	0x7de0, 0x8247, 0x8a02, 0x8ae6, 0x8e44, 0x9013,
+	// plane 1 row 37
+	0x90b8, 0x912d, 0x91d8, 0x9f0e, 0x6ce5, 0x6458, 0x64e2, 0x6575,
+	0x6ef4, 0x7684, 0x7b1b, 0x9069, 0x93d1, 0x6eba, 0x54f2, 0x5fb9,
+	0x64a4, 0x8f4d, 0x8fed, 0x9244, 0x5178, 0x586b, 0x5929, 0x5c55,
+	0x5e97, 0x6dfb, 0x7e8f, 0x751c, 0x8cbc, 0x8ee2, 0x985b, 0x70b9,
+	0x4f1d, 0x6bbf, 0x6fb1, 0x7530, 0x96fb, 0x514e, 0x5410, 0x5835,
+	0x5857, 0x59ac, 0x5c60, 0x5f92, 0x6597, 0x675c, 0x6e21, 0x767b,
+	0x83df, 0x8ced, 0x9014, 0x90fd, 0x934d, 0x7825, 0x783a, 0x52aa,
+	0x5ea6, 0x571f, 0x5974, 0x6012, 0x5012, 0x515a, 0x51ac, 0x51cd,
+	0x5200, 0x5510, 0x5854, 0x5858, 0x5957, 0x5b95, 0x5cf6, 0x5d8b,
+	0x60bc, 0x6295, 0x642d, 0x6771, 0x6843, 0x68bc, 0x68df, 0x76d7,
+	0x6dd8, 0x6e6f, 0x6d9b, 0x706f, 0x71c8, 0x5f53, 0x75d8, 0x7977,
+	0x7b49, 0x7b54, 0x7b52, 0x7cd6, 0x7d71, 0x5230,
+	// plane 1 row 38
+	0x8463, 0x8569, 0x85e4, 0x8a0e, 0x8b04, 0x8c46, 0x8e0f, 0x9003,
+	0x900f, 0x9419, 0x9676, 0x982d, 0x9a30, 0x95d8, 0x50cd, 0x52d5,
+	0x540c, 0x5802, 0x5c0e, 0x61a7, 0x649e, 0x6d1e, 0x77b3, 0x7ae5,
+	0x80f4, 0x8404, 0x9053, 0x9285, 0x5ce0, 0x9d07, 0x533f, 0x5f97,
+	0x5fb3, 0x6d9c, 0x7279, 0x7763, 0x79bf, 0x7be4, 0x6bd2, 0x72ec,
+	0x8aad, 0x6803, 0x6a61, 0x51f8, 0x7a81, 0x6934, 0x5c4a, 0x9cf6,
+	0x82eb, 0x5bc5, 0x9149, 0x701e, 0x5678, 0x5c6f, 0x60c7, 0x6566,
+	0x6c8c, 0x8c5a, 0x9041, 0x9813, 0x5451, 0x66c7, 0x920d, 0x5948,
+	0x90a3, 0x5185, 0x4e4d, 0x51ea, 0x8599, 0x8b0e, 0x7058, 0x637a,
+	0x934b, 0x6962, 0x99b4, 0x7e04, 0x7577, 0x5357, 0x6960, 0x8edf,
+	0x96e3, 0x6c5d, 0x4e8c, 0x5c3c, 0x5f10, 0x8fe9, 0x5302, 0x8cd1,
+	0x8089, 0x8679, 0x5eff, 0x65e5, 0x4e73, 0x5165,
+	// plane 1 row 39
+	0x5982, 0x5c3f, 0x97ee, 0x4efb, 0x598a, 0x5fcd, 0x8a8d, 0x6fe1,
+	0x79b0, 0x7962, 0x5be7, 0x8471, 0x732b, 0x71b1, 0x5e74, 0x5ff5,
+	0x637b, 0x649a, 0x71c3, 0x7c98, 0x4e43, 0x5efc, 0x4e4b, 0x57dc,
+	0x56a2, 0x60a9, 0x6fc3, 0x7d0d, 0x80fd, 0x8133, 0x81bf, 0x8fb2,
+	0x8997, 0x86a4, 0x5df4, 0x628a, 0x64ad, 0x8987, 0x6777, 0x6ce2,
+	0x6d3e, 0x7436, 0x7834, 0x5a46, 0x7f75, 0x82ad, 0x99ac, 0x4ff3,
+	0x5ec3, 0x62dd, 0x6392, 0x6557, 0x676f, 0x76c3, 0x724c, 0x80cc,
+	0x80ba, 0x8f29, 0x914d, 0x500d, 0x57f9, 0x5a92, 0x6885, 0x6973,
+	0x7164, 0x72fd, 0x8cb7, 0x58f2, 0x8ce0, 0x966a, 0x9019, 0x877f,
+	0x79e4, 0x77e7, 0x8429, 0x4f2f, 0x5265, 0x535a, 0x62cd, 0x67cf,
+	0x6cca, 0x767d, 0x7b94, 0x7c95, 0x8236, 0x8584, 0x8feb, 0x66dd,
+	0x6f20, 0x7206, 0x7e1b, 0x83ab, 0x99c1, 0x9ea6,
+	// plane 1 row 40
+	0x51fd, 0x7bb1, 0x7872, 0x7bb8, 0x8087, 0x7b48, 0x6ae8, 0x5e61,
+	0x808c, 0x7551, 0x7560, 0x516b, 0x9262, 0x6e8c, 0x767a, 0x9197,
+	0x9aea, 0x4f10, 0x7f70, 0x629c, 0x7b4f, 0x95a5, 0x9ce9, 0x567a,
+	0x5859, 0x86e4, 0x96bc, 0x4f34, 0x5224, 0x534a, 0x53cd, 0x53db,
+	0x5e06, 0x642c, 0x6591, 0x677f, 0x6c3e, 0x6c4e, 0x7248, 0x72af,
+	0x73ed, 0x7554, 0x7e41, 0x822c, 0x85e9, 0x8ca9, 0x7bc4, 0x91c6,
+	0x7169, 0x9812, 0x98ef, 0x633d, 0x6669, 0x756a, 0x76e4, 0x78d0,
+	0x8543, 0x86ee, 0x532a, 0x5351, 0x5426, 0x5983, 0x5e87, 0x5f7c,
+	0x60b2, 0x6249, 0x6279, 0x62ab, 0x6590, 0x6bd4, 0x6ccc, 0x75b2,
+	0x76ae, 0x7891, 0x79d8, 0x7dcb, 0x7f77, 0x80a5, 0x88ab, 0x8ab9,
+	0x8cbb, 0x907f, 0x975e, 0x98db, 0x6a0b, 0x7c38, 0x5099, 0x5c3e,
+	0x5fae, 0x6787, 0x6bd8, 0x7435, 0x7709, 0x7f8e,
+	// plane 1 row 41
+	0x9f3b, 0x67ca, 0x7a17, 0x5339, 0x758b, 0x9aed, 0x5f66, 0x819d,
+	0x83f1, 0x8098, 0x5f3c, 0x5fc5, 0x7562, 0x7b46, 0x903c, 0x6867,
+	0x59eb, 0x5a9b, 0x7d10, 0x767e, 0x8b2c, 0x4ff5, 0x5f6a, 0x6a19,
+	0x6c37, 0x6f02, 0x74e2, 0x7968, 0x8868, 0x8a55, 0x8c79, 0x5edf,
+	0x63cf, 0x75c5, 0x79d2, 0x82d7, 0x9328, 0x92f2, 0x849c, 0x86ed,
+	0x9c2d, 0x54c1, 0x5f6c, 0x658c, 0x6d5c, 0x7015, 0x8ca7, 0x8cd3,
+	0x983b, 0x654f, 0x74f6, 0x4e0d, 0x4ed8, 0x57e0, 0x592b, 0x5a66,
+	0x5bcc, 0x51a8, 0x5e03, 0x5e9c, 0x6016, 0x6276, 0x6577, 0x65a7,
+	0x666e, 0x6d6e, 0x7236, 0x7b26, 0x8150, 0x819a, 0x8299, 0x8b5c,
+	0x8ca0, 0x8ce6, 0x8d74, 0x961c, 0x9644, 0x4fae, 0x64ab, 0x6b66,
+	0x821e, 0x8461, 0x856a, 0x90e8, 0x5c01, 0x6953, 0x98a8, 0x847a,
+	0x8557, 0x4f0f, 0x526f, 0x5fa9, 0x5e45, 0x670d,
+	// plane 1 row 42
+	0x798f, 0x8179, 0x8907, 0x8986, 0x6df5, 0x5f17, 0x6255, 0x6cb8,
+	0x4ecf, 0x7269, 0x9b92, 0x5206, 0x543b, 0x5674, 0x58b3, 0x61a4,
+	0x626e, 0x711a, 0x596e, 0x7c89, 0x7cde, 0x7d1b, 0x96f0, 0x6587,
+	0x805e, 0x4e19, 0x4f75, 0x5175, 0x5840, 0x5e63, 0x5e73, 0x5f0a,
+	0x67c4, 0x4e26, 0x853d, 0x9589, 0x965b, 0x7c73, 0x9801, 0x50fb,
+	0x58c1, 0x7656, 0x78a7, 0x5225, 0x77a5, 0x8511, 0x7b86, 0x504f,
+	0x5909, 0x7247, 0x7bc7, 0x7de8, 0x8fba, 0x8fd4, 0x904d, 0x4fbf,
+	0x52c9, 0x5a29, 0x5f01, 0x97ad, 0x4fdd, 0x8217, 0x92ea, 0x5703,
+	0x6355, 0x6b69, 0x752b, 0x88dc, 0x8f14, 0x7a42, 0x52df, 0x5893,
+	0x6155, 0x620a, 0x66ae, 0x6bcd, 0x7c3f, 0x83e9, 0x5023, 0x4ff8,
+	0x5305, 0x5446, 0x5831, 0x5949, 0x5b9d, 0x5cf0, 0x5cef, 0x5d29,
+	0x5e96, 0x62b1, 0x6367, 0x653e, 0x65b9, 0x670b,
+	// plane 1 row 43
+	0x6cd5, 0x6ce1, 0x70f9, 0x7832, 0x7e2b, 0x80de, 0x82b3, 0x840c,
+	0x84ec, 0x8702, 0x8912, 0x8a2a, 0x8c4a, 0x90a6, 0x92d2, 0x98fd,
+	0x9cf3, 0x9d6c, 0x4e4f, 0x4ea1, 0x508d, 0x5256, 0x574a, 0x59a8,
+	0x5e3d, 0x5fd8, 0x5fd9, 0x623f, 0x66b4, 0x671b, 0x67d0, 0x68d2,
+	0x5192, 0x7d21, 0x80aa, 0x81a8, 0x8b00, 0x8c8c, 0x8cbf, 0x927e,
+	0x9632, 0x5420, 0x982c, 0x5317, 0x50d5, 0x535c, 0x58a8, 0x64b2,
+	0x6734, 0x7267, 0x7766, 0x7a46, 0x91e6, 0x52c3, 0x6ca1, 0x6b86,
+	0x5800, 0x5e4c, 0x5954, 0x672c, 0x7ffb, 0x51e1, 0x76c6, 0x6469,
+	0x78e8, 0x9b54, 0x9ebb, 0x57cb, 0x59b9, 0x6627, 0x679a, 0x6bce,
+	0x54e9, 0x69d9, 0x5e55, 0x819c, 0x6795, 0x9baa, 0x67fe, 0x9c52,
+	0x685d, 0x4ea6, 0x4fe3, 0x53c8, 0x62b9, 0x672b, 0x6cab, 0x8fc4,
+	0x4fad, 0x7e6d, 0x9ebf, 0x4e07, 0x6162, 0x6e80,
+	// plane 1 row 44
+	0x6f2b, 0x8513, 0x5473, 0x672a, 0x9b45, 0x5df3, 0x7b95, 0x5cac,
+	0x5bc6, 0x871c, 0x6e4a, 0x84d1, 0x7a14, 0x8108, 0x5999, 0x7c8d,
+	0x6c11, 0x7720, 0x52d9, 0x5922, 0x7121, 0x725f, 0x77db, 0x9727,
+	0x9d61, 0x690b, 0x5a7f, 0x5a18, 0x51a5, 0x540d, 0x547d, 0x660e,
+	0x76df, 0x8ff7, 0x9298, 0x9cf4, 0x59ea, 0x725d, 0x6ec5, 0x514d,
+	0x68c9, 0x7dbf, 0x7dec, 0x9762, 0x9eba, 0x6478, 0x6a21, 0x8302,
+	0x5984, 0x5b5f, 0x6bdb, 0x731b, 0x76f2, 0x7db2, 0x8017, 0x8499,
+	0x5132, 0x6728, 0x9ed9, 0x76ee, 0x6762, 0x52ff, 0x9905, 0x5c24,
+	0x623b, 0x7c7e, 0x8cb0, 0x554f, 0x60b6, 0x7d0b, 0x9580, 0x5301,
+	0x4e5f, 0x51b6, 0x591c, 0x723a, 0x8036, 0x91ce, 0x5f25, 0x77e2,
+	0x5384, 0x5f79, 0x7d04, 0x85ac, 0x8a33, 0x8e8d, 0x9756, 0x67f3,
+	0x85ae, 0x9453, 0x6109, 0x6108, 0x6cb9, 0x7652,
+	// plane 1 row 45
+	0x8aed, 0x8f38, 0x552f, 0x4f51, 0x512a, 0x52c7, 0x53cb, 0x5ba5,
+	0x5e7d, 0x60a0, 0x6182, 0x63d6, 0x6709, 0x67da, 0x6e67, 0x6d8c,
+	0x7336, 0x7337, 0x7531, 0x7950, 0x88d5, 0x8a98, 0x904a, 0x9091,
+	0x90f5, 0x96c4, 0x878d, 0x5915, 0x4e88, 0x4f59, 0x4e0e, 0x8a89,
+	0x8f3f, 0x9810, 0x50ad, 0x5e7c, 0x5996, 0x5bb9, 0x5eb8, 0x63da,
+	0x63fa, 0x64c1, 0x66dc, 0x694a, 0x69d8, 0x6d0b, 0x6eb6, 0x7194,
+	0x7528, 0x7aaf, 0x7f8a, 0x8000, 0x8449, 0x84c9, 0x8981, 0x8b21,
+	0x8e0a, 0x9065, 0x967d, 0x990a, 0x617e, 0x6291, 0x6b32, 0x6c83,
+	0x6d74, 0x7fcc, 0x7ffc, 0x6dc0, 0x7f85, 0x87ba, 0x88f8, 0x6765,
+	0x83b1, 0x983c, 0x96f7, 0x6d1b, 0x7d61, 0x843d, 0x916a, 0x4e71,
+	0x5375, 0x5d50, 0x6b04, 0x6feb, 0x85cd, 0x862d, 0x89a7, 0x5229,
+	0x540f, 0x5c65, 0x674e, 0x68a8, 0x7406, 0x7483,
+	// plane 1 row 46
+	0x75e2, 0x88cf, 0x88e1, 0x91cc, 0x96e2, 0x9678, 0x5f8b, 0x7387,
+	0x7acb, 0x844e, 0x63a0, 0x7565, 0x5289, 0x6d41, 0x6e9c, 0x7409,
+	0x7559, 0x786b, 0x7c92, 0x9686, 0x7adc, 0x9f8d, 0x4fb6, 0x616e,
+	0x65c5, 0x865c, 0x4e86, 0x4eae, 0x50da, 0x4e21, 0x51cc, 0x5bee,
+	0x6599, 0x6881, 0x6dbc, 0x731f, 0x7642, 0x77ad, 0x7a1c, 0x7ce7,
+	0x826f, 0x8ad2, 0x907c, 0x91cf, 0x9675, 0x9818, 0x529b, 0x7dd1,
+	0x502b, 0x5398, 0x6797, 0x6dcb, 0x71d0, 0x7433, 0x81e8, 0x8f2a,
+	0x96a3, 0x9c57, 0x9e9f, 0x7460, 0x5841, 0x6d99, 0x7d2f, 0x985e,
+	0x4ee4, 0x4f36, 0x4f8b, 0x51b7, 0x52b1, 0x5dba, 0x601c, 0x73b2,
+	0x793c, 0x82d3, 0x9234, 0x96b7, 0x96f6, 0x970a, 0x9e97, 0x9f62,
+	0x66a6, 0x6b74, 0x5217, 0x52a3, 0x70c8, 0x88c2, 0x5ec9, 0x604b,
+	0x6190, 0x6f23, 0x7149, 0x7c3e, 0x7df4, 0x806f,
+	// plane 1 row 47
+	0x84ee, 0x9023, 0x932c, 0x5442, 0x9b6f, 0x6ad3, 0x7089, 0x8cc2,
+	0x8def, 0x9732, 0x52b4, 0x5a41, 0x5eca, 0x5f04, 0x6717, 0x697c,
+	0x6994, 0x6d6a, 0x6f0f, 0x7262, 0x72fc, 0x7bed, 0x8001, 0x807e,
+	0x874b, 0x90ce, 0x516d, 0x9e93, 0x7984, 0x808b, 0x9332, 0x8ad6,
+	0x502d, 0x548c, 0x8a71, 0x6b6a, 0x8cc4, 0x8107, 0x60d1, 0x67a0,
+	0x9df2, 0x4e99, 0x4e98, 0x9c10, 0x8a6b, 0x85c1, 0x8568, 0x6900,
+	0x6e7e, 0x7897, 0x8155, 0xd805, 0x5b41, 0x5b56, 0x5b7d, 0x5b93,
+	0x5bd8, 0x5bec, 0x5c12, 0x5c1e, 0x5c23, 0x5c2b, 0x378d, 0x5c62,
+	0xfa3b, 0xfa3c, 0xd806, 0x5c7a, 0x5c8f, 0x5c9f, 0x5ca3, 0x5caa,
+	0x5cba, 0x5ccb, 0x5cd0, 0x5cd2, 0x5cf4, 0xd807, 0x37e2, 0x5d0d,
+	0x5d27, 0xfa11, 0x5d46, 0x5d47, 0x5d53, 0x5d4a, 0x5d6d, 0x5d81,
+	0x5da0, 0x5da4, 0x5da7, 0x5db8, 0x5dcb, 0x541e,
+	// plane 1 row 48
+	0x5f0c, 0x4e10, 0x4e15, 0x4e2a, 0x4e31, 0x4e36, 0x4e3c, 0x4e3f,
+	0x4e42, 0x4e56, 0x4e58, 0x4e82, 0x4e85, 0x8c6b, 0x4e8a, 0x8212,
+	0x5f0d, 0x4e8e, 0x4e9e, 0x4e9f, 0x4ea0, 0x4ea2, 0x4eb0, 0x4eb3,
+	0x4eb6, 0x4ece, 0x4ecd, 0x4ec4, 0x4ec6, 0x4ec2, 0x4ed7, 0x4ede,
+	0x4eed, 0x4edf, 0x4ef7, 0x4f09, 0x4f5a, 0x4f30, 0x4f5b, 0x4f5d,
+	0x4f57, 0x4f47, 0x4f76, 0x4f88, 0x4f8f, 0x4f98, 0x4f7b, 0x4f69,
+	0x4f70, 0x4f91, 0x4f6f, 0x4f86, 0x4f96, 0x5118, 0x4fd4, 0x4fdf,
+	0x4fce, 0x4fd8, 0x4fdb, 0x4fd1, 0x4fda, 0x4fd0, 0x4fe4, 0x4fe5,
+	0x501a, 0x5028, 0x5014, 0x502a, 0x5025, 0x5005, 0x4f1c, 0x4ff6,
+	0x5021, 0x5029, 0x502c, 0x4ffe, 0x4fef, 0x5011, 0x5006, 0x5043,
+	0x5047, 0x6703, 0x5055, 0x5050, 0x5048, 0x505a, 0x5056, 0x506c,
+	0x5078, 0x5080, 0x509a, 0x5085, 0x50b4, 0x50b2,
+	// plane 1 row 49
+	0x50c9, 0x50ca, 0x50b3, 0x50c2, 0x50d6, 0x50de, 0x50e5, 0x50ed,
+	0x50e3, 0x50ee, 0x50f9, 0x50f5, 0x5109, 0x5101, 0x5102, 0x5116,
+	0x5115, 0x5114, 0x511a, 0x5121, 0x513a, 0x5137, 0x513c, 0x513b,
+	0x513f, 0x5140, 0x5152, 0x514c, 0x5154, 0x5162, 0x7af8, 0x5169,
+	0x516a, 0x516e, 0x5180, 0x5182, 0x56d8, 0x518c, 0x5189, 0x518f,
+	0x5191, 0x5193, 0x5195, 0x5196, 0x51a4, 0x51a6, 0x51a2, 0x51a9,
+	0x51aa, 0x51ab, 0x51b3, 0x51b1, 0x51b2, 0x51b0, 0x51b5, 0x51bd,
+	0x51c5, 0x51c9, 0x51db, 0x51e0, 0x8655, 0x51e9, 0x51ed, 0x51f0,
+	0x51f5, 0x51fe, 0x5204, 0x520b, 0x5214, 0x520e, 0x5227, 0x522a,
+	0x522e, 0x5233, 0x5239, 0x524f, 0x5244, 0x524b, 0x524c, 0x525e,
+	0x5254, 0x526a, 0x5274, 0x5269, 0x5273, 0x527f, 0x527d, 0x528d,
+	0x5294, 0x5292, 0x5271, 0x5288, 0x5291, 0x8fa8,
+	// plane 1 row 50
+	0x8fa7, 0x52ac, 0x52ad, 0x52bc, 0x52b5, 0x52c1, 0x52cd, 0x52d7,
+	0x52de, 0x52e3, 0x52e6, 0x98ed, 0x52e0, 0x52f3, 0x52f5, 0x52f8,
+	0x52f9, 0x5306, 0x5308, 0x7538, 0x530d, 0x5310, 0x530f, 0x5315,
+	0x531a, 0x5323, 0x532f, 0x5331, 0x5333, 0x5338, 0x5340, 0x5346,
+	0x5345, 0x4e17, 0x5349, 0x534d, 0x51d6, 0x535e, 0x5369, 0x536e,
+	0x5918, 0x537b, 0x5377, 0x5382, 0x5396, 0x53a0, 0x53a6, 0x53a5,
+	0x53ae, 0x53b0, 0x53b6, 0x53c3, 0x7c12, 0x96d9, 0x53df, 0x66fc,
+	0x71ee, 0x53ee, 0x53e8, 0x53ed, 0x53fa, 0x5401, 0x543d, 0x5440,
+	0x542c, 0x542d, 0x543c, 0x542e, 0x5436, 0x5429, 0x541d, 0x544e,
+	0x548f, 0x5475, 0x548e, 0x545f, 0x5471, 0x5477, 0x5470, 0x5492,
+	0x547b, 0x5480, 0x5476, 0x5484, 0x5490, 0x5486, 0x54c7, 0x54a2,
+	0x54b8, 0x54a5, 0x54ac, 0x54c4, 0x54c8, 0x54a8,
+	// plane 1 row 51
+	0x54ab, 0x54c2, 0x54a4, 0x54be, 0x54bc, 0x54d8, 0x54e5, 0x54e6,
+	0x550f, 0x5514, 0x54fd, 0x54ee, 0x54ed, 0x54fa, 0x54e2, 0x5539,
+	0x5540, 0x5563, 0x554c, 0x552e, 0x555c, 0x5545, 0x5556, 0x5557,
+	0x5538, 0x5533, 0x555d, 0x5599, 0x5580, 0x54af, 0x558a, 0x559f,
+	0x557b, 0x557e, 0x5598, 0x559e, 0x55ae, 0x557c, 0x5583, 0x55a9,
+	0x5587, 0x55a8, 0x55da, 0x55c5, 0x55df, 0x55c4, 0x55dc, 0x55e4,
+	0x55d4, 0x5614, 0x55f7, 0x5616, 0x55fe, 0x55fd, 0x561b, 0x55f9,
+	0x564e, 0x5650, 0x71df, 0x5634, 0x5636, 0x5632, 0x5638, 0x566b,
+	0x5664, 0x562f, 0x566c, 0x566a, 0x5686, 0x5680, 0x568a, 0x56a0,
+	0x5694, 0x568f, 0x56a5, 0x56ae, 0x56b6, 0x56b4, 0x56c2, 0x56bc,
+	0x56c1, 0x56c3, 0x56c0, 0x56c8, 0x56ce, 0x56d1, 0x56d3, 0x56d7,
+	0x56ee, 0x56f9, 0x5700, 0x56ff, 0x5704, 0x5709,
+	// plane 1 row 52
+	0x5708, 0x570b, 0x570d, 0x5713, 0x5718, 0x5716, 0x55c7, 0x571c,
+	0x5726, 0x5737, 0x5738, 0x574e, 0x573b, 0x5740, 0x574f, 0x5769,
+	0x57c0, 0x5788, 0x5761, 0x577f, 0x5789, 0x5793, 0x57a0, 0x57b3,
+	0x57a4, 0x57aa, 0x57b0, 0x57c3, 0x57c6, 0x57d4, 0x57d2, 0x57d3,
+	0x580a, 0x57d6, 0x57e3, 0x580b, 0x5819, 0x581d, 0x5872, 0x5821,
+	0x5862, 0x584b, 0x5870, 0x6bc0, 0x5852, 0x583d, 0x5879, 0x5885,
+	0x58b9, 0x589f, 0x58ab, 0x58ba, 0x58de, 0x58bb, 0x58b8, 0x58ae,
+	0x58c5, 0x58d3, 0x58d1, 0x58d7, 0x58d9, 0x58d8, 0x58e5, 0x58dc,
+	0x58e4, 0x58df, 0x58ef, 0x58fa, 0x58f9, 0x58fb, 0x58fc, 0x58fd,
+	0x5902, 0x590a, 0x5910, 0x591b, 0x68a6, 0x5925, 0x592c, 0x592d,
+	0x5932, 0x5938, 0x593e, 0x7ad2, 0x5955, 0x5950, 0x594e, 0x595a,
+	0x5958, 0x5962, 0x5960, 0x5967, 0x596c, 0x5969,
+	// plane 1 row 53
+	0x5978, 0x5981, 0x599d, 0x4f5e, 0x4fab, 0x59a3, 0x59b2, 0x59c6,
+	0x59e8, 0x59dc, 0x598d, 0x59d9, 0x59da, 0x5a25, 0x5a1f, 0x5a11,
+	0x5a1c, 0x5a09, 0x5a1a, 0x5a40, 0x5a6c, 0x5a49, 0x5a35, 0x5a36,
+	0x5a62, 0x5a6a, 0x5a9a, 0x5abc, 0x5abe, 0x5acb, 0x5ac2, 0x5abd,
+	0x5ae3, 0x5ad7, 0x5ae6, 0x5ae9, 0x5ad6, 0x5afa, 0x5afb, 0x5b0c,
+	0x5b0b, 0x5b16, 0x5b32, 0x5ad0, 0x5b2a, 0x5b36, 0x5b3e, 0x5b43,
+	0x5b45, 0x5b40, 0x5b51, 0x5b55, 0x5b5a, 0x5b5b, 0x5b65, 0x5b69,
+	0x5b70, 0x5b73, 0x5b75, 0x5b78, 0x6588, 0x5b7a, 0x5b80, 0x5b83,
+	0x5ba6, 0x5bb8, 0x5bc3, 0x5bc7, 0x5bc9, 0x5bd4, 0x5bd0, 0x5be4,
+	0x5be6, 0x5be2, 0x5bde, 0x5be5, 0x5beb, 0x5bf0, 0x5bf6, 0x5bf3,
+	0x5c05, 0x5c07, 0x5c08, 0x5c0d, 0x5c13, 0x5c20, 0x5c22, 0x5c28,
+	0x5c38, 0x5c39, 0x5c41, 0x5c46, 0x5c4e, 0x5c53,
+	// plane 1 row 54
+	0x5c50, 0x5c4f, 0x5b71, 0x5c6c, 0x5c6e, 0x4e62, 0x5c76, 0x5c79,
+	0x5c8c, 0x5c91, 0x5c94, 0x599b, 0x5cab, 0x5cbb, 0x5cb6, 0x5cbc,
+	0x5cb7, 0x5cc5, 0x5cbe, 0x5cc7, 0x5cd9, 0x5ce9, 0x5cfd, 0x5cfa,
+	0x5ced, 0x5d8c, 0x5cea, 0x5d0b, 0x5d15, 0x5d17, 0x5d5c, 0x5d1f,
+	0x5d1b, 0x5d11, 0x5d14, 0x5d22, 0x5d1a, 0x5d19, 0x5d18, 0x5d4c,
+	0x5d52, 0x5d4e, 0x5d4b, 0x5d6c, 0x5d73, 0x5d76, 0x5d87, 0x5d84,
+	0x5d82, 0x5da2, 0x5d9d, 0x5dac, 0x5dae, 0x5dbd, 0x5d90, 0x5db7,
+	0x5dbc, 0x5dc9, 0x5dcd, 0x5dd3, 0x5dd2, 0x5dd6, 0x5ddb, 0x5deb,
+	0x5df2, 0x5df5, 0x5e0b, 0x5e1a, 0x5e19, 0x5e11, 0x5e1b, 0x5e36,
+	0x5e37, 0x5e44, 0x5e43, 0x5e40, 0x5e4e, 0x5e57, 0x5e54, 0x5e5f,
+	0x5e62, 0x5e64, 0x5e47, 0x5e75, 0x5e76, 0x5e7a, 0x9ebc, 0x5e7f,
+	0x5ea0, 0x5ec1, 0x5ec2, 0x5ec8, 0x5ed0, 0x5ecf,
+	// plane 1 row 55
+	0x5ed6, 0x5ee3, 0x5edd, 0x5eda, 0x5edb, 0x5ee2, 0x5ee1, 0x5ee8,
+	0x5ee9, 0x5eec, 0x5ef1, 0x5ef3, 0x5ef0, 0x5ef4, 0x5ef8, 0x5efe,
+	0x5f03, 0x5f09, 0x5f5d, 0x5f5c, 0x5f0b, 0x5f11, 0x5f16, 0x5f29,
+	0x5f2d, 0x5f38, 0x5f41, 0x5f48, 0x5f4c, 0x5f4e, 0x5f2f, 0x5f51,
+	0x5f56, 0x5f57, 0x5f59, 0x5f61, 0x5f6d, 0x5f73, 0x5f77, 0x5f83,
+	0x5f82, 0x5f7f, 0x5f8a, 0x5f88, 0x5f91, 0x5f87, 0x5f9e, 0x5f99,
+	0x5f98, 0x5fa0, 0x5fa8, 0x5fad, 0x5fbc, 0x5fd6, 0x5ffb, 0x5fe4,
+	0x5ff8, 0x5ff1, 0x5fdd, 0x60b3, 0x5fff, 0x6021, 0x6060, 0x6019,
+	0x6010, 0x6029, 0x600e, 0x6031, 0x601b, 0x6015, 0x602b, 0x6026,
+	0x600f, 0x603a, 0x605a, 0x6041, 0x606a, 0x6077, 0x605f, 0x604a,
+	0x6046, 0x604d, 0x6063, 0x6043, 0x6064, 0x6042, 0x606c, 0x606b,
+	0x6059, 0x6081, 0x608d, 0x60e7, 0x6083, 0x609a,
+	// plane 1 row 56
+	0x6084, 0x609b, 0x6096, 0x6097, 0x6092, 0x60a7, 0x608b, 0x60e1,
+	0x60b8, 0x60e0, 0x60d3, 0x60b4, 0x5ff0, 0x60bd, 0x60c6, 0x60b5,
+	0x60d8, 0x614d, 0x6115, 0x6106, 0x60f6, 0x60f7, 0x6100, 0x60f4,
+	0x60fa, 0x6103, 0x6121, 0x60fb, 0x60f1, 0x610d, 0x610e, 0x6147,
+	0x613e, 0x6128, 0x6127, 0x614a, 0x613f, 0x613c, 0x612c, 0x6134,
+	0x613d, 0x6142, 0x6144, 0x6173, 0x6177, 0x6158, 0x6159, 0x615a,
+	0x616b, 0x6174, 0x616f, 0x6165, 0x6171, 0x615f, 0x615d, 0x6153,
+	0x6175, 0x6199, 0x6196, 0x6187, 0x61ac, 0x6194, 0x619a, 0x618a,
+	0x6191, 0x61ab, 0x61ae, 0x61cc, 0x61ca, 0x61c9, 0x61f7, 0x61c8,
+	0x61c3, 0x61c6, 0x61ba, 0x61cb, 0x7f79, 0x61cd, 0x61e6, 0x61e3,
+	0x61f6, 0x61fa, 0x61f4, 0x61ff, 0x61fd, 0x61fc, 0x61fe, 0x6200,
+	0x6208, 0x6209, 0x620d, 0x620c, 0x6214, 0x621b,
+	// plane 1 row 57
+	0x621e, 0x6221, 0x622a, 0x622e, 0x6230, 0x6232, 0x6233, 0x6241,
+	0x624e, 0x625e, 0x6263, 0x625b, 0x6260, 0x6268, 0x627c, 0x6282,
+	0x6289, 0x627e, 0x6292, 0x6293, 0x6296, 0x62d4, 0x6283, 0x6294,
+	0x62d7, 0x62d1, 0x62bb, 0x62cf, 0x62ff, 0x62c6, 0x64d4, 0x62c8,
+	0x62dc, 0x62cc, 0x62ca, 0x62c2, 0x62c7, 0x629b, 0x62c9, 0x630c,
+	0x62ee, 0x62f1, 0x6327, 0x6302, 0x6308, 0x62ef, 0x62f5, 0x6350,
+	0x633e, 0x634d, 0x641c, 0x634f, 0x6396, 0x638e, 0x6380, 0x63ab,
+	0x6376, 0x63a3, 0x638f, 0x6389, 0x639f, 0x63b5, 0x636b, 0x6369,
+	0x63be, 0x63e9, 0x63c0, 0x63c6, 0x63e3, 0x63c9, 0x63d2, 0x63f6,
+	0x63c4, 0x6416, 0x6434, 0x6406, 0x6413, 0x6426, 0x6436, 0x651d,
+	0x6417, 0x6428, 0x640f, 0x6467, 0x646f, 0x6476, 0x644e, 0x652a,
+	0x6495, 0x6493, 0x64a5, 0x64a9, 0x6488, 0x64bc,
+	// plane 1 row 58
+	0x64da, 0x64d2, 0x64c5, 0x64c7, 0x64bb, 0x64d8, 0x64c2, 0x64f1,
+	0x64e7, 0x8209, 0x64e0, 0x64e1, 0x62ac, 0x64e3, 0x64ef, 0x652c,
+	0x64f6, 0x64f4, 0x64f2, 0x64fa, 0x6500, 0x64fd, 0x6518, 0x651c,
+	0x6505, 0x6524, 0x6523, 0x652b, 0x6534, 0x6535, 0x6537, 0x6536,
+	0x6538, 0x754b, 0x6548, 0x6556, 0x6555, 0x654d, 0x6558, 0x655e,
+	0x655d, 0x6572, 0x6578, 0x6582, 0x6583, 0x8b8a, 0x659b, 0x659f,
+	0x65ab, 0x65b7, 0x65c3, 0x65c6, 0x65c1, 0x65c4, 0x65cc, 0x65d2,
+	0x65db, 0x65d9, 0x65e0, 0x65e1, 0x65f1, 0x6772, 0x660a, 0x6603,
+	0x65fb, 0x6773, 0x6635, 0x6636, 0x6634, 0x661c, 0x664f, 0x6644,
+	0x6649, 0x6641, 0x665e, 0x665d, 0x6664, 0x6667, 0x6668, 0x665f,
+	0x6662, 0x6670, 0x6683, 0x6688, 0x668e, 0x6689, 0x6684, 0x6698,
+	0x669d, 0x66c1, 0x66b9, 0x66c9, 0x66be, 0x66bc,
+	// plane 1 row 59
+	0x66c4, 0x66b8, 0x66d6, 0x66da, 0x66e0, 0x663f, 0x66e6, 0x66e9,
+	0x66f0, 0x66f5, 0x66f7, 0x670f, 0x6716, 0x671e, 0x6726, 0x6727,
+	0x9738, 0x672e, 0x673f, 0x6736, 0x6741, 0x6738, 0x6737, 0x6746,
+	0x675e, 0x6760, 0x6759, 0x6763, 0x6764, 0x6789, 0x6770, 0x67a9,
+	0x677c, 0x676a, 0x678c, 0x678b, 0x67a6, 0x67a1, 0x6785, 0x67b7,
+	0x67ef, 0x67b4, 0x67ec, 0x67b3, 0x67e9, 0x67b8, 0x67e4, 0x67de,
+	0x67dd, 0x67e2, 0x67ee, 0x67b9, 0x67ce, 0x67c6, 0x67e7, 0x6a9c,
+	0x681e, 0x6846, 0x6829, 0x6840, 0x684d, 0x6832, 0x684e, 0x68b3,
+	0x682b, 0x6859, 0x6863, 0x6877, 0x687f, 0x689f, 0x688f, 0x68ad,
+	0x6894, 0x689d, 0x689b, 0x6883, 0x6aae, 0x68b9, 0x6874, 0x68b5,
+	0x68a0, 0x68ba, 0x690f, 0x688d, 0x687e, 0x6901, 0x68ca, 0x6908,
+	0x68d8, 0x6922, 0x6926, 0x68e1, 0x690c, 0x68cd,
+	// plane 1 row 60
+	0x68d4, 0x68e7, 0x68d5, 0x6936, 0x6912, 0x6904, 0x68d7, 0x68e3,
+	0x6925, 0x68f9, 0x68e0, 0x68ef, 0x6928, 0x692a, 0x691a, 0x6923,
+	0x6921, 0x68c6, 0x6979, 0x6977, 0x695c, 0x6978, 0x696b, 0x6954,
+	0x697e, 0x696e, 0x6939, 0x6974, 0x693d, 0x6959, 0x6930, 0x6961,
+	0x695e, 0x695d, 0x6981, 0x696a, 0x69b2, 0x69ae, 0x69d0, 0x69bf,
+	0x69c1, 0x69d3, 0x69be, 0x69ce, 0x5be8, 0x69ca, 0x69dd, 0x69bb,
+	0x69c3, 0x69a7, 0x6a2e, 0x6991, 0x69a0, 0x699c, 0x6995, 0x69b4,
+	0x69de, 0x69e8, 0x6a02, 0x6a1b, 0x69ff, 0x6b0a, 0x69f9, 0x69f2,
+	0x69e7, 0x6a05, 0x69b1, 0x6a1e, 0x69ed, 0x6a14, 0x69eb, 0x6a0a,
+	0x6a12, 0x6ac1, 0x6a23, 0x6a13, 0x6a44, 0x6a0c, 0x6a72, 0x6a36,
+	0x6a78, 0x6a47, 0x6a62, 0x6a59, 0x6a66, 0x6a48, 0x6a38, 0x6a22,
+	0x6a90, 0x6a8d, 0x6aa0, 0x6a84, 0x6aa2, 0x6aa3,
+	// plane 1 row 61
+	0x6a97, 0x8617, 0x6abb, 0x6ac3, 0x6ac2, 0x6ab8, 0x6ab3, 0x6aac,
+	0x6ade, 0x6ad1, 0x6adf, 0x6aaa, 0x6ada, 0x6aea, 0x6afb, 0x6b05,
+	0x8616, 0x6afa, 0x6b12, 0x6b16, 0x9b31, 0x6b1f, 0x6b38, 0x6b37,
+	0x76dc, 0x6b39, 0x98ee, 0x6b47, 0x6b43, 0x6b49, 0x6b50, 0x6b59,
+	0x6b54, 0x6b5b, 0x6b5f, 0x6b61, 0x6b78, 0x6b79, 0x6b7f, 0x6b80,
+	0x6b84, 0x6b83, 0x6b8d, 0x6b98, 0x6b95, 0x6b9e, 0x6ba4, 0x6baa,
+	0x6bab, 0x6baf, 0x6bb2, 0x6bb1, 0x6bb3, 0x6bb7, 0x6bbc, 0x6bc6,
+	0x6bcb, 0x6bd3, 0x6bdf, 0x6bec, 0x6beb, 0x6bf3, 0x6bef, 0x9ebe,
+	0x6c08, 0x6c13, 0x6c14, 0x6c1b, 0x6c24, 0x6c23, 0x6c5e, 0x6c55,
+	0x6c62, 0x6c6a, 0x6c82, 0x6c8d, 0x6c9a, 0x6c81, 0x6c9b, 0x6c7e,
+	0x6c68, 0x6c73, 0x6c92, 0x6c90, 0x6cc4, 0x6cf1, 0x6cd3, 0x6cbd,
+	0x6cd7, 0x6cc5, 0x6cdd, 0x6cae, 0x6cb1, 0x6cbe,
+	// plane 1 row 62
+	0x6cba, 0x6cdb, 0x6cef, 0x6cd9, 0x6cea, 0x6d1f, 0x884d, 0x6d36,
+	0x6d2b, 0x6d3d, 0x6d38, 0x6d19, 0x6d35, 0x6d33, 0x6d12, 0x6d0c,
+	0x6d63, 0x6d93, 0x6d64, 0x6d5a, 0x6d79, 0x6d59, 0x6d8e, 0x6d95,
+	0x6fe4, 0x6d85, 0x6df9, 0x6e15, 0x6e0a, 0x6db5, 0x6dc7, 0x6de6,
+	0x6db8, 0x6dc6, 0x6dec, 0x6dde, 0x6dcc, 0x6de8, 0x6dd2, 0x6dc5,
+	0x6dfa, 0x6dd9, 0x6de4, 0x6dd5, 0x6dea, 0x6dee, 0x6e2d, 0x6e6e,
+	0x6e2e, 0x6e19, 0x6e72, 0x6e5f, 0x6e3e, 0x6e23, 0x6e6b, 0x6e2b,
+	0x6e76, 0x6e4d, 0x6e1f, 0x6e43, 0x6e3a, 0x6e4e, 0x6e24, 0x6eff,
+	0x6e1d, 0x6e38, 0x6e82, 0x6eaa, 0x6e98, 0x6ec9, 0x6eb7, 0x6ed3,
+	0x6ebd, 0x6eaf, 0x6ec4, 0x6eb2, 0x6ed4, 0x6ed5, 0x6e8f, 0x6ea5,
+	0x6ec2, 0x6e9f, 0x6f41, 0x6f11, 0x704c, 0x6eec, 0x6ef8, 0x6efe,
+	0x6f3f, 0x6ef2, 0x6f31, 0x6eef, 0x6f32, 0x6ecc,
+	// plane 1 row 63
+	0x6f3e, 0x6f13, 0x6ef7, 0x6f86, 0x6f7a, 0x6f78, 0x6f81, 0x6f80,
+	0x6f6f, 0x6f5b, 0x6ff3, 0x6f6d, 0x6f82, 0x6f7c, 0x6f58, 0x6f8e,
+	0x6f91, 0x6fc2, 0x6f66, 0x6fb3, 0x6fa3, 0x6fa1, 0x6fa4, 0x6fb9,
+	0x6fc6, 0x6faa, 0x6fdf, 0x6fd5, 0x6fec, 0x6fd4, 0x6fd8, 0x6ff1,
+	0x6fee, 0x6fdb, 0x7009, 0x700b, 0x6ffa, 0x7011, 0x7001, 0x700f,
+	0x6ffe, 0x701b, 0x701a, 0x6f74, 0x701d, 0x7018, 0x701f, 0x7030,
+	0x703e, 0x7032, 0x7051, 0x7063, 0x7099, 0x7092, 0x70af, 0x70f1,
+	0x70ac, 0x70b8, 0x70b3, 0x70ae, 0x70df, 0x70cb, 0x70dd, 0x70d9,
+	0x7109, 0x70fd, 0x711c, 0x7119, 0x7165, 0x7155, 0x7188, 0x7166,
+	0x7162, 0x714c, 0x7156, 0x716c, 0x718f, 0x71fb, 0x7184, 0x7195,
+	0x71a8, 0x71ac, 0x71d7, 0x71b9, 0x71be, 0x71d2, 0x71c9, 0x71d4,
+	0x71ce, 0x71e0, 0x71ec, 0x71e7, 0x71f5, 0x71fc,
+	// plane 1 row 64
+	0x71f9, 0x71ff, 0x720d, 0x7210, 0x721b, 0x7228, 0x722d, 0x722c,
+	0x7230, 0x7232, 0x723b, 0x723c, 0x723f, 0x7240, 0x7246, 0x724b,
+	0x7258, 0x7274, 0x727e, 0x7282, 0x7281, 0x7287, 0x7292, 0x7296,
+	0x72a2, 0x72a7, 0x72b9, 0x72b2, 0x72c3, 0x72c6, 0x72c4, 0x72ce,
+	0x72d2, 0x72e2, 0x72e0, 0x72e1, 0x72f9, 0x72f7, 0x500f, 0x7317,
+	0x730a, 0x731c, 0x7316, 0x731d, 0x7334, 0x732f, 0x7329, 0x7325,
+	0x733e, 0x734e, 0x734f, 0x9ed8, 0x7357, 0x736a, 0x7368, 0x7370,
+	0x7378, 0x7375, 0x737b, 0x737a, 0x73c8, 0x73b3, 0x73ce, 0x73bb,
+	0x73c0, 0x73e5, 0x73ee, 0x73de, 0x74a2, 0x7405, 0x746f, 0x7425,
+	0x73f8, 0x7432, 0x743a, 0x7455, 0x743f, 0x745f, 0x7459, 0x7441,
+	0x745c, 0x7469, 0x7470, 0x7463, 0x746a, 0x7476, 0x747e, 0x748b,
+	0x749e, 0x74a7, 0x74ca, 0x74cf, 0x74d4, 0x73f1,
+	// plane 1 row 65
+	0x74e0, 0x74e3, 0x74e7, 0x74e9, 0x74ee, 0x74f2, 0x74f0, 0x74f1,
+	0x74f8, 0x74f7, 0x7504, 0x7503, 0x7505, 0x750c, 0x750e, 0x750d,
+	0x7515, 0x7513, 0x751e, 0x7526, 0x752c, 0x753c, 0x7544, 0x754d,
+	0x754a, 0x7549, 0x755b, 0x7546, 0x755a, 0x7569, 0x7564, 0x7567,
+	0x756b, 0x756d, 0x7578, 0x7576, 0x7586, 0x7587, 0x7574, 0x758a,
+	0x7589, 0x7582, 0x7594, 0x759a, 0x759d, 0x75a5, 0x75a3, 0x75c2,
+	0x75b3, 0x75c3, 0x75b5, 0x75bd, 0x75b8, 0x75bc, 0x75b1, 0x75cd,
+	0x75ca, 0x75d2, 0x75d9, 0x75e3, 0x75de, 0x75fe, 0x75ff, 0x75fc,
+	0x7601, 0x75f0, 0x75fa, 0x75f2, 0x75f3, 0x760b, 0x760d, 0x7609,
+	0x761f, 0x7627, 0x7620, 0x7621, 0x7622, 0x7624, 0x7634, 0x7630,
+	0x763b, 0x7647, 0x7648, 0x7646, 0x765c, 0x7658, 0x7661, 0x7662,
+	0x7668, 0x7669, 0x766a, 0x7667, 0x766c, 0x7670,
+	// plane 1 row 66
+	0x7672, 0x7676, 0x7678, 0x767c, 0x7680, 0x7683, 0x7688, 0x768b,
+	0x768e, 0x7696, 0x7693, 0x7699, 0x769a, 0x76b0, 0x76b4, 0x76b8,
+	0x76b9, 0x76ba, 0x76c2, 0x76cd, 0x76d6, 0x76d2, 0x76de, 0x76e1,
+	0x76e5, 0x76e7, 0x76ea, 0x862f, 0x76fb, 0x7708, 0x7707, 0x7704,
+	0x7729, 0x7724, 0x771e, 0x7725, 0x7726, 0x771b, 0x7737, 0x7738,
+	0x7747, 0x775a, 0x7768, 0x776b, 0x775b, 0x7765, 0x777f, 0x777e,
+	0x7779, 0x778e, 0x778b, 0x7791, 0x77a0, 0x779e, 0x77b0, 0x77b6,
+	0x77b9, 0x77bf, 0x77bc, 0x77bd, 0x77bb, 0x77c7, 0x77cd, 0x77d7,
+	0x77da, 0x77dc, 0x77e3, 0x77ee, 0x77fc, 0x780c, 0x7812, 0x7926,
+	0x7820, 0x792a, 0x7845, 0x788e, 0x7874, 0x7886, 0x787c, 0x789a,
+	0x788c, 0x78a3, 0x78b5, 0x78aa, 0x78af, 0x78d1, 0x78c6, 0x78cb,
+	0x78d4, 0x78be, 0x78bc, 0x78c5, 0x78ca, 0x78ec,
+	// plane 1 row 67
+	0x78e7, 0x78da, 0x78fd, 0x78f4, 0x7907, 0x7912, 0x7911, 0x7919,
+	0x792c, 0x792b, 0x7940, 0x7960, 0x7957, 0x795f, 0x795a, 0x7955,
+	0x7953, 0x797a, 0x797f, 0x798a, 0x799d, 0x79a7, 0x9f4b, 0x79aa,
+	0x79ae, 0x79b3, 0x79b9, 0x79ba, 0x79c9, 0x79d5, 0x79e7, 0x79ec,
+	0x79e1, 0x79e3, 0x7a08, 0x7a0d, 0x7a18, 0x7a19, 0x7a20, 0x7a1f,
+	0x7980, 0x7a31, 0x7a3b, 0x7a3e, 0x7a37, 0x7a43, 0x7a57, 0x7a49,
+	0x7a61, 0x7a62, 0x7a69, 0x9f9d, 0x7a70, 0x7a79, 0x7a7d, 0x7a88,
+	0x7a97, 0x7a95, 0x7a98, 0x7a96, 0x7aa9, 0x7ac8, 0x7ab0, 0x7ab6,
+	0x7ac5, 0x7ac4, 0x7abf, 0x9083, 0x7ac7, 0x7aca, 0x7acd, 0x7acf,
+	0x7ad5, 0x7ad3, 0x7ad9, 0x7ada, 0x7add, 0x7ae1, 0x7ae2, 0x7ae6,
+	0x7aed, 0x7af0, 0x7b02, 0x7b0f, 0x7b0a, 0x7b06, 0x7b33, 0x7b18,
+	0x7b19, 0x7b1e, 0x7b35, 0x7b28, 0x7b36, 0x7b50,
+	// plane 1 row 68
+	0x7b7a, 0x7b04, 0x7b4d, 0x7b0b, 0x7b4c, 0x7b45, 0x7b75, 0x7b65,
+	0x7b74, 0x7b67, 0x7b70, 0x7b71, 0x7b6c, 0x7b6e, 0x7b9d, 0x7b98,
+	0x7b9f, 0x7b8d, 0x7b9c, 0x7b9a, 0x7b8b, 0x7b92, 0x7b8f, 0x7b5d,
+	0x7b99, 0x7bcb, 0x7bc1, 0x7bcc, 0x7bcf, 0x7bb4, 0x7bc6, 0x7bdd,
+	0x7be9, 0x7c11, 0x7c14, 0x7be6, 0x7be5, 0x7c60, 0x7c00, 0x7c07,
+	0x7c13, 0x7bf3, 0x7bf7, 0x7c17, 0x7c0d, 0x7bf6, 0x7c23, 0x7c27,
+	0x7c2a, 0x7c1f, 0x7c37, 0x7c2b, 0x7c3d, 0x7c4c, 0x7c43, 0x7c54,
+	0x7c4f, 0x7c40, 0x7c50, 0x7c58, 0x7c5f, 0x7c64, 0x7c56, 0x7c65,
+	0x7c6c, 0x7c75, 0x7c83, 0x7c90, 0x7ca4, 0x7cad, 0x7ca2, 0x7cab,
+	0x7ca1, 0x7ca8, 0x7cb3, 0x7cb2, 0x7cb1, 0x7cae, 0x7cb9, 0x7cbd,
+	0x7cc0, 0x7cc5, 0x7cc2, 0x7cd8, 0x7cd2, 0x7cdc, 0x7ce2, 0x9b3b,
+	0x7cef, 0x7cf2, 0x7cf4, 0x7cf6, 0x7cfa, 0x7d06,
+	// plane 1 row 69
+	0x7d02, 0x7d1c, 0x7d15, 0x7d0a, 0x7d45, 0x7d4b, 0x7d2e, 0x7d32,
+	0x7d3f, 0x7d35, 0x7d46, 0x7d73, 0x7d56, 0x7d4e, 0x7d72, 0x7d68,
+	0x7d6e, 0x7d4f, 0x7d63, 0x7d93, 0x7d89, 0x7d5b, 0x7d8f, 0x7d7d,
+	0x7d9b, 0x7dba, 0x7dae, 0x7da3, 0x7db5, 0x7dc7, 0x7dbd, 0x7dab,
+	0x7e3d, 0x7da2, 0x7daf, 0x7ddc, 0x7db8, 0x7d9f, 0x7db0, 0x7dd8,
+	0x7ddd, 0x7de4, 0x7dde, 0x7dfb, 0x7df2, 0x7de1, 0x7e05, 0x7e0a,
+	0x7e23, 0x7e21, 0x7e12, 0x7e31, 0x7e1f, 0x7e09, 0x7e0b, 0x7e22,
+	0x7e46, 0x7e66, 0x7e3b, 0x7e35, 0x7e39, 0x7e43, 0x7e37, 0x7e32,
+	0x7e3a, 0x7e67, 0x7e5d, 0x7e56, 0x7e5e, 0x7e59, 0x7e5a, 0x7e79,
+	0x7e6a, 0x7e69, 0x7e7c, 0x7e7b, 0x7e83, 0x7dd5, 0x7e7d, 0x8fae,
+	0x7e7f, 0x7e88, 0x7e89, 0x7e8c, 0x7e92, 0x7e90, 0x7e93, 0x7e94,
+	0x7e96, 0x7e8e, 0x7e9b, 0x7e9c, 0x7f38, 0x7f3a,
+	// plane 1 row 70
+	0x7f45, 0x7f4c, 0x7f4d, 0x7f4e, 0x7f50, 0x7f51, 0x7f55, 0x7f54,
+	0x7f58, 0x7f5f, 0x7f60, 0x7f68, 0x7f69, 0x7f67, 0x7f78, 0x7f82,
+	0x7f86, 0x7f83, 0x7f88, 0x7f87, 0x7f8c, 0x7f94, 0x7f9e, 0x7f9d,
+	0x7f9a, 0x7fa3, 0x7faf, 0x7fb2, 0x7fb9, 0x7fae, 0x7fb6, 0x7fb8,
+	0x8b71, 0x7fc5, 0x7fc6, 0x7fca, 0x7fd5, 0x7fd4, 0x7fe1, 0x7fe6,
+	0x7fe9, 0x7ff3, 0x7ff9, 0x98dc, 0x8006, 0x8004, 0x800b, 0x8012,
+	0x8018, 0x8019, 0x801c, 0x8021, 0x8028, 0x803f, 0x803b, 0x804a,
+	0x8046, 0x8052, 0x8058, 0x805a, 0x805f, 0x8062, 0x8068, 0x8073,
+	0x8072, 0x8070, 0x8076, 0x8079, 0x807d, 0x807f, 0x8084, 0x8086,
+	0x8085, 0x809b, 0x8093, 0x809a, 0x80ad, 0x5190, 0x80ac, 0x80db,
+	0x80e5, 0x80d9, 0x80dd, 0x80c4, 0x80da, 0x80d6, 0x8109, 0x80ef,
+	0x80f1, 0x811b, 0x8129, 0x8123, 0x812f, 0x814b,
+	// plane 1 row 71
+	0x968b, 0x8146, 0x813e, 0x8153, 0x8151, 0x80fc, 0x8171, 0x816e,
+	0x8165, 0x8166, 0x8174, 0x8183, 0x8188, 0x818a, 0x8180, 0x8182,
+	0x81a0, 0x8195, 0x81a4, 0x81a3, 0x815f, 0x8193, 0x81a9, 0x81b0,
+	0x81b5, 0x81be, 0x81b8, 0x81bd, 0x81c0, 0x81c2, 0x81ba, 0x81c9,
+	0x81cd, 0x81d1, 0x81d9, 0x81d8, 0x81c8, 0x81da, 0x81df, 0x81e0,
+	0x81e7, 0x81fa, 0x81fb, 0x81fe, 0x8201, 0x8202, 0x8205, 0x8207,
+	0x820a, 0x820d, 0x8210, 0x8216, 0x8229, 0x822b, 0x8238, 0x8233,
+	0x8240, 0x8259, 0x8258, 0x825d, 0x825a, 0x825f, 0x8264, 0x8262,
+	0x8268, 0x826a, 0x826b, 0x822e, 0x8271, 0x8277, 0x8278, 0x827e,
+	0x828d, 0x8292, 0x82ab, 0x829f, 0x82bb, 0x82ac, 0x82e1, 0x82e3,
+	0x82df, 0x82d2, 0x82f4, 0x82f3, 0x82fa, 0x8393, 0x8303, 0x82fb,
+	0x82f9, 0x82de, 0x8306, 0x82dc, 0x8309, 0x82d9,
+	// plane 1 row 72
+	0x8335, 0x8334, 0x8316, 0x8332, 0x8331, 0x8340, 0x8339, 0x8350,
+	0x8345, 0x832f, 0x832b, 0x8317, 0x8318, 0x8385, 0x839a, 0x83aa,
+	0x839f, 0x83a2, 0x8396, 0x8323, 0x838e, 0x8387, 0x838a, 0x837c,
+	0x83b5, 0x8373, 0x8375, 0x83a0, 0x8389, 0x83a8, 0x83f4, 0x8413,
+	0x83eb, 0x83ce, 0x83fd, 0x8403, 0x83d8, 0x840b, 0x83c1, 0x83f7,
+	0x8407, 0x83e0, 0x83f2, 0x840d, 0x8422, 0x8420, 0x83bd, 0x8438,
+	0x8506, 0x83fb, 0x846d, 0x842a, 0x843c, 0x855a, 0x8484, 0x8477,
+	0x846b, 0x84ad, 0x846e, 0x8482, 0x8469, 0x8446, 0x842c, 0x846f,
+	0x8479, 0x8435, 0x84ca, 0x8462, 0x84b9, 0x84bf, 0x849f, 0x84d9,
+	0x84cd, 0x84bb, 0x84da, 0x84d0, 0x84c1, 0x84c6, 0x84d6, 0x84a1,
+	0x8521, 0x84ff, 0x84f4, 0x8517, 0x8518, 0x852c, 0x851f, 0x8515,
+	0x8514, 0x84fc, 0x8540, 0x8563, 0x8558, 0x8548,
+	// plane 1 row 73
+	0x8541, 0x8602, 0x854b, 0x8555, 0x8580, 0x85a4, 0x8588, 0x8591,
+	0x858a, 0x85a8, 0x856d, 0x8594, 0x859b, 0x85ea, 0x8587, 0x859c,
+	0x8577, 0x857e, 0x8590, 0x85c9, 0x85ba, 0x85cf, 0x85b9, 0x85d0,
+	0x85d5, 0x85dd, 0x85e5, 0x85dc, 0x85f9, 0x860a, 0x8613, 0x860b,
+	0x85fe, 0x85fa, 0x8606, 0x8622, 0x861a, 0x8630, 0x863f, 0x864d,
+	0x4e55, 0x8654, 0x865f, 0x8667, 0x8671, 0x8693, 0x86a3, 0x86a9,
+	0x86aa, 0x868b, 0x868c, 0x86b6, 0x86af, 0x86c4, 0x86c6, 0x86b0,
+	0x86c9, 0x8823, 0x86ab, 0x86d4, 0x86de, 0x86e9, 0x86ec, 0x86df,
+	0x86db, 0x86ef, 0x8712, 0x8706, 0x8708, 0x8700, 0x8703, 0x86fb,
+	0x8711, 0x8709, 0x870d, 0x86f9, 0x870a, 0x8734, 0x873f, 0x8737,
+	0x873b, 0x8725, 0x8729, 0x871a, 0x8760, 0x875f, 0x8778, 0x874c,
+	0x874e, 0x8774, 0x8757, 0x8768, 0x876e, 0x8759,
+	// plane 1 row 74
+	0x8753, 0x8763, 0x876a, 0x8805, 0x87a2, 0x879f, 0x8782, 0x87af,
+	0x87cb, 0x87bd, 0x87c0, 0x87d0, 0x96d6, 0x87ab, 0x87c4, 0x87b3,
+	0x87c7, 0x87c6, 0x87bb, 0x87ef, 0x87f2, 0x87e0, 0x880f, 0x880d,
+	0x87fe, 0x87f6, 0x87f7, 0x880e, 0x87d2, 0x8811, 0x8816, 0x8815,
+	0x8822, 0x8821, 0x8831, 0x8836, 0x8839, 0x8827, 0x883b, 0x8844,
+	0x8842, 0x8852, 0x8859, 0x885e, 0x8862, 0x886b, 0x8881, 0x887e,
+	0x889e, 0x8875, 0x887d, 0x88b5, 0x8872, 0x8882, 0x8897, 0x8892,
+	0x88ae, 0x8899, 0x88a2, 0x888d, 0x88a4, 0x88b0, 0x88bf, 0x88b1,
+	0x88c3, 0x88c4, 0x88d4, 0x88d8, 0x88d9, 0x88dd, 0x88f9, 0x8902,
+	0x88fc, 0x88f4, 0x88e8, 0x88f2, 0x8904, 0x890c, 0x890a, 0x8913,
+	0x8943, 0x891e, 0x8925, 0x892a, 0x892b, 0x8941, 0x8944, 0x893b,
+	0x8936, 0x8938, 0x894c, 0x891d, 0x8960, 0x895e,
+	// plane 1 row 75
+	0x8966, 0x8964, 0x896d, 0x896a, 0x896f, 0x8974, 0x8977, 0x897e,
+	0x8983, 0x8988, 0x898a, 0x8993, 0x8998, 0x89a1, 0x89a9, 0x89a6,
+	0x89ac, 0x89af, 0x89b2, 0x89ba, 0x89bd, 0x89bf, 0x89c0, 0x89da,
+	0x89dc, 0x89dd, 0x89e7, 0x89f4, 0x89f8, 0x8a03, 0x8a16, 0x8a10,
+	0x8a0c, 0x8a1b, 0x8a1d, 0x8a25, 0x8a36, 0x8a41, 0x8a5b, 0x8a52,
+	0x8a46, 0x8a48, 0x8a7c, 0x8a6d, 0x8a6c, 0x8a62, 0x8a85, 0x8a82,
+	0x8a84, 0x8aa8, 0x8aa1, 0x8a91, 0x8aa5, 0x8aa6, 0x8a9a, 0x8aa3,
+	0x8ac4, 0x8acd, 0x8ac2, 0x8ada, 0x8aeb, 0x8af3, 0x8ae7, 0x8ae4,
+	0x8af1, 0x8b14, 0x8ae0, 0x8ae2, 0x8af7, 0x8ade, 0x8adb, 0x8b0c,
+	0x8b07, 0x8b1a, 0x8ae1, 0x8b16, 0x8b10, 0x8b17, 0x8b20, 0x8b33,
+	0x97ab, 0x8b26, 0x8b2b, 0x8b3e, 0x8b28, 0x8b41, 0x8b4c, 0x8b4f,
+	0x8b4e, 0x8b49, 0x8b56, 0x8b5b, 0x8b5a, 0x8b6b,
+	// plane 1 row 76
+	0x8b5f, 0x8b6c, 0x8b6f, 0x8b74, 0x8b7d, 0x8b80, 0x8b8c, 0x8b8e,
+	0x8b92, 0x8b93, 0x8b96, 0x8b99, 0x8b9a, 0x8c3a, 0x8c41, 0x8c3f,
+	0x8c48, 0x8c4c, 0x8c4e, 0x8c50, 0x8c55, 0x8c62, 0x8c6c, 0x8c78,
+	0x8c7a, 0x8c82, 0x8c89, 0x8c85, 0x8c8a, 0x8c8d, 0x8c8e, 0x8c94,
+	0x8c7c, 0x8c98, 0x621d, 0x8cad, 0x8caa, 0x8cbd, 0x8cb2, 0x8cb3,
+	0x8cae, 0x8cb6, 0x8cc8, 0x8cc1, 0x8ce4, 0x8ce3, 0x8cda, 0x8cfd,
+	0x8cfa, 0x8cfb, 0x8d04, 0x8d05, 0x8d0a, 0x8d07, 0x8d0f, 0x8d0d,
+	0x8d10, 0x9f4e, 0x8d13, 0x8ccd, 0x8d14, 0x8d16, 0x8d67, 0x8d6d,
+	0x8d71, 0x8d73, 0x8d81, 0x8d99, 0x8dc2, 0x8dbe, 0x8dba, 0x8dcf,
+	0x8dda, 0x8dd6, 0x8dcc, 0x8ddb, 0x8dcb, 0x8dea, 0x8deb, 0x8ddf,
+	0x8de3, 0x8dfc, 0x8e08, 0x8e09, 0x8dff, 0x8e1d, 0x8e1e, 0x8e10,
+	0x8e1f, 0x8e42, 0x8e35, 0x8e30, 0x8e34, 0x8e4a,
+	// plane 1 row 77
+	0x8e47, 0x8e49, 0x8e4c, 0x8e50, 0x8e48, 0x8e59, 0x8e64, 0x8e60,
+	0x8e2a, 0x8e63, 0x8e55, 0x8e76, 0x8e72, 0x8e7c, 0x8e81, 0x8e87,
+	0x8e85, 0x8e84, 0x8e8b, 0x8e8a, 0x8e93, 0x8e91, 0x8e94, 0x8e99,
+	0x8eaa, 0x8ea1, 0x8eac, 0x8eb0, 0x8ec6, 0x8eb1, 0x8ebe, 0x8ec5,
+	0x8ec8, 0x8ecb, 0x8edb, 0x8ee3, 0x8efc, 0x8efb, 0x8eeb, 0x8efe,
+	0x8f0a, 0x8f05, 0x8f15, 0x8f12, 0x8f19, 0x8f13, 0x8f1c, 0x8f1f,
+	0x8f1b, 0x8f0c, 0x8f26, 0x8f33, 0x8f3b, 0x8f39, 0x8f45, 0x8f42,
+	0x8f3e, 0x8f4c, 0x8f49, 0x8f46, 0x8f4e, 0x8f57, 0x8f5c, 0x8f62,
+	0x8f63, 0x8f64, 0x8f9c, 0x8f9f, 0x8fa3, 0x8fad, 0x8faf, 0x8fb7,
+	0x8fda, 0x8fe5, 0x8fe2, 0x8fea, 0x8fef, 0x9087, 0x8ff4, 0x9005,
+	0x8ff9, 0x8ffa, 0x9011, 0x9015, 0x9021, 0x900d, 0x901e, 0x9016,
+	0x900b, 0x9027, 0x9036, 0x9035, 0x9039, 0x8ff8,
+	// plane 1 row 78
+	0x904f, 0x9050, 0x9051, 0x9052, 0x900e, 0x9049, 0x903e, 0x9056,
+	0x9058, 0x905e, 0x9068, 0x906f, 0x9076, 0x96a8, 0x9072, 0x9082,
+	0x907d, 0x9081, 0x9080, 0x908a, 0x9089, 0x908f, 0x90a8, 0x90af,
+	0x90b1, 0x90b5, 0x90e2, 0x90e4, 0x6248, 0x90db, 0x9102, 0x9112,
+	0x9119, 0x9132, 0x9130, 0x914a, 0x9156, 0x9158, 0x9163, 0x9165,
+	0x9169, 0x9173, 0x9172, 0x918b, 0x9189, 0x9182, 0x91a2, 0x91ab,
+	0x91af, 0x91aa, 0x91b5, 0x91b4, 0x91ba, 0x91c0, 0x91c1, 0x91c9,
+	0x91cb, 0x91d0, 0x91d6, 0x91df, 0x91e1, 0x91db, 0x91fc, 0x91f5,
+	0x91f6, 0x921e, 0x91ff, 0x9214, 0x922c, 0x9215, 0x9211, 0x925e,
+	0x9257, 0x9245, 0x9249, 0x9264, 0x9248, 0x9295, 0x923f, 0x924b,
+	0x9250, 0x929c, 0x9296, 0x9293, 0x929b, 0x925a, 0x92cf, 0x92b9,
+	0x92b7, 0x92e9, 0x930f, 0x92fa, 0x9344, 0x932e,
+	// plane 1 row 79
+	0x9319, 0x9322, 0x931a, 0x9323, 0x933a, 0x9335, 0x933b, 0x935c,
+	0x9360, 0x937c, 0x936e, 0x9356, 0x93b0, 0x93ac, 0x93ad, 0x9394,
+	0x93b9, 0x93d6, 0x93d7, 0x93e8, 0x93e5, 0x93d8, 0x93c3, 0x93dd,
+	0x93d0, 0x93c8, 0x93e4, 0x941a, 0x9414, 0x9413, 0x9403, 0x9407,
+	0x9410, 0x9436, 0x942b, 0x9435, 0x9421, 0x943a, 0x9441, 0x9452,
+	0x9444, 0x945b, 0x9460, 0x9462, 0x945e, 0x946a, 0x9229, 0x9470,
+	0x9475, 0x9477, 0x947d, 0x945a, 0x947c, 0x947e, 0x9481, 0x947f,
+	0x9582, 0x9587, 0x958a, 0x9594, 0x9596, 0x9598, 0x9599, 0x95a0,
+	0x95a8, 0x95a7, 0x95ad, 0x95bc, 0x95bb, 0x95b9, 0x95be, 0x95ca,
+	0x6ff6, 0x95c3, 0x95cd, 0x95cc, 0x95d5, 0x95d4, 0x95d6, 0x95dc,
+	0x95e1, 0x95e5, 0x95e2, 0x9621, 0x9628, 0x962e, 0x962f, 0x9642,
+	0x964c, 0x964f, 0x964b, 0x9677, 0x965c, 0x965e,
+	// plane 1 row 80
+	0x965d, 0x965f, 0x9666, 0x9672, 0x966c, 0x968d, 0x9698, 0x9695,
+	0x9697, 0x96aa, 0x96a7, 0x96b1, 0x96b2, 0x96b0, 0x96b4, 0x96b6,
+	0x96b8, 0x96b9, 0x96ce, 0x96cb, 0x96c9, 0x96cd, 0x894d, 0x96dc,
+	0x970d, 0x96d5, 0x96f9, 0x9704, 0x9706, 0x9708, 0x9713, 0x970e,
+	0x9711, 0x970f, 0x9716, 0x9719, 0x9724, 0x972a, 0x9730, 0x9739,
+	0x973d, 0x973e, 0x9744, 0x9746, 0x9748, 0x9742, 0x9749, 0x975c,
+	0x9760, 0x9764, 0x9766, 0x9768, 0x52d2, 0x976b, 0x9771, 0x9779,
+	0x9785, 0x977c, 0x9781, 0x977a, 0x9786, 0x978b, 0x978f, 0x9790,
+	0x979c, 0x97a8, 0x97a6, 0x97a3, 0x97b3, 0x97b4, 0x97c3, 0x97c6,
+	0x97c8, 0x97cb, 0x97dc, 0x97ed, 0x9f4f, 0x97f2, 0x7adf, 0x97f6,
+	0x97f5, 0x980f, 0x980c, 0x9838, 0x9824, 0x9821, 0x9837, 0x983d,
+	0x9846, 0x984f, 0x984b, 0x986b, 0x986f, 0x9870,
+	// plane 1 row 81
+	0x9871, 0x9874, 0x9873, 0x98aa, 0x98af, 0x98b1, 0x98b6, 0x98c4,
+	0x98c3, 0x98c6, 0x98e9, 0x98eb, 0x9903, 0x9909, 0x9912, 0x9914,
+	0x9918, 0x9921, 0x991d, 0x991e, 0x9924, 0x9920, 0x992c, 0x992e,
+	0x993d, 0x993e, 0x9942, 0x9949, 0x9945, 0x9950, 0x994b, 0x9951,
+	0x9952, 0x994c, 0x9955, 0x9997, 0x9998, 0x99a5, 0x99ad, 0x99ae,
+	0x99bc, 0x99df, 0x99db, 0x99dd, 0x99d8, 0x99d1, 0x99ed, 0x99ee,
+	0x99f1, 0x99f2, 0x99fb, 0x99f8, 0x9a01, 0x9a0f, 0x9a05, 0x99e2,
+	0x9a19, 0x9a2b, 0x9a37, 0x9a45, 0x9a42, 0x9a40, 0x9a43, 0x9a3e,
+	0x9a55, 0x9a4d, 0x9a5b, 0x9a57, 0x9a5f, 0x9a62, 0x9a65, 0x9a64,
+	0x9a69, 0x9a6b, 0x9a6a, 0x9aad, 0x9ab0, 0x9abc, 0x9ac0, 0x9acf,
+	0x9ad1, 0x9ad3, 0x9ad4, 0x9ade, 0x9adf, 0x9ae2, 0x9ae3, 0x9ae6,
+	0x9aef, 0x9aeb, 0x9aee, 0x9af4, 0x9af1, 0x9af7,
+	// plane 1 row 82
+	0x9afb, 0x9b06, 0x9b18, 0x9b1a, 0x9b1f, 0x9b22, 0x9b23, 0x9b25,
+	0x9b27, 0x9b28, 0x9b29, 0x9b2a, 0x9b2e, 0x9b2f, 0x9b32, 0x9b44,
+	0x9b43, 0x9b4f, 0x9b4d, 0x9b4e, 0x9b51, 0x9b58, 0x9b74, 0x9b93,
+	0x9b83, 0x9b91, 0x9b96, 0x9b97, 0x9b9f, 0x9ba0, 0x9ba8, 0x9bb4,
+	0x9bc0, 0x9bca, 0x9bb9, 0x9bc6, 0x9bcf, 0x9bd1, 0x9bd2, 0x9be3,
+	0x9be2, 0x9be4, 0x9bd4, 0x9be1, 0x9c3a, 0x9bf2, 0x9bf1, 0x9bf0,
+	0x9c15, 0x9c14, 0x9c09, 0x9c13, 0x9c0c, 0x9c06, 0x9c08, 0x9c12,
+	0x9c0a, 0x9c04, 0x9c2e, 0x9c1b, 0x9c25, 0x9c24, 0x9c21, 0x9c30,
+	0x9c47, 0x9c32, 0x9c46, 0x9c3e, 0x9c5a, 0x9c60, 0x9c67, 0x9c76,
+	0x9c78, 0x9ce7, 0x9cec, 0x9cf0, 0x9d09, 0x9d08, 0x9ceb, 0x9d03,
+	0x9d06, 0x9d2a, 0x9d26, 0x9daf, 0x9d23, 0x9d1f, 0x9d44, 0x9d15,
+	0x9d12, 0x9d41, 0x9d3f, 0x9d3e, 0x9d46, 0x9d48,
+	// plane 1 row 83
+	0x9d5d, 0x9d5e, 0x9d64, 0x9d51, 0x9d50, 0x9d59, 0x9d72, 0x9d89,
+	0x9d87, 0x9dab, 0x9d6f, 0x9d7a, 0x9d9a, 0x9da4, 0x9da9, 0x9db2,
+	0x9dc4, 0x9dc1, 0x9dbb, 0x9db8, 0x9dba, 0x9dc6, 0x9dcf, 0x9dc2,
+	0x9dd9, 0x9dd3, 0x9df8, 0x9de6, 0x9ded, 0x9def, 0x9dfd, 0x9e1a,
+	0x9e1b, 0x9e1e, 0x9e75, 0x9e79, 0x9e7d, 0x9e81, 0x9e88, 0x9e8b,
+	0x9e8c, 0x9e92, 0x9e95, 0x9e91, 0x9e9d, 0x9ea5, 0x9ea9, 0x9eb8,
+	0x9eaa, 0x9ead, 0x9761, 0x9ecc, 0x9ece, 0x9ecf, 0x9ed0, 0x9ed4,
+	0x9edc, 0x9ede, 0x9edd, 0x9ee0, 0x9ee5, 0x9ee8, 0x9eef, 0x9ef4,
+	0x9ef6, 0x9ef7, 0x9ef9, 0x9efb, 0x9efc, 0x9efd, 0x9f07, 0x9f08,
+	0x76b7, 0x9f15, 0x9f21, 0x9f2c, 0x9f3e, 0x9f4a, 0x9f52, 0x9f54,
+	0x9f63, 0x9f5f, 0x9f60, 0x9f61, 0x9f66, 0x9f67, 0x9f6c, 0x9f6a,
+	0x9f77, 0x9f72, 0x9f76, 0x9f95, 0x9f9c, 0x9fa0,
+	// plane 1 row 84
+	0x582f, 0x69c7, 0x9059, 0x7464, 0x51dc, 0x7199, 0x5653, 0x5de2,
+	0x5e14, 0x5e18, 0x5e58, 0x5e5e, 0x5ebe, 0xf928, 0x5ecb, 0x5ef9,
+	0x5f00, 0x5f02, 0x5f07, 0x5f1d, 0x5f23, 0x5f34, 0x5f36, 0x5f3d,
+	0x5f40, 0x5f45, 0x5f54, 0x5f58, 0x5f64, 0x5f67, 0x5f7d, 0x5f89,
+	0x5f9c, 0x5fa7, 0x5faf, 0x5fb5, 0x5fb7, 0x5fc9, 0x5fde, 0x5fe1,
+	0x5fe9, 0x600d, 0x6014, 0x6018, 0x6033, 0x6035, 0x6047, 0xfa3d,
+	0x609d, 0x609e, 0x60cb, 0x60d4, 0x60d5, 0x60dd, 0x60f8, 0x611c,
+	0x612b, 0x6130, 0x6137, 0xfa3e, 0x618d, 0xfa3f, 0x61bc, 0x61b9,
+	0xfa40, 0x6222, 0x623e, 0x6243, 0x6256, 0x625a, 0x626f, 0x6285,
+	0x62c4, 0x62d6, 0x62fc, 0x630a, 0x6318, 0x6339, 0x6343, 0x6365,
+	0x637c, 0x63e5, 0x63ed, 0x63f5, 0x6410, 0x6414, 0x6422, 0x6479,
+	0x6451, 0x6460, 0x646d, 0x64ce, 0x64be, 0x64bf,
+	// plane 1 row 85
+	0x64c4, 0x64ca, 0x64d0, 0x64f7, 0x64fb, 0x6522, 0x6529, 0xfa41,
+	0x6567, 0x659d, 0xfa42, 0x6600, 0x6609, 0x6615, 0x661e, 0x663a,
+	0x6622, 0x6624, 0x662b, 0x6630, 0x6631, 0x6633, 0x66fb, 0x6648,
+	0x664c, 0xd808, 0x6659, 0x665a, 0x6661, 0x6665, 0x6673, 0x6677,
+	0x6678, 0x668d, 0xfa43, 0x66a0, 0x66b2, 0x66bb, 0x66c6, 0x66c8,
+	0x3b22, 0x66db, 0x66e8, 0x66fa, 0x6713, 0xf929, 0x6733, 0x6766,
+	0x6747, 0x6748, 0x677b, 0x6781, 0x6793, 0x6798, 0x679b, 0x67bb,
+	0x67f9, 0x67c0, 0x67d7, 0x67fc, 0x6801, 0x6852, 0x681d, 0x682c,
+	0x6831, 0x685b, 0x6872, 0x6875, 0xfa44, 0x68a3, 0x68a5, 0x68b2,
+	0x68c8, 0x68d0, 0x68e8, 0x68ed, 0x68f0, 0x68f1, 0x68fc, 0x690a,
+	0x6949, 0xd809, 0x6935, 0x6942, 0x6957, 0x6963, 0x6964, 0x6968,
+	0x6980, 0xfa14, 0x69a5, 0x69ad, 0x69cf, 0x3bb6,
+	// plane 1 row 86
+	0x3bc3, 0x69e2, 0x69e9, 0x69ea, 0x69f5, 0x69f6, 0x6a0f, 0x6a15,
+	0xd80a, 0x6a3b, 0x6a3e, 0x6a45, 0x6a50, 0x6a56, 0x6a5b, 0x6a6b,
+	0x6a73, 0xd80b, 0x6a89, 0x6a94, 0x6a9d, 0x6a9e, 0x6aa5, 0x6ae4,
+	0x6ae7, 0x3c0f, 0xf91d, 0x6b1b, 0x6b1e, 0x6b2c, 0x6b35, 0x6b46,
+	0x6b56, 0x6b60, 0x6b65, 0x6b67, 0x6b77, 0x6b82, 0x6ba9, 0x6bad,
+	0xf970, 0x6bcf, 0x6bd6, 0x6bd7, 0x6bff, 0x6c05, 0x6c10, 0x6c33,
+	0x6c59, 0x6c5c, 0x6caa, 0x6c74, 0x6c76, 0x6c85, 0x6c86, 0x6c98,
+	0x6c9c, 0x6cfb, 0x6cc6, 0x6cd4, 0x6ce0, 0x6ceb, 0x6cee, 0xd80c,
+	0x6d04, 0x6d0e, 0x6d2e, 0x6d31, 0x6d39, 0x6d3f, 0x6d58, 0x6d65,
+	0xfa45, 0x6d82, 0x6d87, 0x6d89, 0x6d94, 0x6daa, 0x6dac, 0x6dbf,
+	0x6dc4, 0x6dd6, 0x6dda, 0x6ddb, 0x6ddd, 0x6dfc, 0xfa46, 0x6e34,
+	0x6e44, 0x6e5c, 0x6e5e, 0x6eab, 0x6eb1, 0x6ec1,
+	// plane 1 row 87
+	0x6ec7, 0x6ece, 0x6f10, 0x6f1a, 0xfa47, 0x6f2a, 0x6f2f, 0x6f33,
+	0x6f51, 0x6f59, 0x6f5e, 0x6f61, 0x6f62, 0x6f7e, 0x6f88, 0x6f8c,
+	0x6f8d, 0x6f94, 0x6fa0, 0x6fa7, 0x6fb6, 0x6fbc, 0x6fc7, 0x6fca,
+	0x6ff9, 0x6ff0, 0x6ff5, 0x7005, 0x7006, 0x7028, 0x704a, 0x705d,
+	0x705e, 0x704e, 0x7064, 0x7075, 0x7085, 0x70a4, 0x70ab, 0x70b7,
+	0x70d4, 0x70d8, 0x70e4, 0x710f, 0x712b, 0x711e, 0x7120, 0x712e,
+	0x7130, 0x7146, 0x7147, 0x7151, 0xfa48, 0x7152, 0x715c, 0x7160,
+	0x7168, 0xfa15, 0x7185, 0x7187, 0x7192, 0x71c1, 0x71ba, 0x71c4,
+	0x71fe, 0x7200, 0x7215, 0x7255, 0x7256, 0x3e3f, 0x728d, 0x729b,
+	0x72be, 0x72c0, 0x72fb, 0xd80d, 0x7327, 0x7328, 0xfa16, 0x7350,
+	0x7366, 0x737c, 0x7395, 0x739f, 0x73a0, 0x73a2, 0x73a6, 0x73ab,
+	0x73c9, 0x73cf, 0x73d6, 0x73d9, 0x73e3, 0x73e9,
+	// plane 1 row 88
+	0x7407, 0x740a, 0x741a, 0x741b, 0xfa4a, 0x7426, 0x7428, 0x742a,
+	0x742b, 0x742c, 0x742e, 0x742f, 0x7430, 0x7444, 0x7446, 0x7447,
+	0x744b, 0x7457, 0x7462, 0x746b, 0x746d, 0x7486, 0x7487, 0x7489,
+	0x7498, 0x749c, 0x749f, 0x74a3, 0x7490, 0x74a6, 0x74a8, 0x74a9,
+	0x74b5, 0x74bf, 0x74c8, 0x74c9, 0x74da, 0x74ff, 0x7501, 0x7517,
+	0x752f, 0x756f, 0x7579, 0x7592, 0x3f72, 0x75ce, 0x75e4, 0x7600,
+	0x7602, 0x7608, 0x7615, 0x7616, 0x7619, 0x761e, 0x762d, 0x7635,
+	0x7643, 0x764b, 0x7664, 0x7665, 0x766d, 0x766f, 0x7671, 0x7681,
+	0x769b, 0x769d, 0x769e, 0x76a6, 0x76aa, 0x76b6, 0x76c5, 0x76cc,
+	0x76ce, 0x76d4, 0x76e6, 0x76f1, 0x76fc, 0x770a, 0x7719, 0x7734,
+	0x7736, 0x7746, 0x774d, 0x774e, 0x775c, 0x775f, 0x7762, 0x777a,
+	0x7780, 0x7794, 0x77aa, 0x77e0, 0x782d, 0xd80e,
+	// plane 1 row 89
+	0x7843, 0x784e, 0x784f, 0x7851, 0x7868, 0x786e, 0xfa4b, 0x78b0,
+	0xd80f, 0x78ad, 0x78e4, 0x78f2, 0x7900, 0x78f7, 0x791c, 0x792e,
+	0x7931, 0x7934, 0xfa4c, 0xfa4d, 0x7945, 0x7946, 0xfa4e, 0xfa4f,
+	0xfa50, 0x795c, 0xfa51, 0xfa19, 0xfa1a, 0x7979, 0xfa52, 0xfa53,
+	0xfa1b, 0x7998, 0x79b1, 0x79b8, 0x79c8, 0x79ca, 0xd810, 0x79d4,
+	0x79de, 0x79eb, 0x79ed, 0x7a03, 0xfa54, 0x7a39, 0x7a5d, 0x7a6d,
+	0xfa55, 0x7a85, 0x7aa0, 0xd811, 0x7ab3, 0x7abb, 0x7ace, 0x7aeb,
+	0x7afd, 0x7b12, 0x7b2d, 0x7b3b, 0x7b47, 0x7b4e, 0x7b60, 0x7b6d,
+	0x7b6f, 0x7b72, 0x7b9e, 0xfa56, 0x7bd7, 0x7bd9, 0x7c01, 0x7c31,
+	0x7c1e, 0x7c20, 0x7c33, 0x7c36, 0x4264, 0xd812, 0x7c59, 0x7c6d,
+	0x7c79, 0x7c8f, 0x7c94, 0x7ca0, 0x7cbc, 0x7cd5, 0x7cd9, 0x7cdd,
+	0x7d07, 0x7d08, 0x7d13, 0x7d1d, 0x7d23, 0x7d31,
+	// plane 1 row 90
+	0x7d41, 0x7d48, 0x7d53, 0x7d5c, 0x7d7a, 0x7d83, 0x7d8b, 0x7da0,
+	0x7da6, 0x7dc2, 0x7dcc, 0x7dd6, 0x7de3, 0xfa57, 0x7e28, 0x7e08,
+	0x7e11, 0x7e15, 0xfa59, 0x7e47, 0x7e52, 0x7e61, 0x7e8a, 0x7e8d,
+	0x7f47, 0xfa5a, 0x7f91, 0x7f97, 0x7fbf, 0x7fce, 0x7fdb, 0x7fdf,
+	0x7fec, 0x7fee, 0x7ffa, 0xfa5b, 0x8014, 0x8026, 0x8035, 0x8037,
+	0x803c, 0x80ca, 0x80d7, 0x80e0, 0x80f3, 0x8118, 0x814a, 0x8160,
+	0x8167, 0x8168, 0x816d, 0x81bb, 0x81ca, 0x81cf, 0x81d7, 0xfa5c,
+	0x4453, 0x445b, 0x8260, 0x8274, 0xd813, 0x828e, 0x82a1, 0x82a3,
+	0x82a4, 0x82a9, 0x82ae, 0x82b7, 0x82be, 0x82bf, 0x82c6, 0x82d5,
+	0x82fd, 0x82fe, 0x8300, 0x8301, 0x8362, 0x8322, 0x832d, 0x833a,
+	0x8343, 0x8347, 0x8351, 0x8355, 0x837d, 0x8386, 0x8392, 0x8398,
+	0x83a7, 0x83a9, 0x83bf, 0x83c0, 0x83c7, 0x83cf,
+	// plane 1 row 91
+	0x83d1, 0x83e1, 0x83ea, 0x8401, 0x8406, 0x840a, 0xfa5f, 0x8448,
+	0x845f, 0x8470, 0x8473, 0x8485, 0x849e, 0x84af, 0x84b4, 0x84ba,
+	0x84c0, 0x84c2, 0xd814, 0x8532, 0x851e, 0x8523, 0x852f, 0x8559,
+	0x8564, 0xfa1f, 0x85ad, 0x857a, 0x858c, 0x858f, 0x85a2, 0x85b0,
+	0x85cb, 0x85ce, 0x85ed, 0x8612, 0x85ff, 0x8604, 0x8605, 0x8610,
+	0xd815, 0x8618, 0x8629, 0x8638, 0x8657, 0x865b, 0xf936, 0x8662,
+	0x459d, 0x866c, 0x8675, 0x8698, 0x86b8, 0x86fa, 0x86fc, 0x86fd,
+	0x870b, 0x8771, 0x8787, 0x8788, 0x87ac, 0x87ad, 0x87b5, 0x45ea,
+	0x87d6, 0x87ec, 0x8806, 0x880a, 0x8810, 0x8814, 0x881f, 0x8898,
+	0x88aa, 0x88ca, 0x88ce, 0xd816, 0x88f5, 0x891c, 0xfa60, 0x8918,
+	0x8919, 0x891a, 0x8927, 0x8930, 0x8932, 0x8939, 0x8940, 0x8994,
+	0xfa61, 0x89d4, 0x89e5, 0x89f6, 0x8a12, 0x8a15,
+	// plane 1 row 92
+	0x8a22, 0x8a37, 0x8a47, 0x8a4e, 0x8a5d, 0x8a61, 0x8a75, 0x8a79,
+	0x8aa7, 0x8ad0, 0x8adf, 0x8af4, 0x8af6, 0xfa22, 0xfa62, 0xfa63,
+	0x8b46, 0x8b54, 0x8b59, 0x8b69, 0x8b9d, 0x8c49, 0x8c68, 0xfa64,
+	0x8ce1, 0x8cf4, 0x8cf8, 0x8cfe, 0xfa65, 0x8d12, 0x8d1b, 0x8daf,
+	0x8dce, 0x8dd1, 0x8dd7, 0x8e20, 0x8e23, 0x8e3d, 0x8e70, 0x8e7b,
+	0xd817, 0x8ec0, 0x4844, 0x8efa, 0x8f1e, 0x8f2d, 0x8f36, 0x8f54,
+	0xd818, 0x8fa6, 0x8fb5, 0x8fe4, 0x8fe8, 0x8fee, 0x9008, 0x902d,
+	0xfa67, 0x9088, 0x9095, 0x9097, 0x9099, 0x909b, 0x90a2, 0x90b3,
+	0x90be, 0x90c4, 0x90c5, 0x90c7, 0x90d7, 0x90dd, 0x90de, 0x90ef,
+	0x90f4, 0xfa26, 0x9114, 0x9115, 0x9116, 0x9122, 0x9123, 0x9127,
+	0x912f, 0x9131, 0x9134, 0x913d, 0x9148, 0x915b, 0x9183, 0x919e,
+	0x91ac, 0x91b1, 0x91bc, 0x91d7, 0x91fb, 0x91e4,
+	// plane 1 row 93
+	0x91e5, 0x91ed, 0x91f1, 0x9207, 0x9210, 0x9238, 0x9239, 0x923a,
+	0x923c, 0x9240, 0x9243, 0x924f, 0x9278, 0x9288, 0x92c2, 0x92cb,
+	0x92cc, 0x92d3, 0x92e0, 0x92ff, 0x9304, 0x931f, 0x9321, 0x9325,
+	0x9348, 0x9349, 0x934a, 0x9364, 0x9365, 0x936a, 0x9370, 0x939b,
+	0x93a3, 0x93ba, 0x93c6, 0x93de, 0x93df, 0x9404, 0x93fd, 0x9433,
+	0x944a, 0x9463, 0x946b, 0x9471, 0x9472, 0x958e, 0x959f, 0x95a6,
+	0x95a9, 0x95ac, 0x95b6, 0x95bd, 0x95cb, 0x95d0, 0x95d3, 0x49b0,
+	0x95da, 0x95de, 0x9658, 0x9684, 0xf9dc, 0x969d, 0x96a4, 0x96a5,
+	0x96d2, 0x96de, 0xfa68, 0x96e9, 0x96ef, 0x9733, 0x973b, 0x974d,
+	0x974e, 0x974f, 0x975a, 0x976e, 0x9773, 0x9795, 0x97ae, 0x97ba,
+	0x97c1, 0x97c9, 0x97de, 0x97db, 0x97f4, 0xfa69, 0x980a, 0x981e,
+	0x982b, 0x9830, 0xfa6a, 0x9852, 0x9853, 0x9856,
+	// plane 1 row 94
+	0x9857, 0x9859, 0x985a, 0xf9d0, 0x9865, 0x986c, 0x98ba, 0x98c8,
+	0x98e7, 0x9958, 0x999e, 0x9a02, 0x9a03, 0x9a24, 0x9a2d, 0x9a2e,
+	0x9a38, 0x9a4a, 0x9a4e, 0x9a52, 0x9ab6, 0x9ac1, 0x9ac3, 0x9ace,
+	0x9ad6, 0x9af9, 0x9b02, 0x9b08, 0x9b20, 0x4c17, 0x9b2d, 0x9b5e,
+	0x9b79, 0x9b66, 0x9b72, 0x9b75, 0x9b84, 0x9b8a, 0x9b8f, 0x9b9e,
+	0x9ba7, 0x9bc1, 0x9bce, 0x9be5, 0x9bf8, 0x9bfd, 0x9c00, 0x9c23,
+	0x9c41, 0x9c4f, 0x9c50, 0x9c53, 0x9c63, 0x9c65, 0x9c77, 0x9d1d,
+	0x9d1e, 0x9d43, 0x9d47, 0x9d52, 0x9d63, 0x9d70, 0x9d7c, 0x9d8a,
+	0x9d96, 0x9dc0, 0x9dac, 0x9dbc, 0x9dd7, 0xd819, 0x9de7, 0x9e07,
+	0x9e15, 0x9e7c, 0x9e9e, 0x9ea4, 0x9eac, 0x9eaf, 0x9eb4, 0x9eb5,
+	0x9ec3, 0x9ed1, 0x9f10, 0x9f39, 0x9f57, 0x9f90, 0x9f94, 0x9f97,
+	0x9fa2, 0x59f8, 0x5c5b, 0x5e77, 0x7626, 0x7e6b,
+	// plane 2 row 1
+	0xd81a, 0x4e02, 0x4e0f, 0x4e12, 0x4e29, 0x4e2b, 0x4e2e, 0x4e40,
+	0x4e47, 0x4e48, 0xd81b, 0x4e51, 0x3406, 0xd81c, 0x4e5a, 0x4e69,
+	0x4e9d, 0x342c, 0x342e, 0x4eb9, 0x4ebb, 0xd81d, 0x4ebc, 0x4ec3,
+	0x4ec8, 0x4ed0, 0x4eeb, 0x4eda, 0x4ef1, 0x4ef5, 0x4f00, 0x4f16,
+	0x4f64, 0x4f37, 0x4f3e, 0x4f54, 0x4f58, 0xd81e, 0x4f77, 0x4f78,
+	0x4f7a, 0x4f7d, 0x4f82, 0x4f85, 0x4f92, 0x4f9a, 0x4fe6, 0x4fb2,
+	0x4fbe, 0x4fc5, 0x4fcb, 0x4fcf, 0x4fd2, 0x346a, 0x4ff2, 0x5000,
+	0x5010, 0x5013, 0x501c, 0x501e, 0x5022, 0x3468, 0x5042, 0x5046,
+	0x504e, 0x5053, 0x5057, 0x5063, 0x5066, 0x506a, 0x5070, 0x50a3,
+	0x5088, 0x5092, 0x5093, 0x5095, 0x5096, 0x509c, 0x50aa, 0xd81f,
+	0x50b1, 0x50ba, 0x50bb, 0x50c4, 0x50c7, 0x50f3, 0xd820, 0x50ce,
+	0xd821, 0x50d4, 0x50d9, 0x50e1, 0x50e9, 0x3492,
+	// plane 2 row 2
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 3
+	0x5108, 0xd822, 0x5117, 0x511b, 0xd823, 0x5160, 0xd824, 0x5173,
+	0x5183, 0x518b, 0x34bc, 0x5198, 0x51a3, 0x51ad, 0x34c7, 0x51bc,
+	0xd825, 0xd826, 0x51f3, 0x51f4, 0x5202, 0x5212, 0x5216, 0xd827,
+	0x5255, 0x525c, 0x526c, 0x5277, 0x5284, 0x5282, 0xd828, 0x5298,
+	0xd829, 0x52a4, 0x52a6, 0x52af, 0x52ba, 0x52bb, 0x52ca, 0x351f,
+	0x52d1, 0xd82a, 0x52f7, 0x530a, 0x530b, 0x5324, 0x5335, 0x533e,
+	0x5342, 0xd82b, 0xd82c, 0x5367, 0x536c, 0x537a, 0x53a4, 0x53b4,
+	0xd82d, 0x53b7, 0x53c0, 0xd82e, 0x355d, 0x355e, 0x53d5, 0x53da,
+	0x3563, 0x53f4, 0x53f5, 0x5455, 0x5424, 0x5428, 0x356e, 0x5443,
+	0x5462, 0x5466, 0x546c, 0x548a, 0x548d, 0x5495, 0x54a0, 0x54a6,
+	0x54ad, 0x54ae, 0x54b7, 0x54ba, 0x54bf, 0x54c3, 0xd82f, 0x54ec,
+	0x54ef, 0x54f1, 0x54f3, 0x5500, 0x5501, 0x5509,
+	// plane 2 row 4
+	0x553c, 0x5541, 0x35a6, 0x5547, 0x554a, 0x35a8, 0x5560, 0x5561,
+	0x5564, 0xd830, 0x557d, 0x5582, 0x5588, 0x5591, 0x35c5, 0x55d2,
+	0xd831, 0xd832, 0x55bf, 0x55c9, 0x55cc, 0x55d1, 0x55dd, 0x35da,
+	0x55e2, 0xd833, 0x55e9, 0x5628, 0xd834, 0x5607, 0x5610, 0x5630,
+	0x5637, 0x35f4, 0x563d, 0x563f, 0x5640, 0x5647, 0x565e, 0x5660,
+	0x566d, 0x3605, 0x5688, 0x568c, 0x5695, 0x569a, 0x569d, 0x56a8,
+	0x56ad, 0x56b2, 0x56c5, 0x56cd, 0x56df, 0x56e8, 0x56f6, 0x56f7,
+	0xd835, 0x5715, 0x5723, 0xd836, 0x5729, 0xd837, 0x5745, 0x5746,
+	0x574c, 0x574d, 0xd838, 0x5768, 0x576f, 0x5773, 0x5774, 0x5775,
+	0x577b, 0xd839, 0xd83a, 0x57ac, 0x579a, 0x579d, 0x579e, 0x57a8,
+	0x57d7, 0xd83b, 0x57cc, 0xd83c, 0xd83d, 0x57de, 0x57e6, 0x57f0,
+	0x364a, 0x57f8, 0x57fb, 0x57fd, 0x5804, 0x581e,
+	// plane 2 row 5
+	0x5820, 0x5827, 0x5832, 0x5839, 0xd83e, 0x5849, 0x584c, 0x5867,
+	0x588a, 0x588b, 0x588d, 0x588f, 0x5890, 0x5894, 0x589d, 0x58aa,
+	0x58b1, 0xd83f, 0x58c3, 0x58cd, 0x58e2, 0x58f3, 0x58f4, 0x5905,
+	0x5906, 0x590b, 0x590d, 0x5914, 0x5924, 0xd840, 0x3691, 0x593d,
+	0x3699, 0x5946, 0x3696, 0xd841, 0x595b, 0x595f, 0xd842, 0x5975,
+	0x5976, 0x597c, 0x599f, 0x59ae, 0x59bc, 0x59c8, 0x59cd, 0x59de,
+	0x59e3, 0x59e4, 0x59e7, 0x59ee, 0xd843, 0xd844, 0x36cf, 0x5a0c,
+	0x5a0d, 0x5a17, 0x5a27, 0x5a2d, 0x5a55, 0x5a65, 0x5a7a, 0x5a8b,
+	0x5a9c, 0x5a9f, 0x5aa0, 0x5aa2, 0x5ab1, 0x5ab3, 0x5ab5, 0x5aba,
+	0x5abf, 0x5ada, 0x5adc, 0x5ae0, 0x5ae5, 0x5af0, 0x5aee, 0x5af5,
+	0x5b00, 0x5b08, 0x5b17, 0x5b34, 0x5b2d, 0x5b4c, 0x5b52, 0x5b68,
+	0x5b6f, 0x5b7c, 0x5b7f, 0x5b81, 0x5b84, 0xd845,
+	// plane 2 row 6
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 7
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 8
+	0x5b96, 0x5bac, 0x3761, 0x5bc0, 0x3762, 0x5bce, 0x5bd6, 0x376c,
+	0x376b, 0x5bf1, 0x5bfd, 0x3775, 0x5c03, 0x5c29, 0x5c30, 0xd846,
+	0x5c5f, 0x5c63, 0x5c67, 0x5c68, 0x5c69, 0x5c70, 0xd847, 0xd848,
+	0x5c7c, 0xd849, 0xd84a, 0x5c88, 0x5c8a, 0x37c1, 0xd84b, 0xd84c,
+	0x5ca0, 0x5ca2, 0x5ca6, 0x5ca7, 0xd84d, 0x5cad, 0x5cb5, 0xd84e,
+	0x5cc9, 0xd84f, 0xd850, 0x5d06, 0x5d10, 0x5d2b, 0x5d1d, 0x5d20,
+	0x5d24, 0x5d26, 0x5d31, 0x5d39, 0x5d42, 0x37e8, 0x5d61, 0x5d6a,
+	0x37f4, 0x5d70, 0xd851, 0x37fd, 0x5d88, 0x3800, 0x5d92, 0x5d94,
+	0x5d97, 0x5d99, 0x5db0, 0x5db2, 0x5db4, 0xd852, 0x5db9, 0x5dd1,
+	0x5dd7, 0x5dd8, 0x5de0, 0xd853, 0x5de4, 0x5de9, 0x382f, 0x5e00,
+	0x3836, 0x5e12, 0x5e15, 0x3840, 0x5e1f, 0x5e2e, 0x5e3e, 0x5e49,
+	0x385c, 0x5e56, 0x3861, 0x5e6b, 0x5e6c, 0x5e6d,
+	// plane 2 row 9
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 10
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 11
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 12
+	0x5e6e, 0xd854, 0x5ea5, 0x5eaa, 0x5eac, 0x5eb9, 0x5ebf, 0x5ec6,
+	0x5ed2, 0x5ed9, 0xd855, 0x5efd, 0x5f08, 0x5f0e, 0x5f1c, 0xd856,
+	0x5f1e, 0x5f47, 0x5f63, 0x5f72, 0x5f7e, 0x5f8f, 0x5fa2, 0x5fa4,
+	0x5fb8, 0x5fc4, 0x38fa, 0x5fc7, 0x5fcb, 0x5fd2, 0x5fd3, 0x5fd4,
+	0x5fe2, 0x5fee, 0x5fef, 0x5ff3, 0x5ffc, 0x3917, 0x6017, 0x6022,
+	0x6024, 0x391a, 0x604c, 0x607f, 0x608a, 0x6095, 0x60a8, 0xd857,
+	0x60b0, 0x60b1, 0x60be, 0x60c8, 0x60d9, 0x60db, 0x60ee, 0x60f2,
+	0x60f5, 0x6110, 0x6112, 0x6113, 0x6119, 0x611e, 0x613a, 0x396f,
+	0x6141, 0x6146, 0x6160, 0x617c, 0xd858, 0x6192, 0x6193, 0x6197,
+	0x6198, 0x61a5, 0x61a8, 0x61ad, 0xd859, 0x61d5, 0x61dd, 0x61df,
+	0x61f5, 0xd85a, 0x6215, 0x6223, 0x6229, 0x6246, 0x624c, 0x6251,
+	0x6252, 0x6261, 0x6264, 0x627b, 0x626d, 0x6273,
+	// plane 2 row 13
+	0x6299, 0x62a6, 0x62d5, 0xd85b, 0x62fd, 0x6303, 0x630d, 0x6310,
+	0xd85c, 0xd85d, 0x6332, 0x6335, 0x633b, 0x633c, 0x6341, 0x6344,
+	0x634e, 0xd85e, 0x6359, 0xd85f, 0xd860, 0x636c, 0x6384, 0x6399,
+	0xd861, 0x6394, 0x63bd, 0x63f7, 0x63d4, 0x63d5, 0x63dc, 0x63e0,
+	0x63eb, 0x63ec, 0x63f2, 0x6409, 0x641e, 0x6425, 0x6429, 0x642f,
+	0x645a, 0x645b, 0x645d, 0x6473, 0x647d, 0x6487, 0x6491, 0x649d,
+	0x649f, 0x64cb, 0x64cc, 0x64d5, 0x64d7, 0xd862, 0x64e4, 0x64e5,
+	0x64ff, 0x6504, 0x3a6e, 0x650f, 0x6514, 0x6516, 0x3a73, 0x651e,
+	0x6532, 0x6544, 0x6554, 0x656b, 0x657a, 0x6581, 0x6584, 0x6585,
+	0x658a, 0x65b2, 0x65b5, 0x65b8, 0x65bf, 0x65c2, 0x65c9, 0x65d4,
+	0x3ad6, 0x65f2, 0x65f9, 0x65fc, 0x6604, 0x6608, 0x6621, 0x662a,
+	0x6645, 0x6651, 0x664e, 0x3aea, 0xd863, 0x6657,
+	// plane 2 row 14
+	0x665b, 0x6663, 0xd864, 0xd865, 0x666a, 0x666b, 0x666c, 0x666d,
+	0x667b, 0x6680, 0x6690, 0x6692, 0x6699, 0x3b0e, 0x66ad, 0x66b1,
+	0x66b5, 0x3b1a, 0x66bf, 0x3b1c, 0x66ec, 0x3ad7, 0x6701, 0x6705,
+	0x6712, 0xd866, 0x6719, 0xd867, 0xd868, 0x674c, 0x674d, 0x6754,
+	0x675d, 0xd869, 0xd86a, 0xd86b, 0x6774, 0x6776, 0xd86c, 0x6792,
+	0xd86d, 0x8363, 0x6810, 0x67b0, 0x67b2, 0x67c3, 0x67c8, 0x67d2,
+	0x67d9, 0x67db, 0x67f0, 0x67f7, 0xd86e, 0xd86f, 0xd870, 0x6818,
+	0x681f, 0x682d, 0xd871, 0x6833, 0x683b, 0x683e, 0x6844, 0x6845,
+	0x6849, 0x684c, 0x6855, 0x6857, 0x3b77, 0x686b, 0x686e, 0x687a,
+	0x687c, 0x6882, 0x6890, 0x6896, 0x3b6d, 0x6898, 0x6899, 0x689a,
+	0x689c, 0x68aa, 0x68ab, 0x68b4, 0x68bb, 0x68fb, 0xd872, 0xd873,
+	0xfa13, 0x68c3, 0x68c5, 0x68cc, 0x68cf, 0x68d6,
+	// plane 2 row 15
+	0x68d9, 0x68e4, 0x68e5, 0x68ec, 0x68f7, 0x6903, 0x6907, 0x3b87,
+	0x3b88, 0xd874, 0x693b, 0x3b8d, 0x6946, 0x6969, 0x696c, 0x6972,
+	0x697a, 0x697f, 0x6992, 0x3ba4, 0x6996, 0x6998, 0x69a6, 0x69b0,
+	0x69b7, 0x69ba, 0x69bc, 0x69c0, 0x69d1, 0x69d6, 0xd875, 0xd876,
+	0x6a30, 0xd877, 0xd878, 0x69e3, 0x69ee, 0x69ef, 0x69f3, 0x3bcd,
+	0x69f4, 0x69fe, 0x6a11, 0x6a1a, 0x6a1d, 0xd879, 0x6a32, 0x6a33,
+	0x6a34, 0x6a3f, 0x6a46, 0x6a49, 0x6a7a, 0x6a4e, 0x6a52, 0x6a64,
+	0xd87a, 0x6a7e, 0x6a83, 0x6a8b, 0x3bf0, 0x6a91, 0x6a9f, 0x6aa1,
+	0xd87b, 0x6aab, 0x6abd, 0x6ac6, 0x6ad4, 0x6ad0, 0x6adc, 0x6add,
+	0xd87c, 0xd87d, 0x6aec, 0x6af1, 0x6af2, 0x6af3, 0x6afd, 0xd87e,
+	0x6b0b, 0x6b0f, 0x6b10, 0x6b11, 0xd87f, 0x6b17, 0x3c26, 0x6b2f,
+	0x6b4a, 0x6b58, 0x6b6c, 0x6b75, 0x6b7a, 0x6b81,
+	// plane 2 row 16
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 17
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 18
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 19
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 20
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 21
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 22
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 23
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 24
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 25
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 26
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 27
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 28
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 29
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 30
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 31
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 32
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 33
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 34
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 35
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 36
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 37
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 38
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 39
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 40
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 41
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 42
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 43
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 44
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 45
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 46
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 47
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 48
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 49
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 50
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 51
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 52
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 53
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 54
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 55
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 56
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 57
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 58
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 59
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 60
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 61
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 62
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 63
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 64
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 65
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 66
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 67
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 68
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 69
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 70
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 71
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 72
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 73
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 74
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 75
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 76
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 77
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	// plane 2 row 78
+	0x6b9b, 0x6bae, 0xd880, 0x6bbd, 0x6bbe, 0x6bc7, 0x6bc8, 0x6bc9,
+	0x6bda, 0x6be6, 0x6be7, 0x6bee, 0x6bf1, 0x6c02, 0x6c0a, 0x6c0e,
+	0x6c35, 0x6c36, 0x6c3a, 0xd881, 0x6c3f, 0x6c4d, 0x6c5b, 0x6c6d,
+	0x6c84, 0x6c89, 0x3cc3, 0x6c94, 0x6c95, 0x6c97, 0x6cad, 0x6cc2,
+	0x6cd0, 0x3cd2, 0x6cd6, 0x6cda, 0x6cdc, 0x6ce9, 0x6cec, 0x6ced,
+	0xd882, 0x6d00, 0x6d0a, 0x6d24, 0x6d26, 0x6d27, 0x6c67, 0x6d2f,
+	0x6d3c, 0x6d5b, 0x6d5e, 0x6d60, 0x6d70, 0x6d80, 0x6d81, 0x6d8a,
+	0x6d8d, 0x6d91, 0x6d98, 0xd883, 0x6e17, 0xd884, 0xd885, 0xd886,
+	0x6dab, 0x6dae, 0x6db4, 0x6dc2, 0x6d34, 0x6dc8, 0x6dce, 0x6dcf,
+	0x6dd0, 0x6ddf, 0x6de9, 0x6df6, 0x6e36, 0x6e1e, 0x6e22, 0x6e27,
+	0x3d11, 0x6e32, 0x6e3c, 0x6e48, 0x6e49, 0x6e4b, 0x6e4c, 0x6e4f,
+	0x6e51, 0x6e53, 0x6e54, 0x6e57, 0x6e63, 0x3d1e,
+	// plane 2 row 79
+	0x6e93, 0x6ea7, 0x6eb4, 0x6ebf, 0x6ec3, 0x6eca, 0x6ed9, 0x6f35,
+	0x6eeb, 0x6ef9, 0x6efb, 0x6f0a, 0x6f0c, 0x6f18, 0x6f25, 0x6f36,
+	0x6f3c, 0xd887, 0x6f52, 0x6f57, 0x6f5a, 0x6f60, 0x6f68, 0x6f98,
+	0x6f7d, 0x6f90, 0x6f96, 0x6fbe, 0x6f9f, 0x6fa5, 0x6faf, 0x3d64,
+	0x6fb5, 0x6fc8, 0x6fc9, 0x6fda, 0x6fde, 0x6fe9, 0xd888, 0x6ffc,
+	0x7000, 0x7007, 0x700a, 0x7023, 0xd889, 0x7039, 0x703a, 0x703c,
+	0x7043, 0x7047, 0x704b, 0x3d9a, 0x7054, 0x7065, 0x7069, 0x706c,
+	0x706e, 0x7076, 0x707e, 0x7081, 0x7086, 0x7095, 0x7097, 0x70bb,
+	0xd88a, 0x709f, 0x70b1, 0xd88b, 0x70ec, 0x70ca, 0x70d1, 0x70d3,
+	0x70dc, 0x7103, 0x7104, 0x7106, 0x7107, 0x7108, 0x710c, 0x3dc0,
+	0x712f, 0x7131, 0x7150, 0x714a, 0x7153, 0x715e, 0x3dd4, 0x7196,
+	0x7180, 0x719b, 0x71a0, 0x71a2, 0x71ae, 0x71af,
+	// plane 2 row 80
+	0x71b3, 0xd88c, 0x71cb, 0x71d3, 0x71d9, 0x71dc, 0x7207, 0x3e05,
+	0xfa49, 0x722b, 0x7234, 0x7238, 0x7239, 0x4e2c, 0x7242, 0x7253,
+	0x7257, 0x7263, 0xd88d, 0x726e, 0x726f, 0x7278, 0x727f, 0x728e,
+	0xd88e, 0x72ad, 0x72ae, 0x72b0, 0x72b1, 0x72c1, 0x3e60, 0x72cc,
+	0x3e66, 0x3e68, 0x72f3, 0x72fa, 0x7307, 0x7312, 0x7318, 0x7319,
+	0x3e83, 0x7339, 0x732c, 0x7331, 0x7333, 0x733d, 0x7352, 0x3e94,
+	0x736b, 0x736c, 0xd88f, 0x736e, 0x736f, 0x7371, 0x7377, 0x7381,
+	0x7385, 0x738a, 0x7394, 0x7398, 0x739c, 0x739e, 0x73a5, 0x73a8,
+	0x73b5, 0x73b7, 0x73b9, 0x73bc, 0x73bf, 0x73c5, 0x73cb, 0x73e1,
+	0x73e7, 0x73f9, 0x7413, 0x73fa, 0x7401, 0x7424, 0x7431, 0x7439,
+	0x7453, 0x7440, 0x7443, 0x744d, 0x7452, 0x745d, 0x7471, 0x7481,
+	0x7485, 0x7488, 0xd890, 0x7492, 0x7497, 0x7499,
+	// plane 2 row 81
+	0x74a0, 0x74a1, 0x74a5, 0x74aa, 0x74ab, 0x74b9, 0x74bb, 0x74ba,
+	0x74d6, 0x74d8, 0x74de, 0x74ef, 0x74eb, 0xd891, 0x74fa, 0xd892,
+	0x7520, 0x7524, 0x752a, 0x3f57, 0xd893, 0x753d, 0x753e, 0x7540,
+	0x7548, 0x754e, 0x7550, 0x7552, 0x756c, 0x7572, 0x7571, 0x757a,
+	0x757d, 0x757e, 0x7581, 0xd894, 0x758c, 0x3f75, 0x75a2, 0x3f77,
+	0x75b0, 0x75b7, 0x75bf, 0x75c0, 0x75c6, 0x75cf, 0x75d3, 0x75dd,
+	0x75df, 0x75e0, 0x75e7, 0x75ec, 0x75ee, 0x75f1, 0x75f9, 0x7603,
+	0x7618, 0x7607, 0x760f, 0x3fae, 0xd895, 0x7613, 0x761b, 0x761c,
+	0xd896, 0x7625, 0x7628, 0x763c, 0x7633, 0xd897, 0x3fc9, 0x7641,
+	0xd898, 0x7649, 0x7655, 0x3fd7, 0x766e, 0x7695, 0x769c, 0x76a1,
+	0x76a0, 0x76a7, 0x76a8, 0x76af, 0xd899, 0x76c9, 0xd89a, 0x76e8,
+	0x76ec, 0xd89b, 0x7717, 0x771a, 0x772d, 0x7735,
+	// plane 2 row 82
+	0xd89c, 0x4039, 0xd89d, 0xd89e, 0x7758, 0x7760, 0x776a, 0xd89f,
+	0x7772, 0x777c, 0x777d, 0xd8a0, 0x4058, 0x779a, 0x779f, 0x77a2,
+	0x77a4, 0x77a9, 0x77de, 0x77df, 0x77e4, 0x77e6, 0x77ea, 0x77ec,
+	0x4093, 0x77f0, 0x77f4, 0x77fb, 0xd8a1, 0x7805, 0x7806, 0x7809,
+	0x780d, 0x7819, 0x7821, 0x782c, 0x7847, 0x7864, 0x786a, 0xd8a2,
+	0x788a, 0x7894, 0x78a4, 0x789d, 0x789e, 0x789f, 0x78bb, 0x78c8,
+	0x78cc, 0x78ce, 0x78d5, 0x78e0, 0x78e1, 0x78e6, 0x78f9, 0x78fa,
+	0x78fb, 0x78fe, 0xd8a3, 0x7910, 0x791b, 0x7930, 0x7925, 0x793b,
+	0x794a, 0x7958, 0x795b, 0x4105, 0x7967, 0x7972, 0x7994, 0x7995,
+	0x7996, 0x799b, 0x79a1, 0x79a9, 0x79b4, 0x79bb, 0x79c2, 0x79c7,
+	0x79cc, 0x79cd, 0x79d6, 0x4148, 0xd8a4, 0xd8a5, 0x414f, 0x7a0a,
+	0x7a11, 0x7a15, 0x7a1b, 0x7a1e, 0x4163, 0x7a2d,
+	// plane 2 row 83
+	0x7a38, 0x7a47, 0x7a4c, 0x7a56, 0x7a59, 0x7a5c, 0x7a5f, 0x7a60,
+	0x7a67, 0x7a6a, 0x7a75, 0x7a78, 0x7a82, 0x7a8a, 0x7a90, 0x7aa3,
+	0x7aac, 0xd8a6, 0x41b4, 0x7ab9, 0x7abc, 0x7abe, 0x41bf, 0x7acc,
+	0x7ad1, 0x7ae7, 0x7ae8, 0x7af4, 0xd8a7, 0xd8a8, 0x7b07, 0xd8a9,
+	0x7b3d, 0x7b27, 0x7b2a, 0x7b2e, 0x7b2f, 0x7b31, 0x41e6, 0x41f3,
+	0x7b7f, 0x7b41, 0x41ee, 0x7b55, 0x7b79, 0x7b64, 0x7b66, 0x7b69,
+	0x7b73, 0xd8aa, 0x4207, 0x7b90, 0x7b91, 0x7b9b, 0x420e, 0x7baf,
+	0x7bb5, 0x7bbc, 0x7bc5, 0x7bca, 0xd8ab, 0xd8ac, 0x7bd4, 0x7bd6,
+	0x7bda, 0x7bea, 0x7bf0, 0x7c03, 0x7c0b, 0x7c0e, 0x7c0f, 0x7c26,
+	0x7c45, 0x7c4a, 0x7c51, 0x7c57, 0x7c5e, 0x7c61, 0x7c69, 0x7c6e,
+	0x7c6f, 0x7c70, 0xd8ad, 0xd8ae, 0xd8af, 0x7ca6, 0xd8b0, 0x7cb6,
+	0x7cb7, 0x7cbf, 0xd8b1, 0x7cc4, 0xd8b2, 0x7cc8,
+	// plane 2 row 84
+	0x7ccd, 0xd8b3, 0x7cd7, 0xd8b4, 0x7ce6, 0x7ceb, 0xd8b5, 0x7cf5,
+	0x7d03, 0x7d09, 0x42c6, 0x7d12, 0x7d1e, 0xd8b6, 0xd8b7, 0x7d3d,
+	0x7d3e, 0x7d40, 0x7d47, 0xd8b8, 0xd8b9, 0x42d6, 0x7d59, 0x7d5a,
+	0x7d6a, 0x7d70, 0x42dd, 0x7d7f, 0xd8ba, 0x7d86, 0x7d88, 0x7d8c,
+	0x7d97, 0xd8bb, 0x7d9d, 0x7da7, 0x7daa, 0x7db6, 0x7db7, 0x7dc0,
+	0x7dd7, 0x7dd9, 0x7de6, 0x7df1, 0x7df9, 0x4302, 0xd8bc, 0xfa58,
+	0x7e10, 0x7e17, 0x7e1d, 0x7e20, 0x7e27, 0x7e2c, 0x7e45, 0x7e73,
+	0x7e75, 0x7e7e, 0x7e86, 0x7e87, 0x432b, 0x7e91, 0x7e98, 0x7e9a,
+	0x4343, 0x7f3c, 0x7f3b, 0x7f3e, 0x7f43, 0x7f44, 0x7f4f, 0x34c1,
+	0xd8bd, 0x7f52, 0xd8be, 0x7f61, 0x7f63, 0x7f64, 0x7f6d, 0x7f7d,
+	0x7f7e, 0xd8bf, 0x7f90, 0x517b, 0xd8c0, 0x7f96, 0x7f9c, 0x7fad,
+	0xd8c1, 0x7fc3, 0x7fcf, 0x7fe3, 0x7fe5, 0x7fef,
+	// plane 2 row 85
+	0x7ff2, 0x8002, 0x800a, 0x8008, 0x800e, 0x8011, 0x8016, 0x8024,
+	0x802c, 0x8030, 0x8043, 0x8066, 0x8071, 0x8075, 0x807b, 0x8099,
+	0x809c, 0x80a4, 0x80a7, 0x80b8, 0xd8c2, 0x80c5, 0x80d5, 0x80d8,
+	0x80e6, 0xd8c3, 0x810d, 0x80f5, 0x80fb, 0x43ee, 0x8135, 0x8116,
+	0x811e, 0x43f0, 0x8124, 0x8127, 0x812c, 0xd8c4, 0x813d, 0x4408,
+	0x8169, 0x4417, 0x8181, 0x441c, 0x8184, 0x8185, 0x4422, 0x8198,
+	0x81b2, 0x81c1, 0x81c3, 0x81d6, 0x81db, 0xd8c5, 0x81e4, 0xd8c6,
+	0x81ec, 0xd8c7, 0x81fd, 0x81ff, 0xd8c8, 0x8204, 0xd8c9, 0x8219,
+	0x8221, 0x8222, 0xd8ca, 0x8232, 0x8234, 0x823c, 0x8246, 0x8249,
+	0x8245, 0xd8cb, 0x824b, 0x4476, 0x824f, 0x447a, 0x8257, 0xd8cc,
+	0x825c, 0x8263, 0xd8cd, 0xfa5d, 0xfa5e, 0x8279, 0x4491, 0x827d,
+	0x827f, 0x8283, 0x828a, 0x8293, 0x82a7, 0x82a8,
+	// plane 2 row 86
+	0x82b2, 0x82b4, 0x82ba, 0x82bc, 0x82e2, 0x82e8, 0x82f7, 0x8307,
+	0x8308, 0x830c, 0x8354, 0x831b, 0x831d, 0x8330, 0x833c, 0x8344,
+	0x8357, 0x44be, 0x837f, 0x44d4, 0x44b3, 0x838d, 0x8394, 0x8395,
+	0x839b, 0x839d, 0x83c9, 0x83d0, 0x83d4, 0x83dd, 0x83e5, 0x83f9,
+	0x840f, 0x8411, 0x8415, 0xd8ce, 0x8417, 0x8439, 0x844a, 0x844f,
+	0x8451, 0x8452, 0x8459, 0x845a, 0x845c, 0xd8cf, 0x8465, 0x8476,
+	0x8478, 0x847c, 0x8481, 0x450d, 0x84dc, 0x8497, 0x84a6, 0x84be,
+	0x4508, 0x84ce, 0x84cf, 0x84d3, 0xd8d0, 0x84e7, 0x84ea, 0x84ef,
+	0x84f0, 0x84f1, 0x84fa, 0x84fd, 0x850c, 0x851b, 0x8524, 0x8525,
+	0x852b, 0x8534, 0x854f, 0x856f, 0x4525, 0x4543, 0x853e, 0x8551,
+	0x8553, 0x855e, 0x8561, 0x8562, 0xd8d1, 0x857b, 0x857d, 0x857f,
+	0x8581, 0x8586, 0x8593, 0x859d, 0x859f, 0xd8d2,
+	// plane 2 row 87
+	0xd8d3, 0xd8d4, 0x85b7, 0x85bc, 0x85c7, 0x85ca, 0x85d8, 0x85d9,
+	0x85df, 0x85e1, 0x85e6, 0x85f6, 0x8600, 0x8611, 0x861e, 0x8621,
+	0x8624, 0x8627, 0xd8d5, 0x8639, 0x863c, 0xd8d6, 0x8640, 0xfa20,
+	0x8653, 0x8656, 0x866f, 0x8677, 0x867a, 0x8687, 0x8689, 0x868d,
+	0x8691, 0x869c, 0x869d, 0x86a8, 0xfa21, 0x86b1, 0x86b3, 0x86c1,
+	0x86c3, 0x86d1, 0x86d5, 0x86d7, 0x86e3, 0x86e6, 0x45b8, 0x8705,
+	0x8707, 0x870e, 0x8710, 0x8713, 0x8719, 0x871f, 0x8721, 0x8723,
+	0x8731, 0x873a, 0x873e, 0x8740, 0x8743, 0x8751, 0x8758, 0x8764,
+	0x8765, 0x8772, 0x877c, 0xd8d7, 0xd8d8, 0x87a7, 0x8789, 0x878b,
+	0x8793, 0x87a0, 0xd8d9, 0x45e5, 0x87be, 0xd8da, 0x87c1, 0x87ce,
+	0x87f5, 0x87df, 0xd8db, 0x87e3, 0x87e5, 0x87e6, 0x87ea, 0x87eb,
+	0x87ed, 0x8801, 0x8803, 0x880b, 0x8813, 0x8828,
+	// plane 2 row 88
+	0x882e, 0x8832, 0x883c, 0x460f, 0x884a, 0x8858, 0x885f, 0x8864,
+	0xd8dc, 0xd8dd, 0x8869, 0xd8de, 0x886f, 0x88a0, 0x88bc, 0x88bd,
+	0x88be, 0x88c0, 0x88d2, 0xd8df, 0x88d1, 0x88d3, 0x88db, 0x88f0,
+	0x88f1, 0x4641, 0x8901, 0xd8e0, 0x8937, 0xd8e1, 0x8942, 0x8945,
+	0x8949, 0xd8e2, 0x4665, 0x8962, 0x8980, 0x8989, 0x8990, 0x899f,
+	0x89b0, 0x89b7, 0x89d6, 0x89d8, 0x89eb, 0x46a1, 0x89f1, 0x89f3,
+	0x89fd, 0x89ff, 0x46af, 0x8a11, 0x8a14, 0xd8e3, 0x8a21, 0x8a35,
+	0x8a3e, 0x8a45, 0x8a4d, 0x8a58, 0x8aae, 0x8a90, 0x8ab7, 0x8abe,
+	0x8ad7, 0x8afc, 0xd8e4, 0x8b0a, 0x8b05, 0x8b0d, 0x8b1c, 0x8b1f,
+	0x8b2d, 0x8b43, 0x470c, 0x8b51, 0x8b5e, 0x8b76, 0x8b7f, 0x8b81,
+	0x8b8b, 0x8b94, 0x8b95, 0x8b9c, 0x8b9e, 0x8c39, 0xd8e5, 0x8c3d,
+	0xd8e6, 0xd8e7, 0x8c45, 0x8c47, 0x8c4f, 0x8c54,
+	// plane 2 row 89
+	0x8c57, 0x8c69, 0x8c6d, 0x8c73, 0xd8e8, 0x8c93, 0x8c92, 0x8c99,
+	0x4764, 0x8c9b, 0x8ca4, 0x8cd6, 0x8cd5, 0x8cd9, 0xd8e9, 0x8cf0,
+	0x8cf1, 0xd8ea, 0x8d09, 0x8d0e, 0x8d6c, 0x8d84, 0x8d95, 0x8da6,
+	0xd8eb, 0x8dc6, 0x8dc8, 0x8dd9, 0x8dec, 0x8e0c, 0x47fd, 0x8dfd,
+	0x8e06, 0xd8ec, 0x8e14, 0x8e16, 0x8e21, 0x8e22, 0x8e27, 0xd8ed,
+	0x4816, 0x8e36, 0x8e39, 0x8e4b, 0x8e54, 0x8e62, 0x8e6c, 0x8e6d,
+	0x8e6f, 0x8e98, 0x8e9e, 0x8eae, 0x8eb3, 0x8eb5, 0x8eb6, 0x8ebb,
+	0xd8ee, 0x8ed1, 0x8ed4, 0x484e, 0x8ef9, 0xd8ef, 0x8f00, 0x8f08,
+	0x8f17, 0x8f2b, 0x8f40, 0x8f4a, 0x8f58, 0xd8f0, 0x8fa4, 0x8fb4,
+	0xfa66, 0x8fb6, 0xd8f1, 0x8fc1, 0x8fc6, 0xfa24, 0x8fca, 0x8fcd,
+	0x8fd3, 0x8fd5, 0x8fe0, 0x8ff1, 0x8ff5, 0x8ffb, 0x9002, 0x900c,
+	0x9037, 0xd8f2, 0x9043, 0x9044, 0x905d, 0xd8f3,
+	// plane 2 row 90
+	0xd8f4, 0x9085, 0x908c, 0x9090, 0x961d, 0x90a1, 0x48b5, 0x90b0,
+	0x90b6, 0x90c3, 0x90c8, 0xd8f5, 0x90dc, 0x90df, 0xd8f6, 0x90f6,
+	0x90f2, 0x9100, 0x90eb, 0x90fe, 0x90ff, 0x9104, 0x9106, 0x9118,
+	0x911c, 0x911e, 0x9137, 0x9139, 0x913a, 0x9146, 0x9147, 0x9157,
+	0x9159, 0x9161, 0x9164, 0x9174, 0x9179, 0x9185, 0x918e, 0x91a8,
+	0x91ae, 0x91b3, 0x91b6, 0x91c3, 0x91c4, 0x91da, 0xd8f7, 0xd8f8,
+	0x91ec, 0x91ee, 0x9201, 0x920a, 0x9216, 0x9217, 0xd8f9, 0x9233,
+	0x9242, 0x9247, 0x924a, 0x924e, 0x9251, 0x9256, 0x9259, 0x9260,
+	0x9261, 0x9265, 0x9267, 0x9268, 0xd8fa, 0xd8fb, 0x927c, 0x927d,
+	0x927f, 0x9289, 0x928d, 0x9297, 0x9299, 0x929f, 0x92a7, 0x92ab,
+	0xd8fc, 0xd8fd, 0x92b2, 0x92bf, 0x92c0, 0x92c6, 0x92ce, 0x92d0,
+	0x92d7, 0x92d9, 0x92e5, 0x92e7, 0x9311, 0xd8fe,
+	// plane 2 row 91
+	0xd8ff, 0x92f7, 0x92f9, 0x92fb, 0x9302, 0x930d, 0x9315, 0x931d,
+	0x931e, 0x9327, 0x9329, 0xd900, 0xd901, 0x9347, 0x9351, 0x9357,
+	0x935a, 0x936b, 0x9371, 0x9373, 0x93a1, 0xd902, 0xd903, 0x9388,
+	0x938b, 0x938f, 0x939e, 0x93f5, 0xd904, 0xd905, 0x93f1, 0x93c1,
+	0x93c7, 0x93dc, 0x93e2, 0x93e7, 0x9409, 0x940f, 0x9416, 0x9417,
+	0x93fb, 0x9432, 0x9434, 0x943b, 0x9445, 0xd906, 0xd907, 0x946d,
+	0x946f, 0x9578, 0x9579, 0x9586, 0x958c, 0x958d, 0xd908, 0x95ab,
+	0x95b4, 0xd909, 0x95c8, 0xd90a, 0xd90b, 0x962c, 0x9633, 0x9634,
+	0xd90c, 0x963c, 0x9641, 0x9661, 0xd90d, 0x9682, 0xd90e, 0x969a,
+	0xd90f, 0x49e7, 0x96a9, 0x96af, 0x96b3, 0x96ba, 0x96bd, 0x49fa,
+	0xd910, 0x96d8, 0x96da, 0x96dd, 0x4a04, 0x9714, 0x9723, 0x4a29,
+	0x9736, 0x9741, 0x9747, 0x9755, 0x9757, 0x975b,
+	// plane 2 row 92
+	0x976a, 0xd911, 0xd912, 0x9796, 0x979a, 0x979e, 0x97a2, 0x97b1,
+	0x97b2, 0x97be, 0x97cc, 0x97d1, 0x97d4, 0x97d8, 0x97d9, 0x97e1,
+	0x97f1, 0x9804, 0x980d, 0x980e, 0x9814, 0x9816, 0x4abc, 0xd913,
+	0x9823, 0x9832, 0x9833, 0x9825, 0x9847, 0x9866, 0x98ab, 0x98ad,
+	0x98b0, 0xd914, 0x98b7, 0x98b8, 0x98bb, 0x98bc, 0x98bf, 0x98c2,
+	0x98c7, 0x98cb, 0x98e0, 0xd915, 0x98e1, 0x98e3, 0x98e5, 0x98ea,
+	0x98f0, 0x98f1, 0x98f3, 0x9908, 0x4b3b, 0xd916, 0x9916, 0x9917,
+	0xd917, 0x991a, 0x991b, 0x991c, 0xd918, 0x9931, 0x9932, 0x9933,
+	0x993a, 0x993b, 0x993c, 0x9940, 0x9941, 0x9946, 0x994d, 0x994e,
+	0x995c, 0x995f, 0x9960, 0x99a3, 0x99a6, 0x99b9, 0x99bd, 0x99bf,
+	0x99c3, 0x99c9, 0x99d4, 0x99d9, 0x99de, 0xd919, 0x99f0, 0x99f9,
+	0x99fc, 0x9a0a, 0x9a11, 0x9a16, 0x9a1a, 0x9a20,
+	// plane 2 row 93
+	0x9a31, 0x9a36, 0x9a44, 0x9a4c, 0x9a58, 0x4bc2, 0x9aaf, 0x4bca,
+	0x9ab7, 0x4bd2, 0x9ab9, 0xd91a, 0x9ac6, 0x9ad0, 0x9ad2, 0x9ad5,
+	0x4be8, 0x9adc, 0x9ae0, 0x9ae5, 0x9ae9, 0x9b03, 0x9b0c, 0x9b10,
+	0x9b12, 0x9b16, 0x9b1c, 0x9b2b, 0x9b33, 0x9b3d, 0x4c20, 0x9b4b,
+	0x9b63, 0x9b65, 0x9b6b, 0x9b6c, 0x9b73, 0x9b76, 0x9b77, 0x9ba6,
+	0x9bac, 0x9bb1, 0xd91b, 0xd91c, 0x9bb2, 0x9bb8, 0x9bbe, 0x9bc7,
+	0x9bf3, 0x9bd8, 0x9bdd, 0x9be7, 0x9bea, 0x9beb, 0x9bef, 0x9bee,
+	0xd91d, 0x9bfa, 0xd91e, 0x9bf7, 0xd91f, 0x9c16, 0x9c18, 0x9c19,
+	0x9c1a, 0x9c1d, 0x9c22, 0x9c27, 0x9c29, 0x9c2a, 0xd920, 0x9c31,
+	0x9c36, 0x9c37, 0x9c45, 0x9c5c, 0xd921, 0x9c49, 0x9c4a, 0xd922,
+	0x9c54, 0x9c58, 0x9c5b, 0x9c5d, 0x9c5f, 0x9c69, 0x9c6a, 0x9c6b,
+	0x9c6d, 0x9c6e, 0x9c70, 0x9c72, 0x9c75, 0x9c7a,
+	// plane 2 row 94
+	0x9ce6, 0x9cf2, 0x9d0b, 0x9d02, 0xd923, 0x9d11, 0x9d17, 0x9d18,
+	0xd924, 0x4cc4, 0xd925, 0x9d32, 0x4cd1, 0x9d42, 0x9d4a, 0x9d5f,
+	0x9d62, 0xd926, 0x9d69, 0x9d6b, 0xd927, 0x9d73, 0x9d76, 0x9d77,
+	0x9d7e, 0x9d84, 0x9d8d, 0x9d99, 0x9da1, 0x9dbf, 0x9db5, 0x9db9,
+	0x9dbd, 0x9dc3, 0x9dc7, 0x9dc9, 0x9dd6, 0x9dda, 0x9ddf, 0x9de0,
+	0x9de3, 0x9df4, 0x4d07, 0x9e0a, 0x9e02, 0x9e0d, 0x9e19, 0x9e1c,
+	0x9e1d, 0x9e7b, 0xd928, 0x9e80, 0x9e85, 0x9e9b, 0x9ea8, 0xd929,
+	0x9ebd, 0xd92a, 0x9edf, 0x9ee7, 0x9eee, 0x9eff, 0x9f02, 0x4d77,
+	0x9f03, 0x9f17, 0x9f19, 0x9f2f, 0x9f37, 0x9f3a, 0x9f3d, 0x9f41,
+	0x9f45, 0x9f46, 0x9f53, 0x9f55, 0x9f58, 0xd92b, 0x9f5d, 0xd92c,
+	0x9f69, 0xd92d, 0x9f6d, 0x9f70, 0x9f75, 0xd92e, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd
+	};
+
+	// JIS X 0213 to Unicode (U+10000 and above)
+	inline constexpr int jisx0213_2_unicode_supplementary[303] = {
+	0x02000b, 0x02123d, 0x02131b, 0x02146e, 0x0218bd, 0x020b9f, 0x0216b4, 0x021e34,
+	0x0231c4, 0x0235c4, 0x02373f, 0x023763, 0x023cfe, 0x0247f1, 0x02548e, 0x02550e,
+	0x025771, 0x0259c4, 0x025da1, 0x026aff, 0x026e40, 0x0270f4, 0x027684, 0x028277,
+	0x0283cd, 0x02a190, 0x020089, 0x0200a2, 0x0200a4, 0x0201a2, 0x020213, 0x02032b,
+	0x020381, 0x020371, 0x0203f9, 0x02044a, 0x020509, 0x0205d6, 0x020628, 0x02074f,
+	0x020807, 0x02083a, 0x0208b9, 0x02097c, 0x02099d, 0x020ad3, 0x020b1d, 0x020d45,
+	0x020de1, 0x020e95, 0x020e6d, 0x020e64, 0x020f5f, 0x021201, 0x021255, 0x02127b,
+	0x021274, 0x0212e4, 0x0212d7, 0x0212fd, 0x021336, 0x021344, 0x0213c4, 0x02146d,
+	0x0215d7, 0x026c29, 0x021647, 0x021706, 0x021742, 0x0219c3, 0x021c56, 0x021d2d,
+	0x021d45, 0x021d78, 0x021d62, 0x021da1, 0x021d9c, 0x021d92, 0x021db7, 0x021de0,
+	0x021e33, 0x021f1e, 0x021f76, 0x021ffa, 0x02217b, 0x02231e, 0x0223ad, 0x0226f3,
+	0x02285b, 0x0228ab, 0x02298f, 0x022ab8, 0x022b4f, 0x022b50, 0x022b46, 0x022c1d,
+	0x022ba6, 0x022c24, 0x022de1, 0x0231c3, 0x0231f5, 0x0231b6, 0x023372, 0x0233d3,
+	0x0233d2, 0x0233d0, 0x0233e4, 0x0233d5, 0x0233da, 0x0233df, 0x02344a, 0x023451,
+	0x02344b, 0x023465, 0x0234e4, 0x02355a, 0x023594, 0x023639, 0x023647, 0x023638,
+	0x02363a, 0x02371c, 0x02370c, 0x023764, 0x0237ff, 0x0237e7, 0x023824, 0x02383d,
+	0x023a98, 0x023c7f, 0x023d00, 0x023d40, 0x023dfa, 0x023df9, 0x023dd3, 0x023f7e,
+	0x024096, 0x024103, 0x0241c6, 0x0241fe, 0x0243bc, 0x024629, 0x0246a5, 0x024896,
+	0x024a4d, 0x024b56, 0x024b6f, 0x024c16, 0x024d14, 0x024e0e, 0x024e37, 0x024e6a,
+	0x024e8b, 0x02504a, 0x025055, 0x025122, 0x0251a9, 0x0251e5, 0x0251cd, 0x02521e,
+	0x02524c, 0x02542e, 0x0254d9, 0x0255a7, 0x0257a9, 0x0257b4, 0x0259d4, 0x025ae4,
+	0x025ae3, 0x025af1, 0x025bb2, 0x025c4b, 0x025c64, 0x025e2e, 0x025e56, 0x025e65,
+	0x025e62, 0x025ed8, 0x025ec2, 0x025ee8, 0x025f23, 0x025f5c, 0x025fe0, 0x025fd4,
+	0x02600c, 0x025ffb, 0x026017, 0x026060, 0x0260ed, 0x026270, 0x026286, 0x02634c,
+	0x023d0e, 0x026402, 0x02667e, 0x0266b0, 0x02671d, 0x0268dd, 0x0268ea, 0x026951,
+	0x02696f, 0x0269dd, 0x026a1e, 0x026a58, 0x026a8c, 0x026ab7, 0x026c73, 0x026cdd,
+	0x026e65, 0x026f94, 0x026ff8, 0x026ff6, 0x026ff7, 0x02710d, 0x027139, 0x0273db,
+	0x0273da, 0x0273fe, 0x027410, 0x027449, 0x027615, 0x027614, 0x027631, 0x027693,
+	0x02770e, 0x027723, 0x027752, 0x027985, 0x027a84, 0x027bb3, 0x027bbe, 0x027bc7,
+	0x027cb8, 0x027da0, 0x027e10, 0x027fb7, 0x02808a, 0x0280bb, 0x028282, 0x0282f3,
+	0x02840c, 0x028455, 0x02856b, 0x0285c8, 0x0285c9, 0x0286d7, 0x0286fa, 0x028949,
+	0x028946, 0x02896b, 0x028987, 0x028988, 0x0289ba, 0x0289bb, 0x028a1e, 0x028a29,
+	0x028a71, 0x028a43, 0x028a99, 0x028acd, 0x028ae4, 0x028add, 0x028bc1, 0x028bef,
+	0x028d10, 0x028d71, 0x028dfb, 0x028e1f, 0x028e36, 0x028e89, 0x028eeb, 0x028f32,
+	0x028ff8, 0x0292a0, 0x0292b1, 0x029490, 0x0295cf, 0x02967f, 0x0296f0, 0x029719,
+	0x029750, 0x0298c6, 0x029a72, 0x029ddb, 0x029e3d, 0x029e15, 0x029e8a, 0x029e49,
+	0x029ec4, 0x029ee9, 0x029edb, 0x029fce, 0x02a02f, 0x02a01a, 0x02a0f9, 0x02a082,
+	0x022218, 0x02a38c, 0x02a437, 0x02a5f1, 0x02a602, 0x02a61a, 0x02a6b2
+	};
+
+	// JIS X 0213 to Unicode (two character sequences)
+	inline constexpr int jisx0213_2_unicode_sequence[25][2] = {
+		{0x304b, 0x309a},
+		{0x304d, 0x309a},
+		{0x304f, 0x309a},
+		{0x3051, 0x309a},
+		{0x3053, 0x309a},
+		{0x30ab, 0x309a},
+		{0x30ad, 0x309a},
+		{0x30af, 0x309a},
+		{0x30b1, 0x309a},
+		{0x30b3, 0x309a},
+		{0x30bb, 0x309a},
+		{0x30c4, 0x309a},
+		{0x30c8, 0x309a},
+		{0x31f7, 0x309a},
+		{0x00e6, 0x0300},
+		{0x0254, 0x0300},
+		{0x0254, 0x0301},
+		{0x028c, 0x0300},
+		{0x028c, 0x0301},
+		{0x0259, 0x0300},
+		{0x0259, 0x0301},
+		{0x025a, 0x0300},
+		{0x025a, 0x0301},
+		{0x02e9, 0x02e5},
+		{0x02e5, 0x02e9}
+	};
+	// range of the indices of the sequences
+	inline constexpr int JISX0213_SEQUENCE_FIRST = 368, JISX0213_SEQUENCE_LAST = 1009;
+
+	// Unicode to JIS X 0213 & JIS X 0201 (see jis2unicode.h)
+	inline constexpr int JISX0201_INDEX = 17672;
+	inline constexpr unsigned long long unicode_2_jisx0213_bitmap[1024] = {
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffdfffff00000000, 0xffffffffffffffff,
+	0x66300cb03f0ef3ff, 0x7e03fc3fff3f399e, 0x0000000000080000, 0x2300000015576004,
+	0x0000000000000000, 0x6e2ff1f3d7ff0000, 0x0000000621377f1e, 0x000003e06b031180,
+	0x3e119631f700995f, 0x0000000200000000, 0xfffe03fbfffe0000, 0x00000000000003ff,
+	0xffffffffffff0002, 0x000000000002ffff, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0xc000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x000f000000000000, 0x0000000000000000, 0x0000000000000000,
+	0xd80d006733790000, 0x0000000000020384, 0x0000100000000000, 0x0000000000000000,
+	0x0020088200488008, 0x0fff0fff00380000, 0x0000000003df0000, 0x000003c000140010,
+	0x20305fe1e40c0bad, 0x00c00cc700040128, 0x8000002000e00cfc, 0x000000000c000000,
+	0x0000000001040060, 0x0000000000000000, 0xc000000000000000, 0x0000000000005fff,
+	0x0000000800000000, 0x000fffff00000000, 0x0000000000000000, 0x7ffffbffffff0000,
+	0x999999393999900f, 0x0000000000000804, 0x30ce000300000000, 0x00008040000fcac3,
+	0x0000000040c0406f, 0x0000ffff00000005, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000080000, 0xffc0000000400000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0030000000000000, 0x0000000000000000, 0x8000000000000060, 0x0c00000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x38380001b3ffffef, 0xfffffffffffffffe, 0xfffffffff87fffff, 0xffffffffffffffff,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0xffff000000000000,
+	0x0206000000000000, 0x00000000fffe0000, 0xfffe01f000000000, 0x0400322fffff0000,
+	0x084008cc01102008, 0x7800000000822600, 0x000000027000c000, 0x0000000000002810,
+	0x0000500000000044, 0x0000050000000000, 0x1020000000040000, 0x0000000008000082,
+	0x0000000080000000, 0x0000400860000000, 0x0000014000000000, 0x0010000004000020,
+	0x0000000000000020, 0x0000000000000400, 0x0000000002420000, 0x0000000000008000,
+	0x0000000000000000, 0x0020180600000000, 0x0000000000002000, 0x2010010400000002,
+	0x0040800000000001, 0x0000000210000001, 0x0000000000000000, 0x0400000000000000,
+	0x0000000004800000, 0x0000800000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0008400000000000, 0x0000000000000000, 0x0000040000c00000,
+	0x0000000414004000, 0x0080200000000000, 0x0040001000002180, 0x0001000000002008,
+	0x0000004000008000, 0x0000000000000000, 0x0000000000000000, 0x0000000000040008,
+	0x0000000040020000, 0x0000001000000000, 0x0000000004000000, 0x0000000000100001,
+	0x8000000000000020, 0x0000014100000000, 0x0000000000100008, 0x0000000000000000,
+	0x0000000000000000, 0x00a4000000800000, 0x0000400000000000, 0x0000000000800200,
+	0x0200000000000000, 0x0000000001000000, 0x0000000000080000, 0x0000000000000000,
+	0x0000000000000020, 0x0000000800008100, 0x8010000000000000, 0x0008404000000000,
+	0x0000000000004080, 0x0000001000000000, 0x0000000000000000, 0x0000000020400040,
+	0x0000080000000004, 0x0000000000000008, 0x0000000000000000, 0x0001400000000000,
+	0x0000000410800100, 0x0440000008080000, 0x4008000000020000, 0x0000000000100000,
+	0x0000002000002100, 0x0000000000000008, 0x0100000020000000, 0x0000042000000000,
+	0x0000000000008000, 0x0000002000000002, 0x0000800200000000, 0x0000000000000000,
+	0x0000000000001000, 0x0000001000000000, 0x0000000000000000, 0x2000000000000000,
+	0x0000000000400000, 0x0000000000004010, 0x0020000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0001000000000000, 0x0400008000000000,
+	0x0000020000000010, 0x0000000000000000, 0x1000000000000000, 0x0000000000000000,
+	0x0800000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000010000040404,
+	0x0000000100800000, 0x0000000000000000, 0x0000000000000000, 0x0000000000020010,
+	0x0000000000000080, 0x0080000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x9b47ff4243f7ef8f, 0x400a0204e7e2e9ad, 0x1e497977fb367f65, 0xa8e7683ae7f1eddf,
+	0x75d180003443ee0b, 0xfde99611fffbe3c8, 0xc064e8032dd6ad6c, 0x456ec07bad97ce3c,
+	0x0a407ffed75fea67, 0x2175146814e9c3cf, 0x4cbe3408177e2121, 0x0a2c62ea4673f6b4,
+	0x9ca40402cdf40b5f, 0x19ea7f2514b57ffb, 0x30ff3f7d23efbe6d, 0x677b66c778403e78,
+	0x0fc946b020fe4ddf, 0xa0bf963a78f0be98, 0x5e32be59891e239c, 0xcfad00ddebe737aa,
+	0xcf2a841b36e1ade7, 0xadbbd2cb559e27ef, 0x08dd6371a5480014, 0x05ffff3e8ef07f0d,
+	0x7b407bd1e807ff1a, 0xb8fb1d448022674d, 0xf58cfb771065fd51, 0xa40ef366010003df,
+	0x532ac8000051c2d3, 0x7800001b70c994f3, 0x80417f80f7024fdf, 0x6280021cb41652b0,
+	0xa9d7830009d143c0, 0x0556bd5148095285, 0x105c7325663095c1, 0xa6cd4109cd8a672f,
+	0x0999a3ca916caf19, 0x98b987520003f4e5, 0x0109151d74080b04, 0xbff12059d0dcd9c9,
+	0x2637849362200e75, 0x52250a9647961e03, 0x4f0a4f00f099ae28, 0x3e9fda35d7be74aa,
+	0x61867eb41f71be64, 0x317877a5adb3c3d0, 0x5a045138aa4c2c1e, 0x89404df8761f2b48,
+	0x1060a2a9958a320a, 0xc48034e404200243, 0xf42a0085dc040810, 0x0c21426b14c11a16,
+	0x4055342402c01b01, 0xb52b8b78bdf7102b, 0x8379507cbfe8bbbb, 0xe56b5bf6e95d52fd,
+	0xff032b1d444eeffe, 0x1643d3bfc82bed63, 0x5dea3fcf80139500, 0x2c51a70302050aa0,
+	0x02020ad5aff368c0, 0x0049b602100d5cc4, 0x3795509522951996, 0x68be4bff69ce3a00,
+	0x61c9e820af76184d, 0xfffc781ec1f052b9, 0xc3e03ce114e0849a, 0xffdb130fae4d8f4e,
+	0x71f2a2e8f9fbff9f, 0xf28f3ede33da55a3, 0x33b8e797538f9fbf, 0xb92bca1773dc3ab8,
+	0x042a8ff73bf5e000, 0x80a1bf3d86253cce, 0x717f07c9ecf43e1a, 0x0fff418bbf3a09e0,
+	0xf4911982de2de34b, 0x50fbc9ada7287dd6, 0x56447bb007df6484, 0xf5f40048a0213fc8,
+	0xc91dc64eec777701, 0xda4ae11b4d6e7bcb, 0x3a2218405bfe063d, 0xf0eaf0033bffb7f4,
+	0xfe2489808303378e, 0x1cc45ba012a1f21a, 0x68341faf8b54d319, 0x04f47a2b1c758259,
+	0x4450b36450d9a240, 0x2748a2812d024004, 0xda056a30e42e0188, 0xecd690ff05b57cb6,
+	0xcbf49e1c71508031, 0x05b518cc63f2a130, 0xb3a5b8b2ba8357be, 0x1e0633e70a949a7e,
+	0x947badb7d038d7dd, 0x0dd9fffeee86db3e, 0xdb36684523c7639b, 0xffbd13413e4003d2,
+	0xa5da7dc0eafcab2b, 0xd8ffa47ff25bf3c2, 0x0bdd82473dad1aa2, 0xdabbd2946f9fc55b,
+	0x7b1e3e06e1c9001e, 0xd4f44888babf737f, 0x1e7fadedbfd9a02e, 0x1e87f1bb87f5bf78,
+	0xaa71056e1e04fdbb, 0xf7bcff1f76b80644, 0xdc9760e119764407, 0xea7cef8c634bfc8b,
+	0xef7d4e0eeebe9c24, 0xc50c08568b454bf0, 0x29085c2ff0936a19, 0x2c0e1590fc1b004e,
+	0x67a4908be8c78c30, 0x8fb896ff8b5956c8, 0xfcbeee1049602e5f, 0x800ad8c08ddcebe1,
+	0xc5f80018089bc524, 0x645d2585fea16007, 0xff0a6c061ffd337e, 0x080bff2f3ef91676,
+	0xfb7ecef0ca845c11, 0x039156795f000032, 0x9134dc001b3a77a7, 0x1eea5f52ef67d9f5,
+	0x5554faffeea80fa0, 0xc044c888d9daff18, 0xa4d68ca4b1499005, 0xcb949800623a5ebe,
+	0xd16e9c2d053b9646, 0x7511e157df960022, 0x526a84bb81d37157, 0x566bda13cd3007cf,
+	0x560511c8ed228ee3, 0x7161da3861125c88, 0x0f8af81082a44662, 0x22021010b31a8d00,
+	0x1043c843561093d8, 0x200053f5526f56c0, 0x460ad1058a7485b1, 0xda2070e192bd4b1a,
+	0xff753d00082120c1, 0xe314c28eabec19c5, 0x4247f08508446087, 0x3f8832070a85505f,
+	0xe2dadfa0bbc40480, 0x1da7dd480085c030, 0x9aac0b65d1700eb2, 0x470266ab4240ef25,
+	0x867fdd740c0806ea, 0x404bae1dfeac28db, 0xae210fefd3850bea, 0x85c7cacd55508700,
+	0x7d8f9d79d5aa703a, 0xe7dfbef53e17ff51, 0xf3af082c2416dec6, 0xd61f529deb3ce4ed,
+	0x183921f7db68ab8f, 0x7d47f7b611641bce, 0x87d1c5c37e6949db, 0x591655fad8d4776c,
+	0x15f02271ce801f92, 0xf6040d6f9d0060c1, 0xba493635c4124801, 0x1819f6fddc802080,
+	0x841430e302343264, 0x1014dd102002c0a8, 0x5c21a698e4ba74c2, 0x6e9491d304335d62,
+	0x5c135c601a074083, 0x868421a5fde907e3, 0xef1b46c22970e433, 0x08013adac1763f87,
+	0xfb866001dfb26d09, 0xa7712e8fb2c1f2cd, 0xde49d60981ed053e, 0xa751adefb62efdb8,
+	0x2a6af5e14b068dd4, 0x863ff2f12077fbe2, 0x1132a402ffb7a8c0, 0x00c9267126d09ef3,
+	0xe1ca0ccbc09ee88b, 0x4229f233c3d3b429, 0xf2ce69f789b5aa0e, 0x4d7488c5f3e46535,
+	0xe62fd80f7fbd2ffd, 0xa66f454e5e49d9ff, 0xedf7fccdbe889b48, 0x0a16935b77e69c85,
+	0x6ea659cfe8a70f32, 0xfa292ec266742cea, 0x000000001d5ff7cc, 0x0000000000000000,
+	0x5d40000000000000, 0x63a56f9b8137f0b8, 0xa344e31874d355ec, 0x1e0dda6b8834d46a,
+	0xb8e9115213f75d7f, 0xeaff8146c5440448, 0x0516b6b63f481af0, 0x393a80736fe05478,
+	0x622a92984d4027e4, 0x87136be1803b4c40, 0xed2d03193528853f, 0xfc1835b98fcaa74f,
+	0x13fc5e06dbc577b6, 0xe3d6cd5db7808ae1, 0xff9efbfaa20c6c08, 0x6e9a09eedabe0060,
+	0x1777a90c39c053ff, 0xb8a8000c01b786b9, 0xa0220f85ed7c66e0, 0x2a978e23b15bd6a3,
+	0x3322160500aafcda, 0x17ebfa6e9e86c740, 0xdf14a042d2910836, 0xb413d480164bee57,
+	0x6034b87acdba1041, 0xec80a71e47aacf0b, 0x1681ff54ba9b95d3, 0xcec02672b321ee82,
+	0x9301a29645cf0cf5, 0x0ea29884dcf96003, 0x014b8f18312a3e80, 0x7f00f258cab26ada,
+	0xcc92022a970f6fed, 0x9156457983aa5a09, 0x6c28b88580082b84, 0x4ae4bc69804548d3,
+	0x1a46418e807bec6a, 0xe0a58b1eeb8c3455, 0xf0b34c1543c42906, 0x733f0102bb3ec43f,
+	0x0bc50ca0770d1496, 0xc094a455c040323f, 0xa48d96c285d98fcb, 0xa15a08e835540001,
+	0x5cfa242ea9ff550d, 0x122f7a4f693761e2, 0xd28571fb452b32b4, 0x55da68d7dcc5b894,
+	0x42083943bed174b7, 0xa0d79a40df52d24a, 0x00000000767d5c0b, 0x0000000000000000,
+	0xa680000000000000, 0x17083f0604b1d7e2, 0xb9ddff976b1c7624, 0x7d13245f5e6a659f,
+	0x00000000085defb0, 0x009b38d000000000, 0x4408814802200432, 0xb0289d0aaec2d944,
+	0x2271048fe0519740, 0x1855b01d82311f94, 0x486bdc02431a2cb2, 0x7f00080c88163d61,
+	0xcb48ae40fabc1729, 0x0000001e91907675, 0x9cf7e1d8d8000000, 0x2fb3ef75043a6476,
+	0x53e6608fe6fbf96f, 0xb5e4e32b737feebe, 0x416b854e0aa397bf, 0xe0f4a916f88045ba,
+	0x2697a08c53740055, 0x03bc163e0bd47fc0, 0x157add1450856aac, 0x986270fabdc3fbdb,
+	0x9798120040f36482, 0xf10201f74ec3cfbd, 0x828428809fea2329, 0x9f8c26b1028dd845,
+	0x0c24dbefe723a054, 0x502b5c311cd22f90, 0x0601708a4cd09900, 0x282201b6f1c301ca,
+	0x0d7c080207d98298, 0xf0a7ac0d4c0e0432, 0x0000000000000002, 0x0000000000000000,
+	0x0000000000000000, 0x0380000000000000, 0x7a543bfd835afecd, 0x0000002655793d88,
+	0x981cd50230000000, 0x25ed147ef901b817, 0x3fdf87b93fb0ed74, 0x0ac58f0c7f667af3,
+	0x6b4d0498525ae5d1, 0x161a6f575ee4e3d6, 0x441e694d5561a872, 0x887e60025b1a1b4a,
+	0x399d383a45dff57e, 0x001b98e04ffcf8c0, 0x9dc3ad0000000000, 0x701feeaf980009dc,
+	0x7c0e51137ddd1728, 0x0000000191a77a67, 0xb218716843c00000, 0x9b076004eb37037a,
+	0x41c36911064ec42e, 0x00000e348da4743d, 0x13c1a10000000000, 0x0a92ee6dd17fc05b,
+	0x380eefad9545114c, 0x02fc98684512e83e, 0x43167dc1c0cec418, 0x25afcdbe2956c6c3,
+	0x4ec7e6be2f7d3751, 0x05e56ea9bd9d87e2, 0x0000000000000000, 0x005d1ae000000000,
+	0xc8041d48e9a64bcc, 0x54cd9a1ff20705de, 0xbf349a120640a690, 0x2714a0c986c882df,
+	0x000000007e202484, 0xbb20000000000000, 0xff30b770e8ae1923, 0xbad0c1a1fb17f018,
+	0x6e80900302a9418c, 0x00e536cfa1bccc62, 0x0000000530b12000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0040030020000000, 0x0001000000000000, 0x0000000000000000, 0x0000000010010000,
+	0xffff00578e7b8000, 0x000007ffffffffff, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000060, 0x0000000000000000, 0x0000000000000000,
+	0xfffffffffffffffe, 0xffffffffffffffff, 0x00000000ffffffff, 0x0000002800000000
+	};
+	inline constexpr unsigned short unicode_2_jisx0213_rank[1024] = {
+	    0,    64,   128,   159,   223,   257,   300,   301,
+	  315,   315,   350,   370,   385,   416,   417,   456,
+	  466,   515,   532,   532,   532,   532,   532,   532,
+	  532,   532,   532,   532,   532,   532,   532,   532,
+	  532,   532,   532,   532,   532,   532,   532,   532,
+	  532,   532,   532,   532,   532,   532,   532,   532,
+	  532,   532,   532,   532,   532,   532,   532,   532,
+	  532,   532,   532,   532,   532,   532,   532,   532,
+	  532,   532,   532,   532,   532,   532,   532,   532,
+	  532,   532,   532,   532,   532,   532,   532,   532,
+	  532,   532,   532,   532,   532,   532,   532,   532,
+	  532,   532,   532,   532,   532,   532,   532,   532,
+	  532,   532,   532,   532,   532,   532,   532,   532,
+	  532,   532,   532,   532,   532,   532,   532,   532,
+	  532,   532,   532,   532,   532,   532,   532,   532,
+	  532,   534,   534,   534,   534,   534,   538,   538,
+	  538,   559,   564,   565,   565,   573,   600,   609,
+	  616,   643,   656,   669,   671,   675,   675,   677,
+	  691,   692,   712,   712,   758,   788,   790,   799,
+	  813,   823,   841,   841,   841,   842,   853,   853,
+	  853,   853,   853,   853,   853,   855,   855,   858,
+	  860,   860,   860,   860,   860,   860,   860,   860,
+	  860,   860,   860,   860,   860,   860,   860,   860,
+	  860,   860,   860,   860,   860,   860,   860,   860,
+	  860,   895,   958,  1018,  1082,  1082,  1082,  1082,
+	 1098,  1101,  1116,  1136,  1161,  1172,  1181,  1187,
+	 1190,  1194,  1196,  1199,  1202,  1203,  1207,  1209,
+	 1212,  1213,  1214,  1217,  1218,  1218,  1223,  1224,
+	 1229,  1232,  1235,  1235,  1236,  1238,  1239,  1239,
+	 1239,  1239,  1241,  1241,  1244,  1248,  1250,  1255,
+	 1258,  1260,  1260,  1260,  1262,  1264,  1265,  1266,
+	 1268,  1270,  1273,  1275,  1275,  1275,  1279,  1280,
+	 1282,  1283,  1284,  1285,  1285,  1286,  1289,  1291,
+	 1294,  1296,  1297,  1297,  1300,  1302,  1303,  1303,
+	 1305,  1309,  1313,  1316,  1317,  1320,  1321,  1323,
+	 1325,  1326,  1328,  1330,  1330,  1331,  1332,  1332,
+	 1333,  1334,  1336,  1337,  1337,  1337,  1337,  1338,
+	 1340,  1342,  1342,  1343,  1343,  1344,  1344,  1344,
+	 1348,  1350,  1350,  1350,  1352,  1353,  1354,  1354,
+	 1354,  1395,  1420,  1460,  1500,  1525,  1566,  1595,
+	 1630,  1669,  1698,  1725,  1756,  1784,  1823,  1866,
+	 1900,  1933,  1967,  1999,  2037,  2071,  2111,  2134,
+	 2175,  2210,  2239,  2276,  2302,  2323,  2347,  2378,
+	 2399,  2423,  2448,  2474,  2505,  2535,  2562,  2581,
+	 2615,  2641,  2667,  2694,  2734,  2768,  2802,  2827,
+	 2856,  2878,  2895,  2914,  2936,  2954,  2989,  3027,
+	 3068,  3106,  3141,  3171,  3191,  3217,  3237,  3265,
+	 3299,  3328,  3365,  3391,  3430,  3473,  3511,  3552,
+	 3587,  3617,  3648,  3684,  3718,  3750,  3786,  3816,
+	 3842,  3876,  3912,  3940,  3979,  4006,  4032,  4064,
+	 4093,  4116,  4134,  4158,  4195,  4223,  4250,  4286,
+	 4317,  4355,  4398,  4431,  4462,  4499,  4540,  4571,
+	 4610,  4639,  4676,  4716,  4756,  4789,  4827,  4856,
+	 4894,  4932,  4958,  4986,  5011,  5039,  5075,  5109,
+	 5137,  5160,  5189,  5227,  5263,  5297,  5320,  5350,
+	 5391,  5427,  5456,  5481,  5510,  5541,  5570,  5601,
+	 5634,  5662,  5688,  5712,  5729,  5752,  5778,  5803,
+	 5832,  5857,  5888,  5910,  5937,  5966,  5990,  6019,
+	 6046,  6076,  6109,  6143,  6170,  6207,  6252,  6283,
+	 6321,  6355,  6391,  6426,  6461,  6488,  6514,  6538,
+	 6564,  6585,  6602,  6631,  6660,  6683,  6714,  6745,
+	 6774,  6805,  6840,  6871,  6911,  6942,  6979,  7007,
+	 7035,  7065,  7095,  7131,  7163,  7206,  7244,  7283,
+	 7315,  7350,  7382,  7403,  7403,  7409,  7443,  7474,
+	 7504,  7540,  7567,  7597,  7627,  7652,  7678,  7708,
+	 7744,  7781,  7815,  7851,  7881,  7915,  7939,  7968,
+	 8001,  8027,  8062,  8087,  8117,  8144,  8176,  8211,
+	 8240,  8269,  8295,  8319,  8351,  8383,  8411,  8432,
+	 8459,  8487,  8518,  8544,  8577,  8603,  8627,  8659,
+	 8679,  8714,  8747,  8779,  8813,  8843,  8873,  8891,
+	 8891,  8896,  8924,  8963,  8999,  9015,  9026,  9039,
+	 9066,  9090,  9116,  9142,  9165,  9196,  9215,  9238,
+	 9273,  9313,  9355,  9387,  9416,  9441,  9472,  9501,
+	 9539,  9561,  9595,  9619,  9647,  9678,  9705,  9724,
+	 9748,  9771,  9797,  9798,  9798,  9798,  9801,  9840,
+	 9859,  9873,  9905,  9946,  9981, 10010, 10046, 10074,
+	10100, 10138, 10166, 10180, 10210, 10242, 10261, 10279,
+	10308, 10333, 10355, 10364, 10398, 10428, 10455, 10482,
+	10517, 10556, 10591, 10591, 10602, 10629, 10662, 10687,
+	10714, 10725, 10732, 10766, 10797, 10817, 10847, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10856, 10856, 10856,
+	10856, 10856, 10856, 10856, 10856, 10860, 10861, 10861,
+	10863, 10895, 10938, 10938, 10938, 10938, 10938, 10938,
+	10938, 10938, 10938, 10938, 10938, 10938, 10938, 10938,
+	10938, 10938, 10940, 10940, 10940, 11003, 11067, 11099
+	};
+	inline constexpr short unicode_2_jisx0213_value[11101] = {
+	// U+0000-U+003F
+	17672, 17673, 17674, 17675, 17676, 17677, 17678, 17679,
+	17680, 17681, 17682, 17683, 17684, 17685, 17686, 17687,
+	17688, 17689, 17690, 17691, 17692, 17693, 17694, 17695,
+	17696, 17697, 17698, 17699, 17700, 17701, 17702, 17703,
+	17704, 17705, 17706, 17707, 17708, 17709, 17710, 17711,
+	17712, 17713, 17714, 17715, 17716, 17717, 17718, 17719,
+	17720, 17721, 17722, 17723, 17724, 17725, 17726, 17727,
+	17728, 17729, 17730, 17731, 17732, 17733, 17734, 17735,
+	// U+0040-U+007F
+	17736, 17737, 17738, 17739, 17740, 17741, 17742, 17743,
+	17744, 17745, 17746, 17747, 17748, 17749, 17750, 17751,
+	17752, 17753, 17754, 17755, 17756, 17757, 17758, 17759,
+	17760, 17761, 17762, 17763, 17764, 17765, 17766, 17767,
+	17768, 17769, 17770, 17771, 17772, 17773, 17774, 17775,
+	17776, 17777, 17778, 17779, 17780, 17781, 17782, 17783,
+	17784, 17785, 17786, 17787, 17788, 17789, 17790, 17791,
+	17792, 17793, 17794, 17795, 17796, 17797, 17798, 17799,
+	// U+0080-U+00BF
+	  753,   754,    80,    81,   755,    78,   756,    87,
+	   14,   757,   758,   759,   137,   760,   761,   762,
+	   74,    61,   763,   764,    12,   182,   765,   766,
+	  767,   768,   769,   770,   771,   772,   773,
+	// U+00C0-U+00FF
+	  774,   775,   776,   777,   778,   779,   780,   781,
+	  782,   783,   784,   785,   786,   787,   788,   789,
+	  790,   791,   792,   793,   794,   795,   796,    62,
+	  797,   798,   799,   800,   801,   802,   803,   804,
+	  805,   806,   807,   808,   809,   810,   811,   812,
+	  813,   814,   815,   816,   817,   818,   819,   820,
+	  821,   822,   823,   824,   825,   826,   827,    63,
+	  828,   829,   830,   831,   832,   833,   834,   835,
+	// U+0100-U+013F
+	  836,   841,   871,   886,   846,   857,   873,   888,
+	  902,   908,   874,   889,   877,   892,   893,   839,
+	  844,   875,   890,   876,   891,   903,   909,   904,
+	  910,   938,   837,   842,   905,   911,   872,   887,
+	  849,   860,
+	// U+0140-U+017F
+	  848,   859,   878,   894,   879,   895,   935,   840,
+	  845,   880,   896,   950,   949,   870,   885,   881,
+	  897,   850,   861,   906,   912,   852,   864,   851,
+	  863,   884,   900,   853,   865,   838,   843,   907,
+	  913,   882,   898,   883,   899,   854,   866,   856,
+	  869,   855,   868,
+	// U+0180-U+01BF
+	  948,
+	// U+01C0-U+01FF
+	  943,   736,   737,   738,   743,   744,   745,   746,
+	  747,   748,   749,   741,   742,   976,
+	// U+0240-U+027F
+	  958,   964,   965,   944,   963,   970,   923,   945,
+	  953,   955,   974,   956,   957,   930,   947,   934,
+	  961,   967,   941,   973,   951,   919,   929,   920,
+	  959,   936,   914,   931,   924,   954,   921,   972,
+	  928,   925,   916,
+	// U+0280-U+02BF
+	  937,   926,   917,   946,   922,   952,   960,   915,
+	  962,   966,   933,   927,   971,   918,   940,   939,
+	  942,   932,   969,   968,
+	// U+02C0-U+02FF
+	  862,   990,   991,   992,   993,   847,   901,   858,
+	  867,  1020,  1003,  1004,  1005,  1006,  1007,
+	// U+0300-U+033F
+	  999,   997,  1002,  1032,   998,   994,  1016,   996,
+	 1001,  1000,  1027,  1028,  1033,  1013,  1025,  1026,
+	 1014,  1015,  1021,  1010,  1018,  1029,  1011,  1019,
+	 1022,  1024,  1012,  1030,  1031,  1023,  1017,
+	// U+0340-U+037F
+	  989,
+	// U+0380-U+03BF
+	  470,   471,   472,   473,   474,   475,   476,   477,
+	  478,   479,   480,   481,   482,   483,   484,   485,
+	  486,   487,   488,   489,   490,   491,   492,   493,
+	  502,   503,   504,   505,   506,   507,   508,   509,
+	  510,   511,   512,   513,   514,   515,   516,
+	// U+03C0-U+03FF
+	  517,   518,   526,   519,   520,   521,   522,   523,
+	  524,   525,
+	// U+0400-U+043F
+	  570,   564,   565,   566,   567,   568,   569,   571,
+	  572,   573,   574,   575,   576,   577,   578,   579,
+	  580,   581,   582,   583,   584,   585,   586,   587,
+	  588,   589,   590,   591,   592,   593,   594,   595,
+	  596,   612,   613,   614,   615,   616,   617,   619,
+	  620,   621,   622,   623,   624,   625,   626,   627,
+	  628,
+	// U+0440-U+047F
+	  629,   630,   631,   632,   633,   634,   635,   636,
+	  637,   638,   639,   640,   641,   642,   643,   644,
+	  618,
+	// U+1E00-U+1E3F
+	  739,   740,
+	// U+1F40-U+1F7F
+	  977,   978,   987,   988,
+	// U+2000-U+203F
+	   29,   279,    28,    28,    33,    37,    38,    39,
+	   40,   180,   181,   219,    36,    35,   176,    75,
+	   76,   101,   732,    16,   995,
+	// U+2040-U+207F
+	 1127,   733,   734,   735,  1126,
+	// U+2080-U+20BF
+	  752,
+	// U+2100-U+213F
+	   77,   248,   250,  1193,  1195,   251,   175,   247,
+	// U+2140-U+217F
+	  651,   652,   653,  1148,  1149,  1150,  1151,  1152,
+	 1153,  1154,  1155,  1156,  1157,  1158,  1182,  1054,
+	 1055,  1056,  1057,  1058,  1059,  1060,  1061,  1062,
+	 1063,  1064,  1065,
+	// U+2180-U+21BF
+	  104,   105,   103,   106,   174,   194,   192,   193,
+	  195,
+	// U+21C0-U+21FF
+	  196,   138,   139,   198,   199,   197,   200,
+	// U+2200-U+223F
+	  140,   156,   141,   132,   157,   119,   131,   120,
+	   60,   246,   162,   164,    70,  1215,   153,   145,
+	  146,   135,   136,   126,   125,   166,   167,  1210,
+	   71,   165,   163,
+	// U+2240-U+227F
+	  169,   170,   171,   159,    65,   158,   168,    68,
+	   69,   160,   161,   172,   173,
+	// U+2280-U+22BF
+	  123,   124,   127,   128,   121,   122,   129,   130,
+	  142,   143,   144,   154,  1216,
+	// U+22C0-U+22FF
+	  649,   650,
+	// U+2300-U+233F
+	  133,   134,   155,   655,
+	// U+2380-U+23BF
+	  597,   598,
+	// U+23C0-U+23FF
+	  599,   600,   601,   602,   603,   604,   605,   606,
+	  607,   608,   609,   610,   611,   657,
+	// U+2400-U+243F
+	  656,
+	// U+2440-U+247F
+	 1128,  1129,  1130,  1131,  1132,  1133,  1134,  1135,
+	 1136,  1137,  1138,  1139,  1140,  1141,  1142,  1143,
+	 1144,  1145,  1146,  1147,
+	// U+24C0-U+24FF
+	 1066,  1067,  1068,  1069,  1070,  1071,  1072,  1073,
+	 1074,  1075,  1076,  1077,  1078,  1079,  1080,  1081,
+	 1082,  1083,  1084,  1085,  1086,  1087,  1088,  1089,
+	 1090,  1091,  1044,  1045,  1046,  1047,  1048,  1049,
+	 1050,  1051,  1052,  1053,   527,   528,   529,   530,
+	  531,   532,   533,   534,   535,   536,
+	// U+2500-U+253F
+	  658,   669,   659,   670,   660,   671,   661,   672,
+	  663,   674,   662,   673,   664,   685,   680,   675,
+	  666,   687,   682,   677,   665,   681,   686,   676,
+	  667,   683,   688,   678,   668,   684,
+	// U+2540-U+257F
+	  689,   679,
+	// U+2580-U+25BF
+	   96,    95,   546,    98,    97,   189,   188,   100,
+	   99,
+	// U+25C0-U+25FF
+	  191,   190,    94,    93,   214,    90,    92,    91,
+	  728,   729,   730,   731,   218,   187,
+	// U+2600-U+263F
+	  541,   542,   543,   544,    89,    88,   540,   537,
+	  538,  1221,
+	// U+2640-U+267F
+	   73,    72,   495,   498,   496,   501,   494,   499,
+	  497,   500,   545,   186,   179,   184,   185,   178,
+	  183,   177,
+	// U+2700-U+273F
+	  654,
+	// U+2740-U+277F
+	 1220,  1034,  1035,  1036,  1037,  1038,  1039,  1040,
+	 1041,  1042,  1043,
+	// U+2900-U+293F
+	  201,   202,
+	// U+2980-U+29BF
+	  147,   148,   213,
+	// U+29C0-U+29FF
+	  280,   281,
+	// U+3000-U+303F
+	    0,     1,     2,    22,    24,    25,    26,    49,
+	   50,    51,    52,    53,    54,    55,    56,    57,
+	   58,   102,   107,    43,    44,   151,   152,   149,
+	  150,    32,  1191,  1192,   539,   112,   113,   114,
+	  115,   116,   215,
+	// U+3040-U+307F
+	  282,   283,   284,   285,   286,   287,   288,   289,
+	  290,   291,   292,   293,   294,   295,   296,   297,
+	  298,   299,   300,   301,   302,   303,   304,   305,
+	  306,   307,   308,   309,   310,   311,   312,   313,
+	  314,   315,   316,   317,   318,   319,   320,   321,
+	  322,   323,   324,   325,   326,   327,   328,   329,
+	  330,   331,   332,   333,   334,   335,   336,   337,
+	  338,   339,   340,   341,   342,   343,   344,
+	// U+3080-U+30BF
+	  345,   346,   347,   348,   349,   350,   351,   352,
+	  353,   354,   355,   356,   357,   358,   359,   360,
+	  361,   362,   363,   364,   365,   366,   367,    10,
+	   11,    20,    21,   118,   278,   376,   377,   378,
+	  379,   380,   381,   382,   383,   384,   385,   386,
+	  387,   388,   389,   390,   391,   392,   393,   394,
+	  395,   396,   397,   398,   399,   400,   401,   402,
+	  403,   404,   405,   406,
+	// U+30C0-U+30FF
+	  407,   408,   409,   410,   411,   412,   413,   414,
+	  415,   416,   417,   418,   419,   420,   421,   422,
+	  423,   424,   425,   426,   427,   428,   429,   430,
+	  431,   432,   433,   434,   435,   436,   437,   438,
+	  439,   440,   441,   442,   443,   444,   445,   446,
+	  447,   448,   449,   450,   451,   452,   453,   454,
+	  455,   456,   457,   458,   459,   460,   461,   645,
+	  646,   647,   648,     5,    27,    18,    19,   117,
+	// U+31C0-U+31FF
+	  547,   548,   549,   550,   551,   552,   553,   554,
+	  555,   556,   558,   559,   560,   561,   562,   563,
+	// U+3200-U+323F
+	 1201,  1202,  1203,
+	// U+3240-U+327F
+	  690,   691,   692,   693,   694,   695,   696,   697,
+	  698,   699,   700,   701,   702,   703,   704,
+	// U+3280-U+32BF
+	 1196,  1197,  1198,  1199,  1200,   705,   706,   707,
+	  708,   709,   710,   711,   712,   713,   714,   715,
+	  716,   717,   718,   719,
+	// U+32C0-U+32FF
+	 1092,  1093,  1094,  1095,  1096,  1097,  1098,  1099,
+	 1100,  1101,  1102,  1103,  1104,  1105,  1106,  1107,
+	 1108,  1109,  1110,  1111,  1114,  1113,  1116,  1115,
+	 1112,
+	// U+3300-U+333F
+	 1165,  1169,  1160,  1163,  1161,  1171,  1170,  1164,
+	 1172,  1166,  1174,
+	// U+3340-U+337F
+	 1159,  1173,  1162,  1167,  1168,  1190,  1206,  1205,
+	 1204,
+	// U+3380-U+33BF
+	 1178,  1179,  1175,  1176,  1177,  1181,
+	// U+33C0-U+33FF
+	 1180,   249,  1194,
+	// U+3400-U+343F
+	 1224,  8848,  8853,  8854,
+	// U+3440-U+347F
+	 8897,  8889,
+	// U+3480-U+34BF
+	 8929,  1272,  9034,
+	// U+34C0-U+34FF
+	16709,  9038,  1280,
+	// U+3500-U+353F
+	 9063,
+	// U+3540-U+357F
+	 9084,  9085,  9088,  9094,
+	// U+3580-U+35BF
+	 9120,  9123,
+	// U+35C0-U+35FF
+	 9132,  9141,  9151,
+	// U+3600-U+363F
+	 9159,
+	// U+3640-U+367F
+	 9206,
+	// U+3680-U+36BF
+	 9242,  9246,  9244,
+	// U+36C0-U+36FF
+	 9266,
+	// U+3740-U+377F
+	 9496,  9498,  9502,  9501,  9505,
+	// U+3780-U+37BF
+	 4386,
+	// U+37C0-U+37FF
+	 9523,  4402,  9547,  9550,  9553,
+	// U+3800-U+383F
+	 9555,  9572,  9574,
+	// U+3840-U+387F
+	 9577,  9582,  9584,
+	// U+38C0-U+38FF
+	 9896,
+	// U+3900-U+393F
+	 9907,  9911,
+	// U+3940-U+397F
+	 9933,
+	// U+3A40-U+3A7F
+	10022, 10026,
+	// U+3AC0-U+3AFF
+	10044, 10079, 10055,
+	// U+3B00-U+3B3F
+	10071, 10075, 10077,  7936,
+	// U+3B40-U+3B7F
+	10134, 10126,
+	// U+3B80-U+3BBF
+	10159, 10160, 10163, 10171,  7989,
+	// U+3BC0-U+3BFF
+	 7990, 10191, 10212,
+	// U+3C00-U+3C3F
+	 8015, 10238,
+	// U+3CC0-U+3CFF
+	16100, 16107,
+	// U+3D00-U+3D3F
+	16154, 16167,
+	// U+3D40-U+3D7F
+	16199,
+	// U+3D80-U+3DBF
+	16219,
+	// U+3DC0-U+3DFF
+	16247, 16254,
+	// U+3E00-U+3E3F
+	16269,  8153,
+	// U+3E40-U+3E7F
+	16292, 16294, 16295,
+	// U+3E80-U+3EBF
+	16302, 16309,
+	// U+3F40-U+3F7F
+	16375,  8222, 16393, 16395,
+	// U+3F80-U+3FBF
+	16415,
+	// U+3FC0-U+3FFF
+	16426, 16431,
+	// U+4000-U+403F
+	16451,
+	// U+4040-U+407F
+	16462,
+	// U+4080-U+40BF
+	16474,
+	// U+4100-U+413F
+	16517,
+	// U+4140-U+417F
+	16533, 16536, 16542,
+	// U+4180-U+41BF
+	16562, 16566,
+	// U+41C0-U+41FF
+	16582, 16586, 16583,
+	// U+4200-U+423F
+	16594, 16598,
+	// U+4240-U+427F
+	 8348,
+	// U+42C0-U+42FF
+	16648, 16659, 16664,
+	// U+4300-U+433F
+	16683, 16698,
+	// U+4340-U+437F
+	16702,
+	// U+43C0-U+43FF
+	16761, 16765,
+	// U+4400-U+443F
+	16771, 16773, 16775, 16778,
+	// U+4440-U+447F
+	 8422,  8423, 16807, 16809,
+	// U+4480-U+44BF
+	16818, 16846, 16843,
+	// U+44C0-U+44FF
+	16845,
+	// U+4500-U+453F
+	16882, 16877, 16902,
+	// U+4540-U+457F
+	16903,
+	// U+4580-U+45BF
+	 8508, 16966,
+	// U+45C0-U+45FF
+	16995,  8523,
+	// U+4600-U+463F
+	17017,
+	// U+4640-U+467F
+	17039, 17048,
+	// U+4680-U+46BF
+	17059, 17064,
+	// U+4700-U+473F
+	17088,
+	// U+4740-U+477F
+	17116,
+	// U+47C0-U+47FF
+	17138,
+	// U+4800-U+483F
+	17148,
+	// U+4840-U+487F
+	 8596, 17167,
+	// U+4880-U+48BF
+	17208,
+	// U+4980-U+49BF
+	 8703,
+	// U+49C0-U+49FF
+	17369, 17375,
+	// U+4A00-U+4A3F
+	17380, 17383,
+	// U+4A80-U+4ABF
+	17412,
+	// U+4B00-U+4B3F
+	17442,
+	// U+4BC0-U+4BFF
+	17489, 17491, 17493, 17500,
+	// U+4C00-U+4C3F
+	 8771, 17514,
+	// U+4CC0-U+4CFF
+	17587, 17590,
+	// U+4D00-U+4D3F
+	17620,
+	// U+4D40-U+4D7F
+	17641,
+	// U+4E00-U+4E3F
+	 1485,  3285,  8837,  2560,  4039,  2795,  2459,  2794,
+	 1625,  3811,  4166,  8838,  4419,  1518,  8839,  1769,
+	 4420,  2917,  4639,  1933,  3879,  2796,  4259,  3887,
+	 1225,  8840,  4421,  8841, 16275,  3265,  8842,  1226,
+	 1227,  4422,  2063,  4423,  1846,  3211,  2608,  4424,
+	 4425,
+	// U+4E40-U+4E7F
+	 8843,  4426,  3592,  1934,  8844,  8845,  3594,  3544,
+	 2196,  3966,  8847,  6808,  4427,  2797,  4428,  1618,
+	 8850,  2042,  2241,  4114,  4987,  8851,  4215,  3570,
+	 1790,
+	// U+4E80-U+4EBF
+	 1900,  4429,  4430,  4256,  4164,  3079,  4432,  2529,
+	 3560,  1228,  4435,  1533,  2224,  2223,  1479,  4366,
+	 4365,  2368,  1410,  8852,  4436,  4437,  4438,  3967,
+	 4439,  2243,  1480,  4029,  1971,  1972,  1973,  3355,
+	 4257,  4440,  4441,  4442,  8855,  2864,  8856,  8858,
+	// U+4EC0-U+4EFF
+	 2657,  2865,  4447,  8859,  4445,  4446,  1935,  8860,
+	 2352,  1677,  4444,  4443,  3862,  8861,  2481,  2480,
+	 3131,  4448,  3812,  2984,  8863,    23,  4449,  4451,
+	 1229,  3170,  4294,  1451,  8862,  4450,  1627,  2009,
+	 8864,  3266,  8865,  2146,  4452,  3575,  1230,  1231,
+	// U+4F00-U+4F3F
+	 8866,  1860,  1232,  4453,  1452,  1233,  2225,  1861,
+	 3849,  3683,  1936,  8867,  1678,  4488,  3416,  3647,
+	 4455,  3693,  4295,  8869,  2832,  2482,  2530,  1629,
+	 8870,
+	// U+4F40-U+4F7F
+	 3338,  3197,  4459,  1235,  1236,  1453,  3356,  2658,
+	 2369,  4139,  3147,  8871,  1628,  1237,  4458,  8872,
+	 4165,  4454,  4456,  2427,  4457,  4891,  1238,  1234,
+	 8868,  4465,  1239,  1240,  4468,  4466,  1631,  3880,
+	 4460,  8874,  8875,  8876,  4464,  2244,  8877,  1241,
+	 2483,
+	// U+4F80-U+4FBF
+	 8878,  1791,  8879,  4469,  4461,  1242,  4296,  2531,
+	 4462,  4467,  8880,  1243,  4470,  1244,  4463,  8881,
+	 1974,  1454,  1975,  1630,  4892,  4036,  3837,  2245,
+	 8883,  2834,  4252,  8884,  3909,
+	// U+4FC0-U+4FFF
+	 2091,  3106,  1665,  8885,  1246,  2682,  8886,  4474,
+	 8887,  4479,  4477,  8888,  4472,  3116,  4475,  4478,
+	 4476,  3914,  4473,  1247,  2833,  4030,  4480,  4481,
+	 8882,  2635,  4494,  1222,  8890,  3619,  3781,  4489,
+	 3933,  1619,  4493,
+	// U+5000-U+503F
+	 8891,  1248,  1249,  4487,  4496,  3057,  2197,  3631,
+	 1250,  5960,  8892,  4495,  3444,  8893,  4484,  2247,
+	 1251,  2246,  4482,  8894,  8895,  2595,  4490,  8896,
+	 3932,  3240,  4486,  2148,  1252,  4483,  4491,  4485,
+	 4278,  4492,  4356,  1253,  2043,  2147,  1255,
+	// U+5040-U+507F
+	 1254,  1256,  8898,  4497,  8899,  4498,  4502,  1455,
+	 8900,  3901,  4501,  8901,  4500,  4504,  8902,  4503,
+	 3357,  8903,  2149,  8904,  8905,  4505,  8906,  2574,
+	 3107,  3358,  2059,  4506,  1901,
+	// U+5080-U+50BF
+	 4507,  4509,  8908,  3968,  2137,  8909,  8910,  1257,
+	 8911,  8912,  2460,  3752,  4508,  8913,  8907,  8914,
+	 2386,  4170,  8916,  4511,  4514,  4510,  2385,  2724,
+	 8917,  8918,  2092,
+	// U+50C0-U+50FF
+	 4515,  8919,  2020,  8920,  4512,  4513,  1258,  3492,
+	 8923,  3099,  1260,  1976,  8925,  3992,  4516,  8926,
+	 4258,  4517,  8927,  4520,  4518,  1261,  3053,  8928,
+	 4519,  4521,  1259,  8921,  4523,  4522,  3893,
+	// U+5100-U+513F
+	 1902,  4525,  4526,  1264,  1612,  1263,  9024,  4524,
+	 1265,  2621,  4529,  4528,  4527,  9026,  4471,  4530,
+	 9027,  1266,  2725,  4531,  4140,  4098,  1267,  4533,
+	 4532,  4535,  4534,  4536,
+	// U+5140-U+517F
+	 4537,  1493,  2182,  2094,  2659,  3286,  1977,  2985,
+	 2248,  1268,  2333,  4539,  4081,  3421,  2532,  4538,
+	 4540,  1270,  1271,  3445,  1776,  9029,  4541,  3571,
+	 3027,  4543,  4544,  3677,  2249,  4350,  4545,  1979,
+	 9031,  3881,  3123,  2054,  3404, 16721,  2150,
+	// U+5180-U+51BF
+	 4546,  4547,  9032,  3543,  1566,  4550,  2442,  9033,
+	 4549,  2387,  4551,  6563,  4552,  3980,  4553,  4554,
+	 4555,  2798,  9035,  2581,  1273,  1792,  4558,  9036,
+	 4556,  4070,  4557,  3817,  4559,  4560,  4561,  3446,
+	 9037,  4565,  4563,  4564,  4562,  2416,  4566,  4115,
+	 4297,  9039,  4567,
+	// U+51C0-U+51FF
+	 1274,  2921,  4568,  2689,  4569,  1275,  3287,  4260,
+	 3447,  4642,  4570,  7806,  2010,  1276,  4571,  4009,
+	 1277,  2703,  3193,  4573,  3545,  4574,  1278,  4575,
+	 1705,  9042,  9043,  4576,  1980,  3521,  1593,  2679,
+	 3666,  4577,
+	// U+5200-U+523F
+	 3448,  1279,  9044,  2866,  4578,  3865,  2971,  1787,
+	 1794,  4579,  4581,  2093,  9045,  1281,  4580,  1282,
+	 9046,  4312,  2704,  3694,  3897,  4582,  4223,  4583,
+	 4584,  3477,  4585,  2922,  2443,  2151,  4586,  2484,
+	 2334,
+	// U+5240-U+527F
+	 3359,  4588,  3108,  1283,  2428,  4589,  4590,  3023,
+	 4587,  4592,  9048,  3969,  1284,  2323,  9049,  1409,
+	 4591,  1285,  2152,  2411,  3648,  4595,  4593,  9050,
+	 3850,  2799,  4602,  1759,  4596,  4594,  3054,  9051,
+	 4598,  4597,
+	// U+5280-U+52BF
+	 9053,  1727,  9052,  2131,  4603,  4242,  4599,  4604,
+	 4601,  1286,  4600,  9055,  4276,  2250,  1632,  4313,
+	 9057,  9058,  2716,  3439,  2324,  4607,  4608,  9059,
+	 4298,  4334,  4610,  2251,  9060,  9061,  4609,  1706,
+	// U+52C0-U+52FF
+	 4611,  4001,  3317,  4141,  1287,  3910,  9062,  1289,
+	 4612,  1290,  9064,  7478,  3493,  1291,  4613,  1795,
+	 4060,  1292,  2726,  4614,  3924,  4618,  2923,  4615,
+	 2021,  4616,  1796,  1294,  2081,  4619,  4620,  9066,
+	 4621,  4622,  2596,  1295,  2252,  4103,
+	// U+5300-U+533F
+	 1296,  4113,  3564,  3934,  4623,  1297,  4624,  9067,
+	 9068,  4626,  4628,  4627,  4629,  1626,  3991,  2441,
+	 4630,  1298,  3064,  2727,  1982,  4631,  9069,  3724,
+	 4632,  4633,  4634,  9070,  4635,  3763,  2045,  1478,
+	 9071,  3508,
+	// U+5340-U+537F
+	 4636,  2660,  9072,  2986,  4638,  4637,  2728,  2226,
+	 4640,  3695,  4641,  3725,  3121,  3179,  1981,  3555,
+	 3212,  3649,  3993,  4643,  2987,  1300,  1301,  2088,
+	 9075,  4644,  9076,  4645,  1515,  1494,  1862,  3109,
+	 1928,  4216,  4648,  1620,  9077,  4647,  1302,  1983,
+	// U+5380-U+53BF
+	 4649,  4122,  1303,  4650,  4279,  2253,  1304,  2183,
+	 4651,  9078,  4653,  4652,  2882,  1528,  1565,  4654,
+	 4655,  1305,  2184,  9079,  4656,  9081,  1957,
+	// U+53C0-U+53FF
+	 9082,  2461,  4657,  4031,  2370,  1937,  4142,  3055,
+	 3696,  2630,  2670,  9086,  2609,  2622,  2717,  9087,
+	 3697,  4660,  1538,  3056,  2254,  2198,  2044,  4664,
+	 3196,  3195,  1984,  2729,  4665,  4663,  1633,  3171,
+	 2561,  2486,  1509,  9089,  9090,  1771,  2325,  2485,
+	 4666,
+	// U+5400-U+543F
+	 4667,  1920,  1729,  2326,  1919,  3352,  1508,  3494,
+	 4071,  2256,  4224,  3422,  2255,  1306,  2082,  4676,
+	 4417,  2040,  3989,  9092,  3726,  1307,  9093,  4675,
+	 1847,  4670,  4671,  4673,  4674,  1938,  2884,  3866,
+	 4672,  4668,  2228,
+	// U+5440-U+547F
+	 4669,  4327,  9095,  3935,  3361,  2227,  2335,  1308,
+	 4677,  3538,  9091,  4681,  9096,  9097,  2631,  2623,
+	 1310,  9098,  4684,  4682,  4044,  1311,  4679,  4688,
+	 4683,  4686,  2199,  4072,  1312,
+	// U+5480-U+54BF
+	 4687,  4689,  4691,  1313,  9099,  2429,  4357,  9100,
+	 4680,  4678,  4690,  4685,  9101,  1314,  1309,  9102,
+	 1315,  4693,  4702,  4695,  9103,  4699,  1316,  4700,
+	 4696,  9104,  9105,  4729,  2422,  1708,  9106,  4694,
+	 9107,  4704,  1495,  4703,  9108,
+	// U+54C0-U+54FF
+	 1414,  3801,  4701,  9109,  4697,  1317,  4692,  4698,
+	 2389,  4705,  1496,  4714,  4706,  4707,  2730,  4020,
+	 9111,  4712,  4711,  9112,  9113,  3398,  9114,  4713,
+	 4710,  1318,
+	// U+5500-U+553F
+	 9115,  9116,  1523,  2371,  2835,  9117,  1319,  4708,
+	 3449,  4709,  1411,  1320,  4719,  4138,  2732,  4725,
+	 1321,  4724,  4715,  9118,  3136,
+	// U+5540-U+557F
+	 4716,  9119,  3180,  4721,  2731,  9121,  9122,  4718,
+	 4109,  1322,  2095,  4722,  4723,  4720,  4726,  1323,
+	 9124,  9125,  4717,  9126,  4732,  4737,  9128,  4733,
+	// U+5580-U+55BF
+	 4728,  1324,  9129,  4738,  3024,  1325,  4740,  9130,
+	 2257,  4730,  3288,  1326,  9131,  4734,  4727,  1798,
+	 1863,  1760,  4735,  4731,  2153,  4741,  4739,  3058,
+	 1921,  1985,  1328,  4736,  2057,  1539,  9136,
+	// U+55C0-U+55FF
+	 4745,  4743,  4800,  9137,  9138,  1329,  9139,  9133,
+	 4748,  4742,  4746,  9140,  4744,  9142,  2487,  4747,
+	 9144,  4750,  4755,  4753,  4752,
+	// U+5600-U+563F
+	 3213,  9147,  1331,  1634,  1332,  9148,  4749,  4751,
+	 2733,  1522,  4754,  9145,  1659,  4765,  9149,  2817,
+	 4761,  4759,  4760,  9150,  4762,  1333,  9152,  9153,
+	// U+5640-U+567F
+	 9154,  1532,  9155,  1334,  3032,  4756,  4757,  7808,
+	 1781,  9156,  9157,  4764,  1336,  1864,  4767,  4763,
+	 4766,  9158,  1338,  1339,  1340,  3867,  1335,  3530,
+	 3689,
+	// U+5680-U+56BF
+	 4769,  4768,  1728,  9160,  4770,  9161,  4773,  4772,
+	 9162,  1341,  9163,  9164,  1342,  4771,  3596,  4774,
+	 9165,  1343,  1344,  9166,  4775,  9167,  1345,  4777,
+	 4776,  4779,
+	// U+56C0-U+56FF
+	 4782,  4780,  4778,  4781,  9168,  4783,  1346,  1347,
+	 9169,  4784,  4785,  4786,  4787,  4548,  2629,  2488,
+	 1680,  9170,  1497,  3231,  9171,  4788,  2353,  1456,
+	 2881,  9172,  9173,  4789,  2200,  2336,  4791,
+	// U+5700-U+573F
+	 4790,  3917,  4792,  4794,  4793,  1348,  4795,  4796,
+	 2154,  1567,  4797,  9175,  4799,  4798,  4801,  3441,
+	 1350,  9176,  4802,  1430,  2412,  9178,  2096,  1351,
+	 3242,  1352,  1353,  4803,  4804,  4806,
+	// U+5740-U+577F
+	 4807,  2417,  9180,  9181,  2022,  3970,  9182,  9183,
+	 4805,  4808,  2382,  2258,  4812,  2354,  3214,  9185,
+	 4809,  3347,  9186,  1354,  9187,  9188,  9189,  1355,
+	 9190,  1356,  4813,
+	// U+5780-U+57BF
+	 2885,  4811,  4814,  2098,  4815,  9194,  1357,  9195,
+	 9196,  4816,  2259,  1723,  4818,  9197,  4819,  9193,
+	 4820,  4817,  1360,
+	// U+57C0-U+57FF
+	 4810,  4821,  4822,  1361,  1362,  4015,  9200,  2800,
+	 1363,  4824,  4825,  4823,  4827,  9198,  3595,  9203,
+	 1481,  3813,  4828,  1364,  9204,  1365,  9205,  2818,
+	 1366,  1367,  2562,  9207,  3632,  1865,  9208,  2424,
+	 9209,  1368,
+	// U+5800-U+583F
+	 4004,  3495,  9210,  2155,  3148,  1369,  4826,  4829,
+	 3137,  4830,  4831,  9211,  9212,  4833,  3362,  9213,
+	 1799,  7802,  1568,  3936,  9214,  2801,  3423,  9215,
+	 2419,  4839,
+	// U+5840-U+587F
+	 3882,  4290,  9217,  1681,  4835,  9218,  3033,  4838,
+	 3450,  3424,  3451,  3690,  3334,  2390,  1371,  4834,
+	 1372,  9219,  1589,  3405,  4836,  4832,  2867,  4840,
+	 1374,  2677,
+	// U+5880-U+58BF
+	 1986,  4841,  1375,  9220,  9221,  9222,  9223,  9224,
+	 3925,  9225,  3100,  3327,  9226,  1376,  4843,  3994,
+	 1378,  9227,  4844,  4849,  9228,  3868,  4848,  4842,
+	 4845,  4847,  2355,
+	// U+58C0-U+58FF
+	 3894,  9230,  4850,  3232,  1682,  2802,  9231,  1381,
+	 4852,  1380,  4851,  1382,  2327,  4853,  4855,  4854,
+	 1383,  4857,  4846,  4859,  1384,  9232,  4858,  4856,
+	 1385,  2489,  2868,  3059,  4860,  2941,  1486,  3639,
+	 9233,  9234,  3348,  4862,  4861,  4863,  4864,  4865,
+	// U+5900-U+593F
+	 4866,  9235,  9236,  3902,  4867,  9237,  1386,  9238,
+	 1635,  4868,  9239,  4163,  1707,  4646,  2671,  3132,
+	 4869,  4116,  4061,  9240,  4871,  3172,  3406,  3133,
+	 3814,  4872,  4873,  1594,  2563,  4874,  1457,  4875,
+	 9243,  4876,
+	// U+5940-U+597F
+	 1569,  9245,  1866,  3541,  3937,  4880,  3060,  4879,
+	 2099,  4006,  4878,  3452,  4882,  4881,  9248,  1388,
+	 9249,  4884,  4883,  1595,  4885,  2734,  4887,  3200,
+	 4886,  1389,  3872,  2718,  3442,  9251,  9252,  4888,
+	 9253,  2260,
+	// U+5980-U+59BF
+	 4889,  3572,  3727,  4090,  3576,  1390,  4898,  1391,
+	 1903,  4172,  4056,  4993,  4890,  9254,  4893,  1392,
+	 3138,  3971,  3425,  9255,  4894,  4016,  2391,  9256,
+	 2735,
+	// U+59C0-U+59FF
+	 1393,  4895,  9257,  2491,  2490,  9258,  1434,  2201,
+	 1394,  2924,  1458,  4899,  4900,  4897,  1395,  9259,
+	 9260,  9261,  1527,  1800,  9262,  4896,  4078,  3776,
+	 9263,  1417,  8831,  1498,  2492,
+	// U+5A00-U+5A3F
+	 1459,  1412,  4905,  9267,  9268,  4903,  1396,  9269,
+	 4069,  4906,  4904,  4902,  2836,  1397,  4901,  9270,
+	 3911,  9271,  2229,  4910,  4911,  2736,
+	// U+5A40-U+5A7F
+	 4907,  4335,  3615,  4909,  9272,  2356,  4912,  9273,
+	 3815,  1398,  4913,  4908,  1399,  1400,  9274,  1401,
+	 4068,
+	// U+5A80-U+5ABF
+	 1402,  9275,  3633,  4914,  3777,  9276,  1403,  9277,
+	 9278,  9279,  1404,  9280,  9281,  9282,  9283,  4915,
+	 4919,  4916,  9284,
+	// U+5AC0-U+5AFF
+	 1636,  4918,  1405,  2564,  4917,  2156,  4931,  4924,
+	 4921,  9285,  9286,  9287,  3263,  4920,  9288,  4922,
+	 4923,  9290,  9289,  9291,  4925,  4926,
+	// U+5B00-U+5B3F
+	 9292,  9293,  1867,  4928,  4927,  4929,  9294,  1407,
+	 2803,  1408,  4932,  3349,  9296,  1540,  4930,  9295,
+	 4933,  4934,
+	// U+5B40-U+5B7F
+	 4937,  4376,  4935,  4936,  9297,  2493,  4938,  9298,
+	 2261,  4939,  4377,  2533,  3125,  4940,  4941,  2501,
+	 2262,  4091,  1887,  2202,  4942,  1747,  9299,  4943,
+	 3126,  9300,  4944,  4984,  4945,  4946,  4947,  4949,
+	 9301,  4378,  9302,
+	// U+5B80-U+5BBF
+	 4950,  9303,  4951,  9304,  3181,  1510,  2610,  1443,
+	 3062,  1801,  2558,  2263,  4379,  3453,  9494,  2632,
+	 1802,  3267,  3363,  1433,  1904,  3938,  2571,  1929,
+	 2988,  2565,  4143,  4952,  9495,  1939,  2392,  1709,
+	 1570,  2737,  1637,  4953,  4173,  2672,
+	// U+5BC0-U+5BFF
+	 9497,  2605,  4954,  1868,  3527,  4050,  4955,  4956,
+	 3816,  9499,  4958,  1793,  2060,  4957,  9500,  4380,
+	 1803,  2837,  4962,  2444,  1638,  4961,  4959,  4963,
+	 4960,  3582,  5590,  2838,  4964,  4381,  4261,  4965,
+	 9503,  4967,  3289,  4966,  2916,  2534,  9504,  3149,
+	 2624,
+	// U+5C00-U+5C3F
+	 3844,  2989,  9506,  2582,  4968,  2738,  4969,  4970,
+	 1460,  3127,  2869,  4971,  3496,  2739,  2740,  4382,
+	 4972,  2990,  2741,  4383,  4973,  4974,  4384,  4105,
+	 4975,  9507,  4385,  2011,  9508,  2633,  4976,  4977,
+	 2597,  2831,  3561,  2871,  3753,  3573,
+	// U+5C40-U+5C7F
+	 2014,  4978,  1958,  4979,  2067,  3524,  1613,  2494,
+	 4980,  4983,  4982,  2066,  4981,  3407,  8832,  3117,
+	 9510,  3426,  2577,  4387,  9511,  3063,  4225,  9512,
+	 9513,  9514,  4985,  4986,  3531,  9515,  2462,  4988,
+	 4989,  4391,  9518,
+	// U+5C80-U+5CBF
+	 9521,  9522,  4990,  4392,  1869,  4991,  4992,  4393,
+	 9526,  1609,  9527,  4394,  9528,  9529,  3034,  1853,
+	 4395,  4994,  4049,  9531,  3151,  1748,  9532,  4996,
+	 4998,  1848,  4396,  4995,  4997,  5000,
+	// U+5CC0-U+5CFF
+	 4999,  5001,  9534,  4397,  4398,  4399,  5002,  3506,
+	 1987,  1666,  5003,  5008,  5006,  3940,  3939,  4400,
+	 3454,  5005,  2683,  5004,
+	// U+5D00-U+5D3F
+	 9537,  2901,  5009,  4403,  2423,  9538,  5015,  5016,
+	 5010,  1710,  5011,  5020,  5019,  5018,  5014,  9540,
+	 5013,  9541,  5017,  9542,  9543,  4404,  3941,  9539,
+	 9544,  9545,
+	// U+5D40-U+5D7F
+	 9546,  4406,  4407,  4409,  5024,  5021,  5023,  4217,
+	 5022,  4408,  5012,  9548,  2902,  9549,  5025,  4410,
+	 2372,  9551,  5026,  5027,
+	// U+5D80-U+5DBF
+	 4411,  5030,  5029,  5028,  9554,  3455,  5007,  5036,
+	 9556,  9557,  9558,  9559,  5032,  4412,  5031,  4413,
+	 4414,  5033,  5034,  9560,  9561,  9562,  5037,  4415,
+	 9564,  4299,  5038,  5035,
+	// U+5DC0-U+5DFF
+	 5039,  4416,  1849,  5040,  9565,  5042,  5041,  5043,
+	 9566,  9567,  5044,  2991,  2634,  9568,  2699,  7809,
+	 3074,  9570,  2264,  2373,  2265,  1959,  9571,  5045,
+	 2374,  2203,  5046,  4047,  3606,  5047,  2266,  1797,
+	 3202,  2023,
+	// U+5E00-U+5E3F
+	 9573,  2495,  3818,  3698,  5048,  1870,  5051,  9575,
+	 7810,  9576,  3290,  7811,  5050,  5049,  5052,  3364,
+	 9578,  2886,  2496,  2955,  9579,  3152,  1881,  3291,
+	 5053,  5054,  2804,  3972,  9580,
+	// U+5E40-U+5E7F
+	 5057,  5056,  5055,  3852,  5064,  9581,  4005,  5058,
+	 5060,  4022,  9583,  5059,  7812,  7813,  5061,  3673,
+	 5062,  3883,  5063,  9585,  9586,  9587,  9870,  1804,
+	 3884,  3586,  5065,  5066,  8833,  2267,  1805,  5067,
+	 2185,  4171,  4144,  1871,  5069,
+	// U+5E80-U+5EBF
+	 3292,  2268,  2742,  3728,  2743,  2719,  3365,  3942,
+	 3408,  2269,  3819,  5070,  9872,  3440,  2383,  9873,
+	 2204,  9874,  3366,  1444,  2709,  2270,  4174,  9875,
+	 7814,  9876,
+	// U+5EC0-U+5EFF
+	 5071,  5072,  3620,  9877,  5073,  4316,  4336,  7816,
+	 5075,  5074,  9878,  1730,  5076,  9879,  5079,  5080,
+	 5078,  3791,  2744,  5082,  5081,  5077,  5083,  5084,
+	 5085,  5088,  5086,  5087,  5089,  1571,  3367,  5090,
+	 7817,  2157,  1683,  3593,  9881,  5091,  3568,
+	// U+5F00-U+5F3F
+	 7818,  3912,  7819,  5092,  4337,  7820,  9882,  5093,
+	 3885,  5096,  4418,  4434,  9883,  2553,  3562,  5097,
+	 1940,  3293,  1499,  5098,  3859,  2271,  3243,  9884,
+	 7821,  9886,  3368,  7822,  4120,  2186,  2205,  5099,
+	 5100,  5106,  2606,  7823,  3294,  7824,  1988,  5101,
+	 3770,  7825,  3233,
+	// U+5F40-U+5F7F
+	 7826,  5102,  7827,  9887,  5103,  1989,  5104,  5105,
+	 5107,  3469,  7828,  5108,  5109,  7829,  5110,  5095,
+	 5094,  5111,  2100,  9888,  7830,  3766,  7831,  2393,
+	 3782,  3295,  3802,  5112,  2745,  1541,  9889,  5113,
+	 5114,  4123,  3729,  7832,  9890,  5117,
+	// U+5F80-U+5FBF
+	 1596,  2925,  5116,  5115,  2101,  3153,  5121,  5119,
+	 7833,  5118,  4236,  2230,  9891,  2720,  5120,  3427,
+	 2661,  3509,  5124,  5123,  7834,  5122,  5125,  2231,
+	 9892,  9893,  7835,  5126,  3851,  2690,  5127,  3754,
+	 7836,  3510,  3296,  7837,  7838,  9894,  3399,  5128,
+	 1890,
+	// U+5FC0-U+5FFF
+	 2839,  9895,  3771,  9897,  7839,  9898,  1872,  3577,
+	 9899,  9900,  9901,  5129,  2497,  3973,  3974,  1597,
+	 5134,  7840,  3268,  7841,  9902,  5131,  7842,  1684,
+	 9903,  9904,  5182,  5133,  9905,  3587,  5132,  5130,
+	 9906,  2345,  5136,
+	// U+6000-U+603F
+	 7843,  5142,  5148,  5140,  3443,  7844,  5145,  3820,
+	 9908,  7845,  5139,  5144,  4300,  2498,  3154,  5137,
+	 9909,  9910,  1941,  5147,  2926,  1572,  5141,  1685,
+	 5146,  1990,  5143,  7846,  7847,  5149,
+	// U+6040-U+607F
+	 5151,  5161,  5159,  5156,  7848,  5155,  4317,  9912,
+	 5157,  1991,  2272,  2721,  5164,  5150,  5154,  5138,
+	 1687,  5158,  5160,  3244,  2357,  1621,  5152,  5163,
+	 5162,  1992,  3110,  1761,  2102,  5153,  9913,
+	// U+6080-U+60BF
+	 5165,  5168,  5170,  2566,  9914,  5176,  3369,  5166,
+	 5174,  1686,  9915,  5172,  5173,  5169,  5171,  7850,
+	 7851,  2232,  4145,  1806,  1560,  5175,  9916,  3597,
+	 1422,  9918,  9919,  3730,  5135,  5181,  5185,  4110,
+	 5178,  3456,  5183,  9920,
+	// U+60C0-U+60FF
+	 2805,  5184,  3532,  9921,  7852,  4362,  5180,  7853,
+	 7854,  5186,  9922,  2346,  9923,  2956,  7855,  1461,
+	 5179,  5177,  3065,  5167,  2463,  9924,  3139,  5198,
+	 9925,  3066,  5193,  9926,  5190,  5191,  7856,  2607,
+	 5194,  5197,
+	// U+6100-U+613F
+	 5192,  2636,  5195,  5189,  4133,  4132,  5199,  5200,
+	 1462,  9927,  9928,  9929,  5188,  9930,  2055,  1415,
+	 7857,  9931,  1807,  5196,  5204,  5203,  7858,  5208,
+	 7859,  5209,  7860,  9932,  5207,  5210,  5202,  5206,
+	// U+6140-U+617F
+	 9934,  5211,  5212,  9935,  5201,  2535,  5205,  3155,
+	 2273,  5187,  2840,  5225,  3926,  5215,  5216,  5217,
+	 5224,  5223,  9936,  4040,  1808,  5221,  2104,  1711,
+	 5218,  4253,  5220,  1463,  5222,  5213,  5219,  5226,
+	 2103,  5214,  9937,  4196,
+	// U+6180-U+61BF
+	 4146,  5229,  5233,  7862,  3101,  4318,  5234,  9939,
+	 9940,  5231,  5228,  9941,  9942,  5227,  5232,  3869,
+	 9943,  3497,  9944,  2105,  5235,  5230,  9945,  5236,
+	 2158,  1614,  7865,  5244,  7864,  1809,
+	// U+61C0-U+61FF
+	 5242,  5243,  2358,  5241,  5239,  5238,  5245,  5237,
+	 5247,  1688,  9947,  9948,  9949,  5249,  5248,  3297,
+	 5252,  9950,  5250,  5240,  2159,  5251,  5255,  5254,
+	 5256,  5253,
+	// U+6200-U+623F
+	 5257,  5258,  5259,  3927,  5261,  5260,  2662,  2927,
+	 1667,  1689,  5262,  9952,  1440,  2957,  5263,  7084,
+	 5264,  2132,  5265,  7867,  9953,  2992,  9954,  5266,
+	 5267,  1905,  5268,  5269,  5270,  3156,  2206,  4106,
+	 7868,  3975,
+	// U+6240-U+627F
+	 2705,  5271,  7869,  9955,  2993,  7266,  3731,  2611,
+	 9956,  2394,  5272,  9957,  9958,  3140,  3860,  7870,
+	 3182,  7871,  5275,  5273,  5276,  9959,  5274,  9960,
+	 5277,  9962,  3870,  7872,  1432,  9963,  3821,  3732,
+	 9961,  5278,  5281,  2746,
+	// U+6280-U+62BF
+	 1906,  5279,  5286,  2747,  7873,  5280,  3607,  4197,
+	 5282,  5283,  5287,  3457,  5284,  2274,  2975,  9964,
+	 5301,  3685,  3183,  9965,  3733,  5370,  3943,  3370,
+	 4032,  5290,  1598,  3269,
+	// U+62C0-U+62FF
+	 5299,  7874,  3215,  5293,  5300,  5295,  5302,  5298,
+	 5297,  3650,  5291,  1690,  5289,  1960,  3184,  5285,
+	 9966,  7875,  5288,  2275,  2972,  2748,  5296,  3621,
+	 1961,  1731,  1762,  2820,  5304,  5309,  5305,  2160,
+	 5310,  2445,  2328,  7876,  9968,  2637,  5292,
+	// U+6300-U+633F
+	 2536,  5307,  9969,  2499,  5308,  1445,  7877,  5303,
+	 9970,  9971,  3298,  7878,  1962,  1993,  5306,  1416,
+	 2384,  2841,  9974,  9975,  7879,  3371,  9976,  9977,
+	 3717,  5312,  3069,
+	// U+6340-U+637F
+	 9978,  7880,  9979,  3111,  2454,  5313,  9980,  5315,
+	 5311,  3918,  3318,  9982,  3067,  7881,  3944,  2583,
+	 5327,  5326,  9985,  2907,  2161,  5320,  2750,  3549,
+	 3588,  7882,
+	// U+6380-U+63BF
+	 5318,  3068,  9986,  2625,  5323,  2749,  5317,  5322,
+	 3622,  9989,  5316,  2068,  9987,  1752,  5324,  4240,
+	 2395,  3216,  5321,  2973,  2276,  2887,  1573,  3035,
+	 5319,  1916,  2106,  3336,  5325,  3070,  9990,  5328,
+	// U+63C0-U+63FF
+	 5330,  3124,  5336,  5331,  5333,  3792,  3372,  5334,
+	 9992,  9993,  4147,  4175,  1810,  9994,  9995,  1423,
+	 5332,  7883,  5329,  9996,  9997,  7884,  1873,  9998,
+	 1574,  7885,  5335,  9991,  4176,
+	// U+6400-U+643F
+	 5339,  9999,  3128,  5346,  7886,  5340,  7887,  5337,
+	 5344,  5314, 10000,  7888, 10001,  5341,  5345, 10002,
+	 3699,  3458, 10003,  5338,  5342,  2107,  2430,
+	// U+6440-U+647F
+	 2974,  5350,  7890,  3389, 10004, 10005, 10006,  7891,
+	 5347,  4011,  7892,  5348, 10007,  5349,  4087,  7889,
+	 2915, 10008,
+	// U+6480-U+64BF
+	 2133, 10009,  5356, 10010,  2464,  5353,  5352,  3589,
+	10011,  3498, 10012,  3400,  5354,  5355,  3838,  3608,
+	 2446,  2994,  3995,  1732,  5362,  5357,  7894,  7895,
+	// U+64C0-U+64FF
+	 4177,  5364,  7896,  5360,  5361,  7897, 10013, 10014,
+	 3071,  7893,  7898,  5359,  5294, 10015, 10016,  5363,
+	 5358,  5368,  5369,  3390,  5371, 10018, 10019,  2447,
+	 5366,  1907,  5372,  5365,  5376,  5375,  5374,  7899,
+	 5377,  7900,  5379,  2806, 10020,
+	// U+6500-U+653F
+	 5378, 10021,  5382, 10023, 10024, 10025,  5380,  5381,
+	 5343, 10027,  7901,  5384,  5383,  7902,  5351,  5385,
+	 5373,  2500, 10028,  5386,  5387,  5389,  5388,  5390,
+	 1691,  2277,  3945,  2928,
+	// U+6540-U+657F
+	10029,  2207,  5392,  5395,  3809,  1942, 10030,  5394,
+	 5393,  3623,  5396,  1994,  5398,  5397,  1811,  2465,
+	 3533,  7904, 10031,  2108,  2903,  5399,  2929,  3391,
+	 3822,  5400, 10032,
+	// U+6580-U+65BF
+	10033,  5401,  5402, 10034, 10035,  3877,  4948,  2951,
+	10036,  3803,  2405,  3734,  3700,  3428,  4262,  5404,
+	 2585,  7905,  5405,  1431,  2025,  2958,  3823,  5406,
+	 2477,  3234,  2502,  2842, 10037, 10038,  5407, 10039,
+	 3946,  1590,  2503, 10040,
+	// U+65C0-U+65FF
+	 5410, 10041,  5408,  5411,  4254,  5409, 10042,  3004,
+	 5412,  3119,  5413, 10043,  1875,  5415,  5414,  5416,
+	 5417,  1876,  3569,  3217,  1955,  2504,  3072,  2691,
+	 1425,  5418, 10045, 10046,  1599,  5422, 10047,
+	// U+6600-U+663F
+	 7907,  2278,  5421, 10048,  2360,  2751, 10049,  7908,
+	 5420,  2752,  4073,  2359,  1464,  2959,  7909,  5427,
+	 7910,  2930,  1542, 10050,  7912,  7913,  2684,  4017,
+	 2431, 10051,  7914,  2753,  2920,  7915,  7916,  7917,
+	 5426,  5424,  5425,  7911,  3270,  5457,
+	// U+6640-U+667F
+	 5431,  2537,  2279,  5429, 10052,  7919,  5430,  2843,
+	 7920, 10054,  5428, 10053,  2458, 10057,  7922,  7923,
+	10058,  5433,  5432,  5437,  7924,  5438, 10059,  5434,
+	 7925,  1693,  5435,  5436,  3718, 10062, 10063, 10064,
+	10065,  3824,  2109,  5439,  7926,  2931,  2754,  7927,
+	 7928,  3245, 10066,
+	// U+6680-U+66BF
+	10067,  2012,  5440,  5444,  1640,  5441,  5443,  7929,
+	 5442, 10068,  2706, 10069,  3235,  1446,  5445, 10070,
+	 5446,  7931,  3299,  4310,  2478, 10072,  3928, 10073,
+	 7932,  3976, 10074,  5453,  5448,  7933,  5451,  5450,
+	10076,
+	// U+66C0-U+66FF
+	 5447,  5452,  7934,  3539,  7935,  5449,  5454,  2707,
+	 5455,  7937,  4178,  3659,  5456,  5458,  7938,  5459,
+	10078,  5460,  2015,  1543,  2280,  5461,  5462,  2712,
+	 3073,  7939,  7918,  4661,  3037,  3036,  3157,
+	// U+6700-U+673F
+	 2388, 10080,  4499, 10081,  2145,  4148,  3947,  3853,
+	 5463, 10082,  7940,  2432,  3320,  5464,  4338, 10084,
+	 3977,  3300,  5465,  1877,  5466,  5467,  4099,  4045,
+	 4033,  4007,  2448,  5469,  2612,  7942,  3996,  5471,
+	 5474,  5473,  1874,  1943,  5470,
+	// U+6740-U+677F
+	 5472,  5475,  7944,  7945,  2908, 10087, 10088,  4226,
+	 1450,  2413,  3129,  2598, 10089,  2808,  5478,  3429,
+	10090,  5476,  3112,  5477,  2807,  4102,  5479,  5480,
+	 4207,  7943,  5485,  2281,  3624,  5482,  3459,  5419,
+	 5423, 10094,  1926, 10095,  3610,  7946,  5484,  2755,
+	 3701,
+	// U+6780-U+67BF
+	 7947,  5490,  3755,  5481,  5487,  5486,  2960, 10097,
+	 7948,  4024,  4280,  7949,  4018,  7950,  1641,  2505,
+	 4363,  5489,  2904,  5488,  5483,  2208, 10101, 10102,
+	 5495,  5493,  1642,  5491,  5497,  5503,  7951,
+	// U+67C0-U+67FF
+	 7953,  3141, 10103,  3886,  5505, 10104,  3761,  5504,
+	 3651,  3978,  1812, 10105,  3000,  2663,  7954,  3340,
+	10106,  4149, 10107,  5500,  5499,  5501,  5498,  5506,
+	 5496,  5494,  5502,  5492, 10108,  3271,  4129,  2575,
+	 2433, 10109,  7952,  2375,  7955,  4026,  1724,
+	// U+6800-U+683F
+	 7956,  3335,  3519,  1544, 10100,  2995,  2933,  2077,
+	10113,  7958,  5508, 10114,  2282,  1783,  5510,  1775,
+	 5516,  7959, 10115,  7960,  5513, 10117,  2996,  1734,
+	 2361, 10118,  1733,  2396, 10119,
+	// U+6840-U+687F
+	 5511,  2136,  2110,  3460, 10120, 10121,  5509,  1447,
+	10122, 10123,  5512,  5514,  2018,  2079,  7957,  1813,
+	 1922, 10124, 10125,  5517,  7961,  2438,  4028,  2466,
+	 5518,  3775, 10127, 10128,  7962,  5530,  7963,  1616,
+	 5519, 10129, 10130,  5536,  5520,
+	// U+6880-U+68BF
+	 4263, 10131,  5527,  3634,  5535,  5522, 10132,  1429,
+	 5524, 10133,  2283, 10135, 10136, 10137,  5526, 10138,
+	 5525,  5521,  5532,  2756,  7965,  7966,  4870,  2233,
+	 4227, 10139, 10140,  5523,  3373,  1694,  2362,  7967,
+	 5515, 10141,  5531,  1756,  5529,  5533, 10142,  3461,
+	// U+68C0-U+68FF
+	10147,  1879, 10148,  5563,  7968,  4082,  5538,  1878,
+	10149,  5545, 10150,  7969,  3979,  5546,  5548, 10151,
+	 5552,  5540, 10152,  3205,  3462,  5556,  5543,  5553,
+	10153, 10154,  5547,  7970, 10155,  7971,  2844,  5557,
+	 7972,  7973,  2932, 10156,  5555,  1814, 10143,  7974,
+	// U+6900-U+693F
+	 4371,  5537, 10157,  5551,  1465, 10158,  5539,  7975,
+	 4067,  5544,  2821,  3328,  5534,  5550,  2909,  5560,
+	 1772,  2162,  5562,  5541,  5561,  5554,  5542,  5558,
+	 5559,  5576,  3523,  7978,  5549,  5572, 10162,  5574,
+	 3345,
+	// U+6940-U+697F
+	 7979, 10164,  7976,  4179,  3845,  5569,  3143,  7980,
+	 5575,  3038,  5566,  5579,  5578,  3556,  5577,  3551,
+	 7981,  7982,  7983, 10165,  5581,  5568, 10166,  2013,
+	 5571,  2692, 10167,  3635,  5573,  2016,  5565,  5567,
+	 5564, 10168,  4339,  1749,  5570, 10169,
+	// U+6980-U+69BF
+	 7984,  5580,  1712,  2420,  1564,  5597, 10170,  4340,
+	 5600, 10172, 10173,  2845,  5599,  5598,  7986, 10174,
+	 5595,  7987,  5583, 10175,  5612,  5582,  5601, 10176,
+	10177,  5593, 10178,  5588,  5585,
+	// U+69C0-U+69FF
+	10179,  5586,  5594,  7803,  5591,  2284,  3329,  3075,
+	 5589,  7988,  5584, 10180,  5587, 10181,  4180,  4021,
+	 5592,  5602,  7991, 10187,  5610,  5603,  7992,  7993,
+	 5616,  5614, 10188, 10189,  5609, 10190, 10192,  7994,
+	 7995,  5608,  3337,  3076, 10193,  5606,
+	// U+6A00-U+6A3F
+	 5604,  5611,  5617,  3750,  5623,  7996, 10194,  5618,
+	 5621,  5615,  7997,  3279,  3783, 10195,  5605, 10196,
+	 5613,  2757,  4088,  5633,  5620,  2163,  1600,  1754,
+	 5596, 10184, 10198, 10199, 10200,  2758,  5625,  5632,
+	 2626,  1773,  7999,  3209,  8000, 10201,
+	// U+6A40-U+6A7F
+	 5622,  8001, 10202,  5627,  5631, 10203,  1995, 10205,
+	 8002, 10206,  8003,  1923,  5629,  8004,  1880,  3520,
+	 5628, 10207,  5630,  8005,  5624,  8006,  5626, 10204,
+	10209,  1755,
+	// U+6A80-U+6ABF
+	 3236, 10210,  5637,  8008, 10211,  5635,  2234,  5634,
+	10213,  8009,  5640,  5507,  8010,  8011, 10214,  5636,
+	10215,  5638,  5639,  8012,  5651, 10217,  5647,  5528,
+	 5646,  5645,  5642, 10218,
+	// U+6AC0-U+6AFF
+	 5619,  5644,  5643, 10219, 10221,  5649,  4329, 10220,
+	 5652,  2064, 10222, 10223,  5648,  5650,  8013,  8014,
+	 3672,  5653, 10226, 10227, 10228, 10229,  5657,  5654,
+	10230,
+	// U+6B00-U+6B3F
+	 4218,  5655,  5607, 10232, 10233, 10234, 10235,  5658,
+	 5659, 10237,  8017,  1524,  8018,  5661,  2138,  2538,
+	 2026,  1601,  8019, 10239,  4198,  8020,  5663,  5662,
+	 5665,  1908,  2027,  1815,
+	// U+6B40-U+6B7F
+	 5668,  8021,  5667,  5669, 10240,  1643,  3218,  5670,
+	 1816,  5672,  8022, 10241,  5671,  5673,  5674,  8023,
+	 5675,  2506,  2934,  2350,  8024,  3839,  8025,  3919,
+	 4359, 10242,  2528,  2397,  4311, 10243,  8026,  5676,
+	 5677, 10244,  2507,  5678,
+	// U+6B80-U+6BBF
+	 5679, 10245,  8027,  5681,  5680,  4003,  2693,  2613,
+	 2479,  5682,  5684,  2822,  5683, 16074,  5685,  5686,
+	 8028,  5687,  5688,  8029, 16075,  5689,  5691,  5690,
+	 5692,  1602,  3237,  5693,  2449,  1735,  5694, 16077,
+	16078,  3417,
+	// U+6BC0-U+6BFF
+	 4837,  1882,  5695, 16079, 16080, 16081,  5696,  3929,
+	 4019,  8031,  3516,  5697,  3735,  8032,  8033,  3756,
+	16082,  4092,  5698, 16083, 16084,  5700,  5699, 16085,
+	 5702, 16086,  5701,  8034,
+	// U+6C00-U+6C3F
+	16087,  8035,  5704, 16088, 16089,  2508,  8036,  4058,
+	 5705,  5706,  1883,  5707,  5709,  5708,  8037,  2888,
+	16090, 16091,  3784,  1545, 16092,  3702, 16094,
+	// U+6C40-U+6C7F
+	 3374,  2664,  1944, 16095,  3703,  2551,  5711,  1817,
+	 8038,  1591, 16096,  8039,  3559,  5710,  2285,  3246,
+	 5712, 16120,  5720,  5713, 16097,  3134,  1945,  5721,
+	 8041,  8042,  2139,  1884,  5719,
+	// U+6C80-U+6CBF
+	 5717,  5714,  4199, 16098,  8043,  8044,  3321, 16099,
+	 3534,  5715,  5723,  5722,  2070, 16101, 16102,  1610,
+	16103,  8045,  2376,  5716,  5718,  8046,  4002,  3185,
+	 8040,  4034, 16104,  5731,  5732,  1644,  3861,  4134,
+	 5734,  2540,  2759,  5727,  5733,  1575,
+	// U+6CC0-U+6CFF
+	 1996, 16105,  5724,  5729,  8048,  2997,  3652,  3736,
+	16106,  5726,  8049,  3948, 16108,  5728,  5737, 16109,
+	 5735, 16110,  5730,  8050,  3949,  3611,  1946,  3388,
+	 3272, 16111,  5738,  8051, 16112, 16113,  8052,  5736,
+	 3158,  5725,  1546,  8047,
+	// U+6D00-U+6D3F
+	16115,  8054, 16116,  4181,  5749,  8055,  5748,  2999,
+	 5745,  4211,  3499,  5739, 16117,  3326, 16118, 16119,
+	 1547,  2286,  5742,  8056, 16121,  8057,  2638,  5747,
+	16142,  5746,  5741,  5744,  8058,  1763, 16122,  5743,
+	 3612,  8059,
+	// U+6D40-U+6D7F
+	 4243,  2809,  2998,  8060,  5755,  5753, 16123,  3804,
+	16124, 16125,  5750,  5752,  8061,  1529,  2287,  4341,
+	 1720,  3825, 16126,  4200,  1695,  2846,  5754,
+	// U+6D80-U+6DBF
+	16127, 16128,  8063,  5759,  8064,  2760,  8065, 16129,
+	 4151, 16130,  5756, 16131,  5751,  8066,  5757, 16132,
+	 4291,  3466,  3511,  8067, 16138,  8068, 16139,  1713,
+	 1556, 16140,  5763,  5766,  4264,  8069,
+	// U+6DC0-U+6DFF
+	 4203, 16141,  8070,  5773,  5767,  5764, 16143,  4281,
+	 5770, 16144, 16145, 16146,  2673,  5772,  5777,  8071,
+	 3464,  5775,  8072,  8073,  8074,  5769, 16147,  3219,
+	 5776,  5765,  5771, 16148,  5778,  1501,  5768,  5779,
+	 2847,  2694,  3858, 16149,  2363,  5760,  5774,  3409,
+	 8075,
+	// U+6E00-U+6E3F
+	 2935,  1764,  2398,  2761,  5762,  2665,  2111,  5761,
+	16134,  5783,  2708,  2187,  5798, 16151,  5792,  1963,
+	 3430, 16152,  5787,  5796,  1424,  1521, 16153,  1622,
+	 5789,  3113,  5780,  5782,  2288, 16155,  8077, 16150,
+	 5799,  5794, 16156,  5786,
+	// U+6E40-U+6E7F
+	 5793,  8078, 16157, 16158,  4052, 16159, 16160,  5791,
+	 5795, 16161, 16162, 16163, 16164,  2209, 16165,  2762,
+	 3220,  8079,  8080,  5785, 16166,  4150,  5788,  5781,
+	 3465,  5784,  5790,  4372,  2567,
+	// U+6E80-U+6EBF
+	 4041,  5800,  3679,  5812,  2188, 16168,  2695,  5802,
+	 4244,  2289,  5815,  1487,  5813, 16169,  5801,  8081,
+	 5807,  8082,  5809, 16170,  4182,  5804,  3397,  5806,
+	16171,
+	// U+6EC0-U+6EFF
+	 8083,  5814, 16172,  5808,  4080,  8084,  5803, 16173,
+	 2539,  5827,  8085,  1765,  5805,  5810,  5811, 16174,
+	 3177,  3159, 16176,  5819,  5825,  5823,  3392,  5830,
+	 5820, 16177, 16178,  5821,  5797,
+	// U+6F00-U+6F3F
+	 1968,  3785,  2568,  2342, 16179, 16180,  4342,  8086,
+	 5817,  5829,  1576,  3077, 16181,  8087,  3660,  1818,
+	 4319, 16182,  8089,  4042,  3339,  8090,  5824,  5826,
+	 8091, 16175, 16183,  3025, 16184,  5828,  5822,
+	// U+6F40-U+6F7F
+	 5816,  1820,  8092, 16186,  2140, 16187,  5842,  8093,
+	16188,  5837,  3001,  8094,  1758, 16189,  8095,  8096,
+	 2696,  5846, 16190,  5839,  3301,  5836,  3346,  5871,
+	 5833,  5832,  5841, 16192,  8097,
+	// U+6F80-U+6FBF
+	 5835,  5834,  5840,  2914,  5831,  8098,  8099,  8100,
+	 5843, 16193,  5844,  8101, 16194,  1819, 16191, 16196,
+	 8102,  5849,  5848,  5850, 16197,  8103,  5853, 16198,
+	 3418,  5847, 16200,  8104,  5851,  8105, 16195,
+	// U+6FC0-U+6FFF
+	 2134,  3190,  5845,  3598,  5852,  8106, 16201, 16202,
+	 8107,  5857,  5855,  5858, 16203,  5861, 16204,  5854,
+	 2329,  3579,  5758, 16205,  4219,  5856,  5860,  3186,
+	 8109,  5859,  5838,  8110,  7404,  8108,  5864, 16207,
+	 5868,
+	// U+7000-U+703F
+	16208,  5866,  8111,  8112, 16209,  5862, 16210,  5863,
+	 5867,  5865,  3805,  5873,  5870,  5869,  5872,  3529,
+	 5874, 16211,  3280,  3178,  8113,  2918,  5875,  5877,
+	16213, 16214, 16215,  5876,
+	// U+7040-U+707F
+	16216, 16217,  8114, 16218,  5818,  8117,  5878, 16220,
+	 3548,  8115,  8116,  5879,  8118, 16221, 16222,  1645,
+	16223, 16224,  3467,  1696,  8119, 16225,  1947,  2599,
+	 2399, 16226,
+	// U+7080-U+70BF
+	16227,  8120, 16228,  4330,  2889,  1577,  5881, 16229,
+	16230,  5880, 16233,  8121,  8122,  5884,  3221,  5887,
+	 5882, 16234,  5886,  8123,  5885,  3415,  1466, 16231,
+	// U+70C0-U+70FF
+	 4314, 16237,  5889,  1511, 16238, 16239,  8124,  8125,
+	 5891, 16240,  5890,  5888,  8126, 16236,  5883,  3950,
+	 5893,
+	// U+7100-U+713F
+	16241, 16242, 16243, 16244, 16245,  5892, 16246,  8127,
+	 1578,  5895,  3871,  5894,  8129,  8130,  4062,  2764,
+	 8128,  8131, 16248,  8132, 16249,  3026,  2763,
+	// U+7140-U+717F
+	 8133,  8134,  4320, 16251,  5901,  3002, 16250,  8135,
+	 8137, 16252,  5897,  5902,  1579,  8138, 16253,  8139,
+	 5900,  3636,  5896,  5899,  2765,  8140,  3714,  5903,
+	 2586,  3003,
+	// U+7180-U+71BF
+	16256,  5906,  8142,  8143,  5898,  2074,  5904,  8144,
+	 4183,  5907, 16255,  7807, 16257,  2678, 16258, 16259,
+	 5908,  5909, 16260, 16261,  3585, 16262,  5911,  8146,
+	 5912,
+	// U+71C0-U+71FF
+	 8145,  3590,  8147,  3468,  5914, 16264,  5916,  4282,
+	 5913, 16265,  5915,  1580,  5910, 16266, 16267,  4758,
+	 5917,  3078,  2467,  5919,  5918,  2823,  4662,  5920,
+	 5922,  5905,  5921,  8148,  5923,
+	// U+7200-U+723F
+	 8149,  3661, 16268,  5924,  5925,  8150,  5926,  5927,
+	 3351, 16271,  5929,  5928,  5930,  5931, 16272,  2600,
+	 3826, 16273, 16274,  4117,  5932,  5933,  3061,  2541,
+	 5934,
+	// U+7240-U+727F
+	 5935, 16276,  5936,  3903,  3704,  5937,  3626,  3302,
+	16277,  8151,  8152, 16278,  5938,  1668,  1956,  4079,
+	 4063,  1617,  4343, 16279,  3997,  3863, 16281, 16282,
+	 2936,  5939, 16283,  3512,  2164,  5940, 16284,
+	// U+7280-U+72BF
+	 2401,  5942,  5941,  5943,  8154, 16285,  5944,  5945,
+	 8155,  1909,  5946,  5947,  2165, 16287, 16288,  3705,
+	16289, 16290,  5949,  2810,  5948,  8156,
+	// U+72C0-U+72FF
+	 8157, 16291,  1997,  5950,  5952,  5951, 16293,  5953,
+	 2210,  5954,  2046,  3039,  2348,  5956,  5957,  5955,
+	 2614,  3517,  1998, 16296,  5959,  3207,  5958, 16297,
+	 8158,  4344,  3637,
+	// U+7300-U+733F
+	16298,  5962, 16299,  5964,  5961, 16300, 16301,  4093,
+	 5963,  5965,  4265,  5969,  8160,  8161,  5968,  3281,
+	 3584, 16304,  2166,  5967, 16305, 16306,  5966,  4152,
+	 4153, 16303, 16307,  5970,  1581,
+	// U+7340-U+737F
+	 2341,  2509,  5971,  5972,  8163, 16308,  5974,  2666,
+	 8164,  5976,  5975, 16310, 16311, 16313, 16314,  5977,
+	16315,  1736,  5979, 16316,  5978,  5981,  5980,  8165,
+	// U+7380-U+73BF
+	16317,  2189, 16318,  4237,  2017, 16319,  1603, 16320,
+	 8166,  2047, 16321, 16322, 16323,  8167,  8168,  8169,
+	16324,  8170, 16325,  1850,  8171,  4301,  5983, 16326,
+	16327, 16328,  5985, 16329, 16330,
+	// U+73C0-U+73FF
+	 5986,  1646, 16331,  5982,  8172,  2468, 16332,  3322,
+	 5984,  8173,  8174,  8175,  5989,  2615, 16333,  8176,
+	 5987, 16334,  8177,  2097,  3706,  5988,  6015,  5994,
+	16335, 16337,  2190,
+	// U+7400-U+743F
+	16338,  1948,  5991,  4228,  8178,  4245,  8179, 16336,
+	 8180,  8181,  3187, 16339,  5993,  8183,  8184,  8185,
+	 8186,  8187,  8188,  8189,  8190, 16340,  5995,  4283,
+	 2028,  3757,  3613, 16341,  5996,  5998,
+	// U+7440-U+747F
+	16343,  6001, 16344,  8191,  8192,  8193,  8194, 16345,
+	16346, 16342,  5997,  8195,  6000,  2235,  1548,  6002,
+	16347,  2899,  5999,  4289,  8196,  6005,  7805,  6003,
+	 6006,  8197,  8198,  5992,  6004, 16348,  2377,  6007,
+	 6008,
+	// U+7480-U+74BF
+	16349,  4229, 16350,  8199,  8200, 16351,  8201,  6009,
+	 8206, 16353, 16354,  8202, 16355,  8203,  6010,  8204,
+	16356, 16357,  5990,  8205, 16358,  8207,  6011,  8208,
+	 8209, 16359, 16360,  1821,  8210, 16361, 16363, 16362,
+	 2542,  8211,
+	// U+74C0-U+74FF
+	 8212,  8213,  6012,  6013,  6014, 16364, 16365,  8214,
+	 1530, 16366,  6016,  3786,  6017,  1789,  6018,  6019,
+	16368,  6020, 16367,  6022,  6023,  6021,  3810,  6025,
+	 6024, 16370,  8215,
+	// U+7500-U+753F
+	 8216,  6027,  6026,  6028,  6029,  6031,  6030,  2344,
+	 6033,  6032,  8217,  1822,  2870,  3411,  6034,  2937,
+	16372,  2469, 16373,  1592,  6035,  4184, 16374,  3920,
+	 6036,  8218,  3419,  4154,  2290,  2848,  3238,  4625,
+	 3303,  1669,  6037, 16377, 16378,
+	// U+7540-U+757F
+	16379,  6038,  6043, 16380,  6041,  6040,  5391,  1697,
+	 6039, 16381,  1467, 16382,  3675, 16383,  3707,  4246,
+	 6044,  6042,  3255,  2919,  3676,  3772,  6046,  4241,
+	 2112,  6047,  6045,  3719,  6048, 16384,  6049,  8219,
+	 1468, 16386, 16385,  2811,  6054,  6051,  3554,  6050,
+	 8220, 16387, 16388, 16389,  1885,
+	// U+7580-U+75BF
+	16390,  6057,  6052,  6053,  6056,  6055,  3764, 16392,
+	 3041,  3040,  1910,  8221,  6058,  6059,  6060, 16394,
+	 6062,  6061,  1557, 16396,  6070,  3737,  6064,  6066,
+	16397,  6068,  2849,  6069,  6067,  2569, 16398,
+	// U+75C0-U+75FF
+	16399,  6063,  6065,  3793, 16400,  2766,  6072,  6071,
+	 8223, 16401,  6073, 16402,  2543,  2364,  3470,  6074,
+	 3332, 16403,  6076, 16404, 16405,  4230,  6075,  8224,
+	16406,  3080, 16407, 16408,  6081, 16409,  6083,  6084,
+	 3247, 16410,  6082,  6079,  6077,  6078,
+	// U+7600-U+763F
+	 8225,  6080,  8226, 16411, 16413,  8227,  6087,  6085,
+	 6086, 16414, 16417,  8228,  8229, 16412,  8230, 16418,
+	16419,  8231,  6088,  6090,  6091,  6092,  6093, 16421,
+	 8834,  6089, 16422,  8232,  6095, 16424,  6094,  8233,
+	 6096, 16423,
+	// U+7640-U+767F
+	16427,  4266,  8234,  6099,  6097,  6098, 16429,  8235,
+	 1851,  4135, 16430,  3895,  6101,  6100,  6102,  6103,
+	 8236,  8237,  6107,  6104,  6105,  6106,  6108,  8238,
+	16432,  8239,  6109,  8240,  6110,  6111,  6112,  3680,
+	 3431,  6113,  3653,  3779,
+	// U+7680-U+76BF
+	 6114,  8241,  6115,  3393,  1698,  2291,  6116,  6117,
+	 6118,  2452,  6120, 16433,  6119,  6121,  6122,  8242,
+	16434,  8243,  8244, 16436, 16435,  8245, 16437, 16438,
+	 8246,  3738, 16439,  6123,  6124,  8247,  7780,  6125,
+	 6126,  6127,  2457,
+	// U+76C0-U+76FF
+	 6128,  3625,  8248,  4010,  1549, 16441,  1558,  8249,
+	 6129,  8250,  6131,  8251,  6130,  3463,  2938,  5664,
+	 6132,  4074,  6133,  1823,  3720,  6134,  8252,  6135,
+	16443,  6136, 16444,  4101,  8253,  4094,  3319,  3081,
+	 6138,  8254,  2697,
+	// U+7700-U+773F
+	 2767,  6141,  6140,  6139,  3758,  8255,  1824,  2170,
+	16446,  8256, 16447,  6147,  6144,  2850,  4059,  6143,
+	 6145,  6146,  6142, 16448,  8257, 16449,  8258,  6148,
+	 6149,  3304,  1852,
+	// U+7740-U+777F
+	 3264,  8259,  6150,  8260,  8261, 16454,  6151,  6154,
+	 8262,  8263, 16455,  2890,  8264,  3513,  6155,  3998,
+	 6152, 16456,  6153, 16458,  6158,  8265, 16459, 16460,
+	 6157,  6156,
+	// U+7780-U+77BF
+	 8266,  6160,  6159,  6161,  8267, 16463,  6163, 16464,
+	 6162, 16465, 16466,  3898, 16467,  8268,  2685,  4267,
+	 6164,  3500,  6165,  6166,  6170,  6168,  6169,  6167,
+	// U+77C0-U+77FF
+	 6171,  6172,  6173,  6174,  4064,  6175, 16468, 16469,
+	 8269,  4121,  6176, 16470,  3241, 16471,  3645,  2048,
+	16472, 16473,  3222,  6177,  1999, 16475,  2961, 16476,
+	16477,  6178,
+	// U+7800-U+783F
+	 2378, 16479, 16480, 16481,  6179, 16482,  6180,  2167,
+	 2402, 16483,  6182, 16484,  3437,  2403,  1925, 16485,
+	 8270,  3951,  3614,  3438,  2315,
+	// U+7840-U+787F
+	 8272,  6184, 16486,  8273,  8274,  8275,  2768, 16487,
+	 8276, 16488,  4247,  2292,  8277,  2168,  3668,  6186,
+	 6188,
+	// U+7880-U+78BF
+	 2236,  6187,  3375, 16490,  6190,  1714,  6185,  3739,
+	 1519, 16491,  2425,  4373,  6189, 16493, 16494, 16495,
+	 6191, 16492,  3896,  2970,  6193,  8281,  6194,  8279,
+	 6192,  1737, 16496,  6200,  6199,
+	// U+78C0-U+78FF
+	 2544,  6201,  6196, 16497,  6202,  6197, 16498, 16499,
+	 3721,  6195,  6198, 16500,  6205, 16501, 16502,  8282,
+	16503,  6204,  4012,  6203,  1484,  8283,  6207,  8285,
+	16504, 16505, 16506,  6206, 16507,
+	// U+7900-U+793F
+	 8284,  2769,  6208,  3042, 16509,  6210,  6209,  6211,
+	16510,  8286, 16512,  6181,  6183,  6213,  6212,  8287,
+	16511,  8288,  8289,  2545, 16513,  4302,  2587,
+	// U+7940-U+797F
+	 6214,  2090,  8292,  8293,  1911,  1886,  2510, 16514,
+	 4155,  6220,  6219,  3043,  6216, 16515,  6218, 16516,
+	 8297,  2674,  2851,  6217,  6215,  3581,  2770, 16518,
+	 3787,  2404, 16519,  3471,  8301,  6221,  6222,
+	// U+7980-U+79BF
+	 6244,  2029,  4352,  3028,  6223,  1647,  3376,  3854,
+	16520, 16521, 16522,  8305, 16523,  6224, 16524,  1969,
+	 6225, 16525,  6227,  6228,  3580,  8306,  6229, 16526,
+	 8307,  6230,  6231, 16527,  2030,  1648,  3514,
+	// U+79C0-U+79FF
+	 2639,  2511, 16528, 16529,  8308,  6232,  8309,  2640,
+	16530, 16531,  1639,  3794,  8311,  6233, 16532,  3740,
+	 8312,  3044,  6236,  6237,  3644,  2852,  6234,  3260,
+	 8313,  6235,  8314,  2771,  1469,
+	// U+7A00-U+7A3F
+	 1888,  8315,  6238, 16537,  3377,  6239,  2952, 16538,
+	 4054, 16539,  3762,  6240,  6241,  3248, 16540,  4268,
+	16541,  6243,  6242, 16543,  2616,  6245,  1489,  6248,
+	16544,  8317,  6246,  1649,  2113,  6247,  2293,
+	// U+7A40-U+7A7F
+	 2337,  3923,  6249,  3999, 16545,  6251, 16546,  2962,
+	 1550,  1623,  1421, 16547,  6250, 16548, 16549,  8318,
+	16550, 16551,  6252,  6253,  2812, 16552,  6254, 16553,
+	 1738,  8319,  6256,  2141, 16554,  1949, 16555,  6257,
+	 2058,  6258,  3005,
+	// U+7A80-U+7ABF
+	 3522, 16556,  2977,  2434,  8321,  6259, 16557, 16558,
+	 3261,  3082,  6261,  6263,  6260,  6262,  2069,  8322,
+	16559,  6264,  2073, 16560,  1950,  4185,  6266,  8324,
+	 6267, 16563,  1517,  8325, 16564, 16565,  6270,
+	// U+7AC0-U+7AFF
+	 1777,  6269,  6268,  6272,  6265,  6273,  4238, 16567,
+	 6274,  8326,  6275, 16568,  4877,  6277,  6276,  6278,
+	 6279,  4250,  6280,  7504,  2772,  6281,  6282,  2686,
+	 3501,  6283, 16569, 16570,  3203,  8327,  6284,  3223,
+	 6285, 16571,  1978,  4542,  3256,  2556,  8328,  1825,
+	// U+7B00-U+7B3F
+	 6286,  6299,  6289, 16574,  1951,  6288,  6301,  6287,
+	 2773,  8329,  6291,  6292,  3394,  6293,  1753,  2877,
+	 3827, 16577,  6295, 16578,  3173,  8330, 16579, 16580,
+	16581,  6290,  6294,  6296,  2440,  8331, 16576,
+	// U+7B40-U+7B7F
+	16585,  6303,  3773,  8332,  3671,  3472,  2031,  6302,
+	 6300,  8333,  3686,  6297,  3257,  3474,  3473, 16587,
+	 2435,  6321,  8334, 16589,  6305, 16590,  6307, 16591,
+	 6310,  8335,  6311,  8336,  6308,  6309,  8337, 16592,
+	 6306,  6304, 16588,  6298, 16584,
+	// U+7B80-U+7BBF
+	 3900,  1650,  6318,  6315,  6320, 16595, 16596,  6319,
+	 3654,  4048,  2470,  6313,  6322,  6317, 16597,  6316,
+	 6312,  8338,  6314,  1826,  3224,  3006, 16599,  3667,
+	 6327, 16600,  3669, 16601,
+	// U+7BC0-U+7BFF
+	 2978,  6324,  3712, 16602,  6328,  3904,  3254, 16603,
+	 6323,  6325,  6326, 16606, 16607,  8340,  8341, 16608,
+	 6329,  2573,  3515,  6334,  6333,  6330, 16609,  4345,
+	16610,  6339,  6343,  6340,
+	// U+7C00-U+7C3F
+	 6336,  8342, 16611,  6337, 16612,  6342, 16613, 16614,
+	 6331,  4658,  6338,  6332,  6341,  8344,  6347,  8345,
+	 1827,  6344, 16615,  6345,  6346,  6349,  8343,  8346,
+	 8347,  6348,  3751,  6350,  4321,  3930,
+	// U+7C40-U+7C7F
+	 6355,  6352, 16616, 16617,  6351,  2963,  6354,  6356,
+	16618,  6353,  6360, 16619,  6357,  8350, 16620,  6358,
+	 6335, 16621,  6359,  6361, 16622,  6362,  8351, 16623,
+	16624, 16625,  3891,  6363,  8352,  4107,
+	// U+7C80-U+7CBF
+	 2019,  2076,  6364,  3873,  2891,  4057,  8353,  6365,
+	 4248,  8354,  3655,  3045,  3591,  2676,  1441,  8355,
+	 6370,  6368,  6366,  1786, 16629,  2774,  6371,  6369,
+	 6367,  6375,  6374,  6373,  6372, 16631, 16632,  6376,
+	 8356,  6377,  2939, 16633,
+	// U+7CC0-U+7CFF
+	 6378,  6380, 16635,  6379, 16637,  2211, 16638,  3031,
+	 6382,  8357,  3475, 16640,  6381,  8358,  6383,  8359,
+	 3874,  3083,  2294,  6384, 16642,  4269, 16643,  6386,
+	 6387,  6388, 16645,  6389,  2512,  6390,  2114,  1953,
+	// U+7D00-U+7D3F
+	 1889,  6392, 16646,  4124,  2295,  6391,  8360,  8361,
+	16647,  6395,  4111,  3599,  3778, 16649,  8362,  2698,
+	 6394,  2588,  2296,  2513,  1952,  3875,  6393,  8363,
+	16650,  3046,  3981,  2436,  8364,  2514,  3350,  6398,
+	 4292,  2406,  8365,  6399,  2853,  6401,  2775,  2365,
+	16653, 16654,  6400,
+	// U+7D40-U+7D7F
+	16655,  8366,  2641,  2191,  3047,  6396,  6402, 16656,
+	 8367,  6397,  2115,  6405,  6409,  2142,  8368,  6404,
+	16660, 16661,  6413,  8369,  2297,  4212,  1437,  6410,
+	 1954,  6407, 16662,  6408, 16663,  3476,  6406,  6403,
+	 1699,  2981,  2169,  8370,  6415, 16665,
+	// U+7D80-U+7DBF
+	 8371, 16667, 16668,  6412,  8372, 16669,  6414,  6411,
+	16670,  2116,  3120,  6416,  3085, 16672,  6429,  8373,
+	 6425,  6419,  8374, 16673, 16674,  6423,  2627,  1470,
+	 6418,  6426,  6430,  2298,  4095,  3343,  6420, 16675,
+	16676,  6428,  6417,  3225,  6422,  1438,  4083,
+	// U+7DC0-U+7DFF
+	16677,  8375,  6421,  2032,  3741,  8376,  3084,  4277,
+	 2710,  6469,  8377, 16678,  6431, 16679,  3007,  6427,
+	 6432,  6434,  3378,  6437,  8378,  6433, 16680,  3905,
+	 1828,  4084,  1471, 16681,  6436,  4322, 16682,  6435,
+	// U+7E00-U+7E3F
+	 1582,  3553,  6438,  8381,  6445,  6439,  6446, 16686,
+	 8382,  6442,  8383, 16687,  3662, 16688,  2579,  6444,
+	16689,  6441,  6447,  6440,  2667, 16690,  8380,  3952,
+	16691,  2675,  6443,  6455,  6451,  6454,  6452,  6456,
+	 6450,  6424,  2964,
+	// U+7E40-U+7E7F
+	 3708,  6453, 16692,  6448,  8385,  3008,  2117,  2642,
+	 8386,  2824,  3029,  6459,  6461,  6462,  6458,  6460,
+	 8387,  6449,  6457,  6465,  6464,  8835,  4037,  2078,
+	16693, 16694,  6463,  6467,  6466,  6470, 16695,  6472,
+	// U+7E80-U+7EBF
+	 2471,  6468, 16696, 16697,  6473,  6474,  8388,  6475,
+	 8389,  6481,  3410,  6477, 16699,  6476,  6478,  6479,
+	 6480, 16700, 16701,  6482,  6483,
+	// U+7F00-U+7F3F
+	 1829,  6484,  6485, 16704, 16703, 16705,
+	// U+7F40-U+7F7F
+	16706, 16707,  6486,  8390,  6487,  6488,  6489, 16708,
+	 6490,  6491, 16711,  6493,  6492,  6494,  6495,  6496,
+	16713, 16714, 16715,  6499,  6497,  6498,  2414,  2118,
+	16716,  3249,  3684,  2711,  3616,  3742,  6500,  5246,
+	16717, 16718,
+	// U+7F80-U+7FBF
+	 6501,  6503,  4204,  6502,  6505,  6504,  4186,  6506,
+	 3759, 16720,  8392,  6507, 16723,  8393,  6510, 16724,
+	 6509,  6508,  6511,  2085,  3009,  1912, 16725,  6515,
+	 6512,  6513,  6516,  6517,  6514,  1512,  8394,
+	// U+7FC0-U+7FFF
+	 1604, 16727,  6519,  6520,  6521,  4201,  8395, 16728,
+	 2643,  6523,  6522,  8396,  8397,  2892,  6524, 16729,
+	16730,  6525,  6526,  1854,  8398,  8399, 16731,  1830,
+	16732,  6527,  6528,  8400,  4008,  4202,
+	// U+8000-U+803F
+	 4187,  4346, 16733,  2300,  6531,  2589,  6530, 16735,
+	16734,  6532,  2546, 16736,  3150, 16737,  6533,  8402,
+	 2299, 16738,  4096,  6534,  6535,  6536,  6537, 16739,
+	 8403,  6538, 16740, 16741,  2547,  8404,  4118,  8405,
+	 6540,  8406,  3226,  6539,
+	// U+8040-U+807F
+	16742,  6542,  6541,  6543,  2940,  6544,  6545,  3878,
+	 6546,  3086,  6547, 16743,  6548,  4323,  6551, 16744,
+	 6550,  6549,  3305, 16745,  6552,  2825,  6553, 16746,
+	 6554,  4347,  6555,
+	// U+8080-U+80BF
+	 6556,  6558,  6557,  3670,  3566,  4353,  3674,  6560,
+	 2776,  3769, 16747,  6561,  6559, 16748,  1831,  2213,
+	 2515, 16749,  3743, 16750,  2171,  3982,  6564,  6562,
+	 2301,  2302,  1482,  2421, 16751,  3628,
+	// U+80C0-U+80FF
+	 1472,  6569, 16753,  3227,  8407,  3627,  3160, 16754,
+	 6571,  8408, 16755,  6567,  6570,  6565,  6568,  3953,
+	 8409,  2214,  1502,  6566, 16756,  6573,  6574,  8410,
+	 3502, 16759,  2000, 16760,  6585,  3600,
+	// U+8100-U+813F
+	 2516,  2001,  2953,  4361,  4055,  6572,  2965, 16758,
+	16763,  8411,  1930,  6575, 16764,  6577, 16766, 16767,
+	 6576, 16768,  6578,  3201,  3601, 16762,  3306, 16770,
+	 6582,
+	// U+8140-U+817F
+	 6581,  8412,  6579,  2872,  3828,  6584,  6583,  2303,
+	 4374,  6600,  8413,  6588,  6589,  8414,  8415, 16772,
+	 2617,  8416,  6587,  2343,  6586,  6590,  3307,  3855,
+	 3010,  3161,
+	// U+8180-U+81BF
+	 6594, 16774,  6595,  6591, 16776, 16777,  6592,  6593,
+	 2304,  6601,  6597, 16779,  3829,  4023,  3767,  6596,
+	 6599,  6598,  3983,  6602,  6603, 16780,  3030,  6604,
+	 6606,  6610,  8417,  6607,  6605,  3602,
+	// U+81C0-U+81FF
+	 6608, 16781,  6609, 16782,  1615,  6616,  6611,  8418,
+	 6612,  8419,  6613,  3102, 16783,  8420,  6615,  6614,
+	 6617, 16784,  6618,  6619,  2854, 16786,  1670,  6620,
+	 4284,  2548, 16788,  2644,  2517,  3250,  6621,  6622,
+	 1520, 16790,  6623, 16791,
+	// U+8200-U+823F
+	 6624,  6625, 16793,  6626,  6627,  2002,  5367,  6628,
+	 2982,  6629,  2580,  6630,  4433,  6631,  3915,  1845,
+	16795,  3011,  2687,  3840,  2645, 16796, 16797,  6632,
+	 2305,  6633,  3709,  6647, 16799,  6635, 16800,  3142,
+	 3656,  2192,  6634,  3012, 16801,
+	// U+8240-U+827F
+	 6636, 16804, 16802,  3379, 16803, 16806, 16808, 16810,
+	 6638,  6637,  6640, 16812,  6639,  6641,  8424,  6643,
+	16813,  6642,  1832,  6644,  6645,  6646,  2366,  4270,
+	 6648,  2826,  8425,  1583,  6649,  6650, 16817, 16819,
+	 6651, 16820,
+	// U+8280-U+82BF
+	16821, 16822,  1491,  6652,  8427,  6653, 16823,  3830,
+	 2576,  6655,  8428,  8429,  8430,  1700,  1427, 16824,
+	16825,  8431,  6654,  6657,  3617,  8432,  2855,  1651,
+	16826,  3954, 16827,  8433,  2128,  2033, 16828,  6656,
+	16829,  1671,  8434,  8435,
+	// U+82C0-U+82FF
+	 1788,  8436,  1584,  6661,  4303,  3162,  8437,  3795,
+	 6673,  1652,  6671,  6669,  6660,  6658, 16830,  6659,
+	 2604,  2049,  3282, 16831,  3526,  1552,  6663,  6662,
+	16832,  6668,  6664,  6667,  8438,  8439,
+	// U+8300-U+833F
+	 8440,  8441,  4089,  6666,  1653,  1784,  6670, 16833,
+	16834,  6672, 16835,  2119,  6676,  6685,  6686, 16837,
+	 1420, 16838,  8443,  6693,  1490,  6684,  8444,  6683,
+	16839,  6678,  6677,  6675,  6674,  3262,  3192,  6680,
+	 8445, 16840,
+	// U+8340-U+837F
+	 6679,  8446, 16841,  6682,  8447,  3087,  2120,  1536,
+	 6681,  8448,  2306, 16836,  8449, 16842,  3088,  8442,
+	10099,  6699,  6700,  1654,  1611,  6697,  8450, 16844,
+	// U+8380-U+83BF
+	 6687,  8451,  6695,  6702,  6696, 16847,  6694,  8452,
+	 6665, 16848, 16849,  6692,  8453,  6688, 16850, 16851,
+	 1833,  6690,  6701,  6691,  8454,  6703,  8455,  6689,
+	 3663,  4208,  6698,  6720,  8456,
+	// U+83C0-U+83FF
+	 8457,  6712,  2910,  8458, 16852,  1917,  2034,  6707,
+	 8459, 16853,  8460,  1656, 16854,  2777,  6710,  2407,
+	16855,  3432,  6715,  8461, 16856,  3931,  8462,  6706,
+	 1655,  2215,  3768,  6716,  6704,  6713, 16857,  6723,
+	 6708,
+	// U+8400-U+843F
+	 8463,  6709,  3503,  8464,  6714,  8465,  6711,  3955,
+	 6717,  1473, 16858, 16859,  6705, 16860, 16862,  6719,
+	 6718,  3646,  6725,  6736,  1785,  6739,  6721, 16863,
+	 6726,  4213,
+	// U+8440-U+847F
+	 6735,  8467,  4188, 16864,  4239, 16865, 16866, 16867,
+	 3283, 16868, 16869,  1766, 16870,  8468,  3841,  6741,
+	 3478, 16872,  1426,  6734,  6730,  3089,  6724,  6732,
+	 6737,  8469,  3583,  8470,  1419, 16873,  6729, 16874,
+	 6738,  3847, 16875,
+	// U+8480-U+84BF
+	16876,  6733,  6728,  8471,  2778,  2646,  2549, 16879,
+	 4097,  3798,  8472,  6744,  6753, 16880,  6731,  8473,
+	 1778,  8474,  2813,  6742,  8475,  6747,  3090, 16881,
+	 6743,
+	// U+84C0-U+84FF
+	 8476,  6750,  8477,  3258,  6751,  4189,  6740,  1715,
+	 6746, 16883, 16884,  6749,  4053, 16885,  6752,  6745,
+	 6748, 16878, 16887, 16888,  3956,  4324, 16889, 16890,
+	16891,  6756, 16892,  6763, 16893,  6755,
+	// U+8500-U+853F
+	 2572,  6722, 16894,  3899,  4043,  6762,  6761,  6757,
+	 6758,  1525, 16895,  8480,  6760,  6754,  8481, 16896,
+	16897,  3342, 16898,  6759,  1503,  8482,  8479, 16899,
+	 3103,  3888, 16904,
+	// U+8540-U+857F
+	 6764,  6768,  3722,  6767,  2779,  2578,  6770,  2003,
+	16900, 16905, 16906,  6771,  3848,  6766,  8483,  6727,
+	16907, 16908, 16909,  6765,  8484,  4370,  3479,  3842,
+	 6778, 16901,  6784,  8487, 16911, 16912,  6785, 16913,
+	// U+8580-U+85BF
+	 6772, 16914,  3657, 16915,  6782,  6774,  6776,  8488,
+	 8489,  6786,  6775, 16916,  6779,  1585,  3546,  6780,
+	 6783, 16917, 16918,  8490,  6773,  3013,  6777,  2450,
+	 2856,  2083,  4125,  8486,  4130,  2713,  8491, 16922,
+	 6790,  6788, 16923,
+	// U+85C0-U+85FF
+	 4369, 16924,  6787, 16925,  8492,  4220,  8493,  6789,
+	 6791,  6792, 16926, 16927,  6795,  6793, 16928, 16929,
+	 3480,  6794, 16930,  3710,  6781,  8494, 16931,  2714,
+	 6796,  6801,  3091,  6800,  8496,
+	// U+8600-U+863F
+	16932,  6769,  8497,  8498,  6802,  3048,  6797,  6799,
+	 8499, 16933,  8495,  6798,  5656,  5641,  8501,  6804,
+	16934, 16935,  6803, 16936, 16937,  8502,  4221,  6137,
+	 6805,  8503, 16939, 16940,  6806,
+	// U+8640-U+867F
+	16942,  1387,  6807,  2216,  1931, 16944,  6809,  4572,
+	16945,  8504,  1964,  8505,  4255,  2056,  6810,  8507,
+	 6811,  3273,  8509, 16946,  6812,  8510, 16947,  3567,
+	16948,  1435,
+	// U+8680-U+86BF
+	16949, 16950,  1664,  6817,  6818, 16951, 16952,  6813,
+	 2472,  8511, 16953, 16954,  6814,  3605, 16955,  6815,
+	 6816,  6826,  6820,  6823, 16957, 16958,  6819,  8512,
+	// U+86C0-U+86FF
+	16959, 16960,  6821,  6822,  2593,  6824,  3228,  2121,
+	 1725, 16961,  6827, 16962, 16963,  1722,  6832,  6828,
+	 6831, 16964,  3691, 16965,  6829,  6830,  3799,  3723,
+	 6833,  3194,  6843,  8513,  6839,  8514,  8515,  1672,
+	// U+8700-U+873F
+	 6837,  3957,  6838, 16967,  6835, 16968,  6836,  6841,
+	 6844,  8516,  6842, 16969, 16970,  6840,  6834, 16971,
+	 3251, 16972,  6851,  4051, 16973, 16974, 16975,  6849,
+	 6850, 16976,  6845,  6847, 16977,  6848, 16978,  6846,
+	// U+8740-U+877F
+	16979, 16980,  2983,  4348,  6855,  6856, 16981,  6862,
+	 2829,  6858, 16982,  6861,  6853,  6852,  6863, 16983,
+	16984,  1657,  6859,  6864,  6860,  8517, 16985,  6857,
+	 3308,  6854, 16986,  3643,
+	// U+8780-U+87BF
+	 6868,  8518,  8519, 16990, 16991,  4162, 16992,  6867,
+	16993,  6866, 16989,  6875,  8520,  8521,  6869,  6877,
+	 8522,  4205,  6880,  6871, 16996,
+	// U+87C0-U+87FF
+	 6872, 16998,  6876,  6879,  6878,  6870, 16999,  6873,
+	 6890,  8524, 17001,  6883, 17003, 17004, 17005, 17006,
+	17007,  8525, 17008,  6881,  6882, 17000,  6887,  6888,
+	 1701,  1913,  6886,
+	// U+8800-U+883F
+	17009, 17010,  6865,  8526,  8527, 17011,  6885,  6889,
+	 6884,  8528,  6891, 17012,  8529,  6893,  6892,  8530,
+	 6895,  6894,  6825,  6899, 17013, 17014,  6896, 17015,
+	 6897,  6898,  6900, 17016,
+	// U+8840-U+887F
+	 2143,  6902,  6901,  2647, 17018,  2307,  5740,  6903,
+	 2680,  1716, 17019,  6904,  1553,  2780,  6905, 17020,
+	 2308,  6906,  1474, 17021,  3788, 17024,  6907, 17026,
+	 2893,  6914,  6911,  3274,  6912,  6909,  2035,
+	// U+8880-U+88BF
+	 6908,  6915,  2089,  3163,  6921,  6917,  3122,  6916,
+	 8531,  6919,  6910, 17027,  6920,  6922,  8532,  3744,
+	 6918,  6923,  6925,  2212,  6913,  1442, 17028, 17029,
+	17030,  6924,
+	// U+88C0-U+88FF
+	17031,  2408,  4315,  6926,  6927,  3092,  8533,  8534,
+	 4231, 17034, 17032, 17035,  6928,  4156,  6929,  6930,
+	17036,  3921,  6931,  2381,  4232,  6936, 17037, 17038,
+	 6937,  2781,  6935,  8536,  4206,  6932,  6934,  2942,
+	 2913,
+	// U+8900-U+893F
+	17040,  6933,  6938,  3856,  6940,  6939,  1767,  3958,
+	 6941,  8539,  8540,  8541,  8537,  6953,  6943,  6944,
+	 8542,  6945,  6946,  8543,  8544,  6950, 17042,  6951,
+	 8545,  6949,
+	// U+8940-U+897F
+	 8546,  6947, 17044,  6942,  6948, 17045, 17046,  6952,
+	 7448,  1605,  6955,  2036,  6954, 17049,  6957,  6956,
+	 6959,  6958,  6960,  2648,  6961,  6962,  6963,  2943,
+	// U+8980-U+89BF
+	17050,  4190,  6964,  3857,  3609,  6965, 17051,  6966,
+	 2172,  1891, 17052,  6967,  8547,  2518,  3604,  6968,
+	 1739, 17053,  6969,  6971,  4222,  6970,  2857,  6972,
+	 6973, 17054,  6974,  1834, 17055,  6975,  6976,  6977,
+	// U+89C0-U+89FF
+	 6978,  1740,  8549, 17056, 17057,  6979,  6980,  6981,
+	 1679,  8550,  2827,  6982, 17058, 17060, 17061,  6983,
+	 8551,  6984, 17062, 17063,
+	// U+8A00-U+8A3F
+	 2193,  3380,  6985,  2122,  2873,  6988,  3481,  6987,
+	17065,  8552,  2084, 17066,  8553,  6986,  3188,  1892,
+	 6989,  6990,  2782, 17068,  8554,  2144,  6991,  3959,
+	 2976,  1965,  4126,  3049, 17069,  6992,  8555,  2858,
+	 3275,  2783, 17070,
+	// U+8A40-U+8A7F
+	 6993, 17071,  6996,  8556,  6997, 17072,  8557,  2379,
+	 3135,  6995,  2784,  3789, 17073,  6994,  8558,  2519,
+	 1554,  8559,  7001,  2123,  2521,  2520,  4368,  7000,
+	 6999,  3014,  1924,  4358,  1717,  2785,  8560,  8561,
+	 6998,
+	// U+8A80-U+8ABF
+	 7003,  7004,  7002,  2217,  4167,  2522,  3578, 17075,
+	 7007,  2945,  3229,  4157,  7010,  2237,  2944,  7006,
+	 7011,  2238,  7008,  7009,  8562,  7005,  2979,  3518,
+	17074,  3210,  1658, 17076,  3745,  1914, 17077,  3309,
+	// U+8AC0-U+8AFF
+	 7014,  7012,  3239,  2946,  1835,  7013,  2878,  8563,
+	 4271,  4355, 17078,  7015,  7026,  3310,  7025,  8564,
+	 7022,  7030,  7023,  7019,  3381,  7018,  7016,  4136,
+	 2523,  7020,  7017,  8565,  8566,  7024,  2715,  2194,
+	17079,  3191,
+	// U+8B00-U+8B3F
+	 3984,  1561,  1475,  3482, 17082,  7028, 17081,  7027,
+	17083,  3547,  7032,  7021,  7031,  7033,  2173,  7029,
+	 2309, 17084,  2590, 17085,  7034,  4191,  7037,  7040,
+	 7038,  3780, 17086,  7035,  2037,  7039,
+	// U+8B40-U+8B7F
+	 7041, 17087,  8570,  7045,  7042,  7044,  7043, 17089,
+	 8571,  7046,  2554,  8572,  7048,  7047,  3831, 17090,
+	 7050,  2124,  8573,  7049,  7051,  7052,  1915,  6518,
+	 2814,  7053, 17091,  2239,  7054, 17092,
+	// U+8B80-U+8BBF
+	 7055, 17093,  2473,  5403, 17094,  7056,  7057,  2649,
+	 7058,  7059, 17095, 17096,  7060,  7061,  7062, 17097,
+	 8574, 17098,
+	// U+8C00-U+8C3F
+	 3206, 17099,  7063, 17101,  7065,
+	// U+8C40-U+8C7F
+	 7064, 17104,  3483, 17105,  7066,  8575,  3960,  7067,
+	 7068, 17106,  7069, 17107,  7070, 17108,  3535,  2786,
+	 7071,  8576, 17109,  2330,  4431,  7072, 17110, 17111,
+	 7073,  3790,  7074,  7082,
+	// U+8C80-U+8CBF
+	 7075,  7077,  7076,  7078,  3985,  7079,  7080, 17114,
+	17113,  7081,  7083, 17115, 17117,  1704,  3360,  3832,
+	 2415,  2310, 17118,  3806,  1660,  3711,  7086,  1836,
+	 2966,  7085,  7090,  3284,  4108,  7088,  7089,  1893,
+	 7091,  3638,  3164,  3746,  3412,  7087,  3986,
+	// U+8CC0-U+8CFF
+	 1673,  7093,  4331,  3323,  4360,  2524,  7092,  3118,
+	 7109,  3015,  3565,  3807, 17120, 17119, 17121,  7096,
+	 2474,  2525,  2787,  3640,  8578,  2174,  7095,  7094,
+	 3833,  2570,  3433, 17123, 17124,  8579,  8580,  7098,
+	 7099,  2311,  7097,  8581,
+	// U+8D00-U+8D3F
+	 7100,  7101,  7103,  3104, 17126,  7102,  1855,  7105,
+	17127,  7104,  7106,  8583,  7108,  7110,  7111,  8584,
+	// U+8D40-U+8D7F
+	 2967,  2584,  7112,  1741, 17128,  7113,  3093,  7114,
+	 7115,  3834,  1894,
+	// U+8D80-U+8DBF
+	 7116, 17129,  3311,  1562, 17130,  7117,  2618, 17131,
+	 2905,  8585,  3114,  7120,  7119,
+	// U+8DC0-U+8DFF
+	 7118, 17133, 17134,  7126,  7124,  8586,  7121,  8587,
+	 7123,  8588, 17135,  7122,  7125,  1966,  7129,  2968,
+	 7130,  2218,  7127,  7128, 17136,  4332,  3312,  3016,
+	 7131, 17139,  7134,
+	// U+8E00-U+8E3F
+	17140,  7132,  7133,  4192, 17137,  3484,  7137, 17142,
+	17143,  7135,  7136,  7138,  8589, 17144, 17145,  8590,
+	17146,  7152,  7141,  7142,  7140, 17149, 17150,  8591,
+	// U+8E40-U+8E7F
+	 7139,  3382,  7144,  7148,  7145,  7143, 17151,  7146,
+	 7147, 17152,  7154,  7149,  2969,  7151, 17153,  7153,
+	 7150, 17154, 17155, 17156,  8592,  7156,  2650,  7155,
+	 8593,  7157,
+	// U+8E80-U+8EBF
+	 7158,  7161,  7160,  7159,  7163,  7162,  4127,  7165,
+	 7164,  7166, 17157,  7167, 17158,  7169,  7168,  2859,
+	 7170, 17159,  2050,  7171,  7173, 17160, 17161, 17162,
+	17163,  7174,
+	// U+8EC0-U+8EFF
+	 8595,  7175,  7172,  7176,  2591,  7177,  1895,  2086,
+	17165,  2175, 17166,  7178,  3557,  3413,  7179,  7182,
+	 2557, 17168,  8597,  7181,  7180,  2125,  7183,
+	// U+8F00-U+8F3F
+	17170,  1742,  7185, 17171,  2409,  7184,  7193,  7187,
+	 7189,  3922,  7186, 17172,  7188,  7192,  7190,  1896,
+	 8598,  7191,  7194,  3629,  4285, 17173,  8599,  2651,
+	 7195,  8600,  4137,  7197,  7196,  7200,  4168,
+	// U+8F40-U+8F7F
+	17174,  7199,  1768,  7198,  7203,  7202, 17175,  7201,
+	 3401,  7204,  8601,  7205, 17176,  7206,  2331,  2072,
+	 7207,  7208,  7209,
+	// U+8F80-U+8FBF
+	 2860,  7210,  2550,  7211,  7212, 17178,  8603,  4606,
+	 4605,  7213,  6471,  7214,  3199,  2830,  3603, 17179,
+	 8604, 17181,  7215,  3906,  3341,  2349,  3204,
+	// U+8FC0-U+8FFF
+	17183,  1513,  4035,  2874, 17184, 17186, 17187,  2129,
+	 2038, 17188,  3907, 17189,  7216, 17190,  7218,  8605,
+	 7217,  1661,  8606,  3563,  7219,  3658,  3402,  8607,
+	 7220,  2681, 17191,  7222, 17192,  4075,  7237,  7224,
+	 7225, 17193,  3330,
+	// U+9000-U+903F
+	 3165,  3094, 17194,  3485,  7223,  1932,  8608,  7232,
+	17195,  7229,  7242,  3486,  3259,  7226,  3383,  3434,
+	 7227,  7231,  2883,  3642,  3333,  2947,  7230,  3115,
+	 3105,  7228,  1418,  4325,  7233,  8609,  3166,  2652,
+	 2861,  7235,  7234, 17196,  1488,  7236,  3774,  7244,
+	// U+9040-U+907F
+	 3536,  2894, 17198, 17199,  3252,  2061,  7243,  4158,
+	 1534,  3908,  1662,  7238,  7239,  7240,  7241,  3504,
+	 3198,  1476,  7245,  7246,  7804,  3130, 17200,  7247,
+	 1586,  3051,  2176,  4193,  7248,  3395,  3095,  2592,
+	 7249,  7252,  2700,  7250,  3018,  3017,  1477,  4272,
+	 7254,  3747,
+	// U+9080-U+90BF
+	 7256,  7255,  7253,  6271,  1837, 17203,  7221,  8611,
+	 7258,  7257, 17204,  7259, 17205,  4159,  8612,  8613,
+	 8614,  8615, 17207,  8616,  3542,  3961,  7260,  2594,
+	 7261, 17209,  7262,  8617,  7263, 17210,  3384,  8618,
+	// U+90C0-U+90FF
+	 1483, 17211,  8619,  8620,  8621, 17212,  2312,  4349,
+	 8622,  7267, 17214,  8623,  8624, 17215,  2087,  7264,
+	 7265,  3843, 17220,  1743,  8625, 17218,  8626,  4160,
+	17217,  2004,  3435, 17221, 17222,
+	// U+9100-U+913F
+	17219,  7268, 17223, 17224,  7269,  8628,  8629,  8630,
+	17225,  7270, 17226, 17227,  8631,  8632,  8633,  3385,
+	 8634,  7272,  8635,  7271,  8636, 17228, 17229, 17230,
+	 8637,
+	// U+9140-U+917F
+	17231, 17232,  8638,  3528,  7273,  2653,  2601,  3630,
+	 3276,  2619,  2895,  7274, 17233,  7275, 17234,  8639,
+	17235,  2880,  7276, 17236,  7277,  7278,  4214,  2654,
+	 7280,  7279, 17237,  2313,  2338,  2475, 17238,
+	// U+9180-U+91BF
+	 7283,  8640, 17239,  2701,  7282,  7281,  3174, 17240,
+	 2240,  2948,  3681,  2656,  8641,  7284,  2788, 17241,
+	 7287,  7285,  8642, 17242,  7286,  8643, 17243,  7289,
+	 7288, 17244,  2815,  7290,  8644,
+	// U+91C0-U+91FF
+	 7291,  7292, 17245, 17246,  3713,  2400,  2602,  7293,
+	 7294,  4233,  2668,  4119,  4273,  7295,  2039,  7296,
+	 8645,  3386, 17247,  7299,  1779,  2862,  7297,  7298,
+	 3353,  8647,  8648,  4000,  2065, 17250,  8649, 17251,
+	 8650,  7301,  7302,  8646,  7300,  7304,
+	// U+9200-U+923F
+	17252,  8651, 17253,  3540,  1726,  8652,  7308,  7305,
+	 7307, 17254, 17255,  7303,  7378,  7306, 17257,  4304,
+	 2219,  8653,  8654,  8655,  8656,  7316,
+	// U+9240-U+927F
+	 8657, 17258,  8658,  3403,  7311, 17259,  7314,  7312,
+	17260,  7317, 17261,  8659,  7318, 17262, 17263,  7310,
+	17264,  7323,  1587,  7309, 17265, 17266,  3678,  7313,
+	17267,  2789, 17268, 17269,  2314,  8660, 17272, 17273,
+	 3987, 17274,
+	// U+9280-U+92BF
+	 2041,  2669,  3505,  8661, 17275, 17276,  3020,  7321,
+	 7315,  7320, 17277,  4076, 17278,  3313,  7322,  7319,
+	17279, 17280, 17281,  3019, 17284,  7326,  7325, 17285,
+	// U+92C0-U+92FF
+	17286,  8662, 17287,  8663,  8664, 17288,  7324, 17289,
+	 3962,  8665, 17290, 17291,  8666,  2722, 17292, 17293,
+	 7327,  3916,  1555,  3797,  3277, 17297,  1967, 17298,
+	 7329, 17299,  2316,  8667,
+	// U+9300-U+933F
+	17300,  8668,  2455, 17301,  7328,  2896, 17294, 17302,
+	 2897,  7332,  7334, 17303, 17304,  8669,  2816,  8670,
+	 7333,  7335,  8671,  2024, 17305,  3796, 17306,  2603,
+	 4326,  7331,  2437,  4354,  7337,  7336,  7338,
+	// U+9340-U+937F
+	 7330, 17309,  8672,  8673,  8674,  3550,  3436, 17310,
+	 3344,  7343, 17311, 17312,  3230,  7339,  7340,  8675,
+	 8676,  8677, 17313,  2080,  7342,  8678, 17314, 17315,
+	 2177,  7341,  2790,
+	// U+9380-U+93BF
+	17319, 17320,  1780, 17321,  7347,  2380,  3096,  3331,
+	 8679, 17322, 17316,  8680,  1718,  7345,  7346,  3324,
+	 7344,  7348,  8681,
+	// U+93C0-U+93FF
+	17327,  7354,  8682, 17328,  7357,  7356,  3396,  7349,
+	 7350,  7353, 17329,  7355,  8683,  8684,  2005, 17330,
+	 7358,  7352, 17331,  7351, 17326, 17323, 17336,  8686,
+	// U+9400-U+943F
+	 7362,  8685,  7363, 17332, 17333,  7364,  7361,  7360,
+	17334, 17335,  2791,  3487,  7359,  7368,  7366, 17337,
+	 8687, 17338,  7367,  7365,  3189,  7369, 17339,
+	// U+9440-U+947F
+	 7370,  7372, 17340,  8688,  1838,  7371,  4131,  7383,
+	 7373,  7376,  7374,  7375,  8689,  7377,  8690, 17343,
+	17344,  7379,  8691,  8692,  7380,  7381,  7384,  7382,
+	 7385,  7387,
+	// U+9480-U+94BF
+	 7386,
+	// U+9540-U+957F
+	 3314, 17345, 17346,
+	// U+9580-U+95BF
+	 4112,  7388,  3021, 17347,  7389,  3889,  7390,  1702,
+	17348, 17349,  8693,  1531,  1840,  1839,  7391,  7392,
+	 7393,  7394,  8694,  7395,  1841,  1744,  2317,  3687,
+	 8695,  7397,  7396,  8696, 17351,  8697,  7398,  1563,
+	17352,  8698,  7401,  7400,  7399,  8699,  7402,
+	// U+95C0-U+95FF
+	 7405,  1448, 17354,  7403,  8700,  7407,  7406,  8701,
+	 8702,  7409,  7408,  7410,  3491,  8704,  7411,  8705,
+	 7412,  7414,  7413,
+	// U+9600-U+963F
+	 3835, 17206,  7415,  7416,  2418, 17357,  7417,  7418,
+	 3988, 17358, 17359,  3050, 17361,  1413,
+	// U+9640-U+967F
+	 3144, 17362,  7419,  3836,  7422,  7420,  2318,  7421,
+	 2195,  8706,  3890,  7424,  7426,  7425,  7427, 17363,
+	 1504,  2875,  2723,  1842,  7428,  3641,  7430,  1505,
+	 7429,  3325,  4274,  3488,  7423,  4235,  2178,  4194,
+	// U+9680-U+96BF
+	17365,  8707,  2062,  4249,  2075,  3167,  6580,  7431,
+	 1703,  2898,  1745,  7433,  7434,  7432,  2135, 17367,
+	 2410,  2792,  8709,  1506,  4286,  8710,  8711,  7436,
+	 7251, 17370,  7435, 17371,  7439,  7437,  7438, 17372,
+	 7440,  7441,  4305,  7442,  7443, 17373,  2954,  3692,
+	17374,
+	// U+96C0-U+96FF
+	 2912,  1856,  4161,  1674,  2655,  2220,  7446,  7445,
+	 2526,  7447,  7444,  2451,  8712,  7451,  6874, 17377,
+	 4659, 17378,  2906,  7449, 17379,  8713,  4234,  3558,
+	 1514,  8715,  2980,  2559,  8716,  3876,  1535,  4306,
+	 4210,  7452,  3420,
+	// U+9700-U+973F
+	 2628,  7453,  7454,  2863,  7455,  4307,  7450,  7457,
+	 7459,  7458,  7456, 17381,  7460,  7461,  3097,  1663,
+	17382,  7462,  4065,  7463,  7464,  4333,  8717, 17384,
+	 5468,  7465,  8718,  7466,  7467,
+	// U+9740-U+977F
+	17385,  7471,  7468,  7469, 17386,  7470,  7472,  8719,
+	 8720,  8721,  2949, 17387,  4128, 17388,  2950,  8722,
+	17389,  7473,  3748,  7474,  7758,  4085,  7475,  7476,
+	 7477,  1746, 17390,  7479,  2876,  8723,  7480,  8724,
+	 2071,  7481,  7485,  7483,
+	// U+9780-U+97BF
+	 7484,  1774,  7482,  7486,  7487,  1449,  7488,  7489,
+	 8725, 17393,  2793, 17394,  7490, 17395,  1918, 17396,
+	 7493,  7492,  7491,  7036,  3913,  8726, 17397, 17398,
+	 7494,  7495,  8727, 17399,
+	// U+97C0-U+97FF
+	 8728,  7496,  7497,  7498,  8729,  7499, 17400, 17401,
+	 1843, 17402, 17403, 17404,  8731,  7500,  8730, 17405,
+	 7501,  3574, 17406,  7503,  1624,  8732,  7506,  7505,
+	 1507,  2006,
+	// U+9800-U+983F
+	 3892,  3315,  2351, 17407,  2319,  2702,  2879,  8734,
+	 7508, 17408, 17409,  7507,  4169,  1857,  3715,  3537,
+	17410, 17411,  2911,  4275,  2126,  8735,  7511, 17414,
+	 7510, 17417,  8736,  3990,  3489,  8737, 17415, 17416,
+	 1551,  7512,  7509,  3808,  4209,  7513,
+	// U+9840-U+987F
+	 7514, 17418,  7516,  3175,  1750,  1751,  7515,  8739,
+	 8740,  1858,  2179,  8741,  8742,  1859,  8743,  8744,
+	 3414,  4293,  8746, 17419,  2221,  7517,  8747,  7518,
+	 7519,  7520,  7522,  7521,
+	// U+9880-U+98BF
+	 3846,  7523, 17420, 17421,  7524, 17422,  7525,  7526,
+	17424, 17425,  8748, 17426, 17427, 17428,
+	// U+98C0-U+98FF
+	17429,  7528,  7527,  7529, 17430,  8749, 17431,  3749,
+	 6529,  2828, 17432, 17434,  1897, 17435, 17436,  8750,
+	 7530, 17437,  7531,  4617,  5666,  3716, 17438, 17439,
+	 1500, 17440,  1436,  2527,  3963,  2819,
+	// U+9900-U+993F
+	 7532,  4104, 17441,  7533,  4195,  1537,  2476,  7534,
+	 1675,  7535, 17444, 17445,  7536, 17447, 17448, 17449,
+	 7538,  7539,  7541,  7537,  7540,  1844,  7542,  7543,
+	17451, 17452, 17453, 17454, 17455, 17456,  7544,  7545,
+	// U+9940-U+997F
+	17457, 17458,  7546,  7548, 17459,  7547,  7550,  7553,
+	17460, 17461,  7549,  7551,  7552,  7554,  2007,  8751,
+	17462, 17463, 17464,
+	// U+9980-U+99BF
+	 2620,  7555,  7556,  2320,  8752, 17465,  7557, 17466,
+	 1721,  3618,  7558,  7559,  3253,  3552, 17467,  7560,
+	17468, 17469,
+	// U+99C0-U+99FF
+	 3664, 17470,  3145,  1559,  2051,  2052, 17471,  3278,
+	 7565,  2053, 17472,  1676,  7564, 17473,  7562,  7563,
+	17474,  7561,  7575,  7566,  7567, 17476,  7568,  7569,
+	 7571, 17477,  7570, 17478,  2688,
+	// U+9A00-U+9A3F
+	 7572,  8753,  8754,  7574, 17479,  1898,  7573, 17480,
+	 3098,  2180, 17481,  7576, 17482, 17483,  8755,  3146,
+	 7577,  8756,  8757,  3490, 17484, 17485,  7578,  8758,
+	 7583,
+	// U+9A40-U+9A7F
+	 7581,  7580,  7582, 17486,  7579,  8759, 17487,  7585,
+	 8760,  8761,  7584,  7587, 17488,  2008,  7586,  7588,
+	 7589,  7591,  7590,  7592,  7594,  7593,
+	// U+9A80-U+9ABF
+	 2347,  7595, 17490,  7596,  8762, 17492,  1719, 17494,
+	 7597,
+	// U+9AC0-U+9AFF
+	 7598,  8763,  8764,  2900, 17496,  8765,  7599, 17497,
+	 7600, 17498,  7601,  7602, 17499,  8766,  2321, 17501,
+	 7603,  7604, 17502,  7605,  7606, 17503,  7607, 17504,
+	 3682,  7609,  3765,  7610,  7608,  7612,  7611,  7613,
+	 8767,  7614,
+	// U+9B00-U+9B3F
+	 8768, 17505,  7615,  8769, 17506, 17507, 17508, 17509,
+	 7616,  7617, 17510,  7618,  8770,  7619,  7620,  7621,
+	 7622,  7623,  7624,  7625, 17511,  8772,  7626,  7627,
+	 5660,  7628, 17512,  6385,  1899, 17513,
+	// U+9B40-U+9B7F
+	 1692,  2367,  7630,  7629,  4046, 17515,  7632,  7633,
+	 7631,  7634,  4013,  7635,  1970,  8773, 17516, 17517,
+	 8775, 17518, 17519,  4328,  8776, 17520,  7636,  8777,
+	17521, 17522,  8774,
+	// U+9B80-U+9BBF
+	 7638,  8778,  8779,  1439,  8780,  7639,  3864,  7637,
+	 7640,  7641,  8781,  7642,  7643, 17523,  8782,  7644,
+	 4025,  2456, 17524,  2439,  3022, 17525, 17528,  7645,
+	17529,  7648, 17530,
+	// U+9BC0-U+9BFF
+	 7646,  8783,  7649, 17531,  2242,  7647,  8784,  7650,
+	 7651,  7652,  7656,  2453, 17533,  3169, 17534,  7657,
+	 7654,  7653,  7655,  8785, 17535,  2130, 17536, 17537,
+	17539, 17538,  7661,  7660,  7659, 17532,  1428, 17543,
+	 8786, 17541,  8787,
+	// U+9C00-U+9C3F
+	 8788,  7671,  7667,  7668,  7664,  7670,  7666,  1757,
+	 4367,  7669,  7665,  7663,  7662, 17545, 17546, 17547,
+	17548,  7673, 17549,  7676, 17550,  8789,  7675,  7674,
+	17551, 17552, 17553,  3800,  7672,  1492,  7677, 17555,
+	 7679, 17556, 17557,  1770,  7658,  1526,  7681,
+	// U+9C40-U+9C7F
+	 8790, 17558,  7680,  7678,  3208, 17561, 17562,  8791,
+	 8792,  4027,  8793, 17564,  4287, 17565,  7682, 17566,
+	17559, 17567, 17568,  7683,  8794,  8795,  7684, 17569,
+	17570, 17571, 17572, 17573, 17574, 17575, 17576,  7685,
+	 8796,  7686, 17577,
+	// U+9CC0-U+9CFF
+	 3316, 17578,  7687,  3688,  7692,  7688,  7689, 17579,
+	 3964,  4077,  3525,
+	// U+9D00-U+9D3F
+	17581,  7693,  7694,  3507,  7691,  7690, 17580,  1607,
+	17583,  7702,  7701, 17584, 17585,  1588,  8797,  8798,
+	 7699,  7698,  7696,  1782,  7695,  2555,  1606, 17589,
+	 2322,  7705,  7704,
+	// U+9D40-U+9D7F
+	 7703, 17591,  8799,  7700,  7706,  8800,  7707, 17592,
+	 7712,  7711,  8801,  7713,  1516,  7708,  7709, 17593,
+	 2339,  4066, 17594,  8802,  7710, 17596, 17597,  3965,
+	 7718,  8803,  7714, 17599, 17600, 17601,  7719,  8804,
+	17602,
+	// U+9D80-U+9DBF
+	17603,  7716,  7715,  8805, 17604,  2127,  8806, 17605,
+	 7720, 17606,  7721,  7722,  7717,  8808,  7697,  7723,
+	 3354, 17608,  7727, 17609,  7728,  7726,  8809, 17610,
+	17607,
+	// U+9DC0-U+9DFF
+	 8807,  7725,  7731, 17611,  7724,  7729, 17612, 17613,
+	 7730,  7733, 17614,  8810,  7732, 17615, 17616, 17617,
+	17618,  7735,  8812,  7736,  7737,  4364, 17619,  7734,
+	 3176,  2426,  7738,
+	// U+9E00-U+9E3F
+	17622,  8813, 17621, 17623,  8814, 17624,  7739,  7740,
+	17625, 17626,  7741,
+	// U+9E40-U+9E7F
+	 7742,  2181,  7743, 17627,  8815,  7744,  2552,
+	// U+9E80-U+9EBF
+	17629,  7745, 17630,  7746,  7747,  7748,  7751,  7749,
+	 4351,  7750,  4308, 17631,  7752,  8816,  4288,  8817,
+	 7753,  3665, 17632,  7754,  7756,  8818,  7757,  8819,
+	 8820,  8821,  7755,  2332,  4086,  4014,  5068, 17634,
+	 5703,  4038,
+	// U+9EC0-U+9EFF
+	 8822,  1608,  7759,  1927,  7760,  7761,  7762,  8823,
+	 2340,  7763,  5973,  4100,  3168,  7764,  7766,  7765,
+	17636,  7767,  7768, 17637,  7769, 17638,  7770,  7771,
+	 7772,  7773,  7774,  7775,  7776,  7777, 17639,
+	// U+9F00-U+9F3F
+	17640, 17642,  7778,  7779,  3387,  8824,  2222,  7781,
+	17643, 17644,  3052,  7782,  7783, 17645, 17646,  8825,
+	17647,  3760, 17648,  7784,
+	// U+9F40-U+9F7F
+	17649, 17650, 17651,  7785,  6226,  7107,  7502,  7786,
+	17652,  7787, 17653,  8826, 17654, 17656,  7789,  7790,
+	 7791,  4309,  7788,  7792,  7793, 17658,  7795,  7794,
+	17660, 17661,  7797, 17662,  7798,  7796,
+	// U+9F80-U+9FBF
+	 4251,  8827,  8828,  7799,  8829,  7800,  6255,  7801,
+	 8830,
+	// U+F900-U+F93F
+	 8016,  7815,  7941,  8506,
+	// U+F940-U+F97F
+	 8030,
+	// U+F9C0-U+F9FF
+	 8745,  8708,
+	// U+FA00-U+FA3F
+	 1358,  1370,  4405, 10146,  7985,  8141,  8162,  8299,
+	 8300,  8304,  8485, 16943, 16956,  8567, 17185,  8627,
+	 1245,  1262,  1269,  1288,  1293,  1299,  1327,  1330,
+	 1337,  1373,  1377,  4388,  4389,  7849,  7861,  7863,
+	// U+FA40-U+FA7F
+	 7866,  7903,  7906,  7930,  7964,  8062,  8076,  8088,
+	 8136, 16270,  8182,  8278,  8290,  8291,  8294,  8295,
+	 8296,  8298,  8302,  8303,  8316,  8320,  8339,  8379,
+	16685,  8384,  8391,  8401,  8421, 16815, 16816,  8466,
+	 8538,  8548,  8568,  8569,  8577,  8582, 17180,  8610,
+	 8714,  8733,  8738,
+	// U+FE40-U+FE7F
+	  217,   216,
+	// U+FF00-U+FF3F
+	    9,   109,    83,    79,    82,    84,   108,    41,
+	   42,    85,    59,     3,   110,     4,    30,   203,
+	  204,   205,   206,   207,   208,   209,   210,   211,
+	  212,     6,     7,    66,    64,    67,     8,    86,
+	  220,   221,   222,   223,   224,   225,   226,   227,
+	  228,   229,   230,   231,   232,   233,   234,   235,
+	  236,   237,   238,   239,   240,   241,   242,   243,
+	  244,   245,    45,    31,    46,    15,    17,
+	// U+FF40-U+FF7F
+	   13,   252,   253,   254,   255,   256,   257,   258,
+	  259,   260,   261,   262,   263,   264,   265,   266,
+	  267,   268,   269,   270,   271,   272,   273,   274,
+	  275,   276,   277,    47,    34,    48,   111,   147,
+	  148, 17833, 17834, 17835, 17836, 17837, 17838, 17839,
+	17840, 17841, 17842, 17843, 17844, 17845, 17846, 17847,
+	17848, 17849, 17850, 17851, 17852, 17853, 17854, 17855,
+	17856, 17857, 17858, 17859, 17860, 17861, 17862, 17863,
+	// U+FF80-U+FFBF
+	17864, 17865, 17866, 17867, 17868, 17869, 17870, 17871,
+	17872, 17873, 17874, 17875, 17876, 17877, 17878, 17879,
+	17880, 17881, 17882, 17883, 17884, 17885, 17886, 17887,
+	17888, 17889, 17890, 17891, 17892, 17893, 17894, 17895,
+	// U+FFC0-U+FFFF
+	   16,    78
+	};
+
+	// Unicode (U+10000 and above) to JIS X 0213 (sorted codepoints and their indices)
+	inline constexpr int UNICODE_2_JISX0213_SUPPLEMENTARY_SIZE = 303;
+	inline constexpr int unicode_2_jisx0213_supplementary_key[UNICODE_2_JISX0213_SUPPLEMENTARY_SIZE] = {
+	0x02000b, 0x020089, 0x0200a2, 0x0200a4, 0x0201a2, 0x020213, 0x02032b, 0x020371,
+	0x020381, 0x0203f9, 0x02044a, 0x020509, 0x0205d6, 0x020628, 0x02074f, 0x020807,
+	0x02083a, 0x0208b9, 0x02097c, 0x02099d, 0x020ad3, 0x020b1d, 0x020b9f, 0x020d45,
+	0x020de1, 0x020e64, 0x020e6d, 0x020e95, 0x020f5f, 0x021201, 0x02123d, 0x021255,
+	0x021274, 0x02127b, 0x0212d7, 0x0212e4, 0x0212fd, 0x02131b, 0x021336, 0x021344,
+	0x0213c4, 0x02146d, 0x02146e, 0x0215d7, 0x021647, 0x0216b4, 0x021706, 0x021742,
+	0x0218bd, 0x0219c3, 0x021c56, 0x021d2d, 0x021d45, 0x021d62, 0x021d78, 0x021d92,
+	0x021d9c, 0x021da1, 0x021db7, 0x021de0, 0x021e33, 0x021e34, 0x021f1e, 0x021f76,
+	0x021ffa, 0x02217b, 0x022218, 0x02231e, 0x0223ad, 0x0226f3, 0x02285b, 0x0228ab,
+	0x02298f, 0x022ab8, 0x022b46, 0x022b4f, 0x022b50, 0x022ba6, 0x022c1d, 0x022c24,
+	0x022de1, 0x0231b6, 0x0231c3, 0x0231c4, 0x0231f5, 0x023372, 0x0233d0, 0x0233d2,
+	0x0233d3, 0x0233d5, 0x0233da, 0x0233df, 0x0233e4, 0x02344a, 0x02344b, 0x023451,
+	0x023465, 0x0234e4, 0x02355a, 0x023594, 0x0235c4, 0x023638, 0x023639, 0x02363a,
+	0x023647, 0x02370c, 0x02371c, 0x02373f, 0x023763, 0x023764, 0x0237e7, 0x0237ff,
+	0x023824, 0x02383d, 0x023a98, 0x023c7f, 0x023cfe, 0x023d00, 0x023d0e, 0x023d40,
+	0x023dd3, 0x023df9, 0x023dfa, 0x023f7e, 0x024096, 0x024103, 0x0241c6, 0x0241fe,
+	0x0243bc, 0x024629, 0x0246a5, 0x0247f1, 0x024896, 0x024a4d, 0x024b56, 0x024b6f,
+	0x024c16, 0x024d14, 0x024e0e, 0x024e37, 0x024e6a, 0x024e8b, 0x02504a, 0x025055,
+	0x025122, 0x0251a9, 0x0251cd, 0x0251e5, 0x02521e, 0x02524c, 0x02542e, 0x02548e,
+	0x0254d9, 0x02550e, 0x0255a7, 0x025771, 0x0257a9, 0x0257b4, 0x0259c4, 0x0259d4,
+	0x025ae3, 0x025ae4, 0x025af1, 0x025bb2, 0x025c4b, 0x025c64, 0x025da1, 0x025e2e,
+	0x025e56, 0x025e62, 0x025e65, 0x025ec2, 0x025ed8, 0x025ee8, 0x025f23, 0x025f5c,
+	0x025fd4, 0x025fe0, 0x025ffb, 0x02600c, 0x026017, 0x026060, 0x0260ed, 0x026270,
+	0x026286, 0x02634c, 0x026402, 0x02667e, 0x0266b0, 0x02671d, 0x0268dd, 0x0268ea,
+	0x026951, 0x02696f, 0x0269dd, 0x026a1e, 0x026a58, 0x026a8c, 0x026ab7, 0x026aff,
+	0x026c29, 0x026c73, 0x026cdd, 0x026e40, 0x026e65, 0x026f94, 0x026ff6, 0x026ff7,
+	0x026ff8, 0x0270f4, 0x02710d, 0x027139, 0x0273da, 0x0273db, 0x0273fe, 0x027410,
+	0x027449, 0x027614, 0x027615, 0x027631, 0x027684, 0x027693, 0x02770e, 0x027723,
+	0x027752, 0x027985, 0x027a84, 0x027bb3, 0x027bbe, 0x027bc7, 0x027cb8, 0x027da0,
+	0x027e10, 0x027fb7, 0x02808a, 0x0280bb, 0x028277, 0x028282, 0x0282f3, 0x0283cd,
+	0x02840c, 0x028455, 0x02856b, 0x0285c8, 0x0285c9, 0x0286d7, 0x0286fa, 0x028946,
+	0x028949, 0x02896b, 0x028987, 0x028988, 0x0289ba, 0x0289bb, 0x028a1e, 0x028a29,
+	0x028a43, 0x028a71, 0x028a99, 0x028acd, 0x028add, 0x028ae4, 0x028bc1, 0x028bef,
+	0x028d10, 0x028d71, 0x028dfb, 0x028e1f, 0x028e36, 0x028e89, 0x028eeb, 0x028f32,
+	0x028ff8, 0x0292a0, 0x0292b1, 0x029490, 0x0295cf, 0x02967f, 0x0296f0, 0x029719,
+	0x029750, 0x0298c6, 0x029a72, 0x029ddb, 0x029e15, 0x029e3d, 0x029e49, 0x029e8a,
+	0x029ec4, 0x029edb, 0x029ee9, 0x029fce, 0x02a01a, 0x02a02f, 0x02a082, 0x02a0f9,
+	0x02a190, 0x02a38c, 0x02a437, 0x02a5f1, 0x02a602, 0x02a61a, 0x02a6b2
+	};
+	inline constexpr short unicode_2_jisx0213_supplementary_index[UNICODE_2_JISX0213_SUPPLEMENTARY_SIZE] = {
+	 1223,  8836,  8846,  8849,  8857,  8873,  8915,  8924,
+	 8922,  9025,  9028,  9030,  9040,  9041,  9047,  9054,
+	 9056,  9065,  9073,  9074,  9080,  9083,  4375,  9110,
+	 9127,  9143,  9135,  9134,  9146,  9174,  1349,  9177,
+	 9184,  9179,  9192,  9191,  9199,  1359,  9201,  9202,
+	 9216,  9229,  1379,  9241,  9250,  4390,  9264,  9265,
+	 1406,  9305,  9509,  9516,  9517,  9520,  9519,  9530,
+	 9525,  9524,  9533,  9535,  9536,  4401,  9552,  9563,
+	 9569,  9871, 17628,  9880,  9885,  9917,  9938,  9946,
+	 9951,  9967,  9981,  9972,  9973,  9984,  9983,  9988,
+	10017, 10061, 10056,  7921, 10060, 10083, 10091, 10086,
+	10085, 10093, 10096, 10098, 10092, 10110, 10112, 10111,
+	10116, 10144, 10145, 10161,  7977, 10185, 10182, 10186,
+	10183, 10208, 10197,  7998,  8007, 10216, 10225, 10224,
+	10231, 10236, 16076, 16093,  8053, 16114, 16722, 16133,
+	16137, 16136, 16135, 16185, 16206, 16212, 16232, 16235,
+	16263, 16280, 16286,  8159, 16312, 16352, 16369, 16371,
+	16376, 16391, 16416, 16420, 16425, 16428, 16440, 16442,
+	16445, 16450, 16453, 16452, 16457, 16461, 16478,  8271,
+	16489,  8280, 16508,  8310, 16534, 16535,  8323, 16561,
+	16573, 16572, 16575, 16593, 16604, 16605,  8349, 16626,
+	16627, 16630, 16628, 16636, 16634, 16639, 16641, 16644,
+	16652, 16651, 16658, 16657, 16666, 16671, 16684, 16710,
+	16712, 16719, 16726, 16752, 16757, 16769, 16785, 16787,
+	16789, 16792, 16794, 16798, 16805, 16811, 16814,  8426,
+	 9247, 16861, 16871,  8478, 16886, 16910, 16920, 16921,
+	16919,  8500, 16938, 16941, 16988, 16987, 16994, 16997,
+	17002, 17023, 17022, 17025,  8535, 17033, 17041, 17043,
+	17047, 17067, 17080, 17100, 17102, 17103, 17112, 17122,
+	17125, 17132, 17141, 17147,  8594, 17164, 17169,  8602,
+	17177, 17182, 17197, 17201, 17202, 17213, 17216, 17249,
+	17248, 17256, 17270, 17271, 17282, 17283, 17295, 17296,
+	17308, 17307, 17317, 17318, 17325, 17324, 17341, 17342,
+	17350, 17353, 17355, 17356, 17360, 17364, 17366, 17368,
+	17376, 17391, 17392, 17413, 17423, 17433, 17443, 17446,
+	17450, 17475, 17495, 17526, 17540, 17527, 17544, 17542,
+	17554, 17563, 17560, 17582, 17588, 17586, 17598, 17595,
+	 8811, 17633, 17635, 17655, 17657, 17659, 17663
+	};
+}
+
+#endif // INCLUDED_JISX0213_TABLE_H_
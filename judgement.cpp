@@ -1,5 +1,6 @@
 // judgement.cpp
 #include "encoding.h"
+#include "utf8.h"
 
 Encoding::EncodingType Encoding::getEncoding(const unsigned char *src, unsigned int src_size)
 {
@@ -11,7 +12,7 @@ Encoding::EncodingType Encoding::getEncoding(const unsigned char *src, unsigned
 	 *   UTF-8 without BOM, Shift_JIS, EUC-JP
 	 *     Calculate the "similarity value" and choose the largest one.
 	 */
-	int utf8 = 0, sjis = 0, eucjp = 0;
+	int utf8 = 0, sjis = 0, eucjp = 0, codepoint;
 	unsigned char b1, b2, b3;
 
 	// check UTF-16 BOM
@@ -27,7 +28,7 @@ Encoding::EncodingType Encoding::getEncoding(const unsigned char *src, unsigned
 	}
 
 	// find UTF-16 encoded ASCII
-	for (unsigned int i = 0; i < src_size - 1; i += 2) {
+	for (unsigned int i = 0; i + 1 < src_size; i += 2) {
 		if (src[i] == 0x00 || src[i + 1] == 0x00) return UTF16;
 	}
 
@@ -39,25 +40,9 @@ Encoding::EncodingType Encoding::getEncoding(const unsigned char *src, unsigned
 			++utf8;
 			continue;
 		}
-		// other errors
-		if (b1 < 0xc2 || 0xfd < b1) continue;
-		// 2~6 bytes sequence
-		unsigned char sup = 0xdf;
-		for (int bytes = 2; bytes <= 6; ++bytes) {
-			if (b1 <= sup && i <= src_size - bytes) {
-				bool p = true;
-				for (int n = 1; n < bytes; ++n) {
-					b2 = src[i + n];
-					if (b2 < 0x80 || 0xbf < b2) {
-						p = false;
-						break;
-					}
-				}
-				if (p) utf8 += bytes, i += bytes - 1;
-				break;
-			}
-			sup = (sup >> 1) | 0x80;
-		}
+		// 2~4 bytes sequence (same DFA as the decoder)
+		const int bytes = utf8_sequence(src + i, src_size - i, codepoint);
+		if (bytes > 0) utf8 += bytes, i += bytes - 1;
 	}
 
 	// calculate Shift_JIS similarity
@@ -66,7 +51,7 @@ Encoding::EncodingType Encoding::getEncoding(const unsigned char *src, unsigned
 		// 1 byte sequence
 		if (b1 <= 0x7f || (0xa1 <= b1 && b1 <= 0xdf)) ++sjis;
 		// 2 bytes sequence
-		else if (((0x81 <= b1 && b1 <= 0x9f) || (0xe0 <= b1 && b1 <= 0xfc)) && i < src_size - 1) {
+		else if (((0x81 <= b1 && b1 <= 0x9f) || (0xe0 <= b1 && b1 <= 0xfc)) && i + 1 < src_size) {
 			b2 = src[i + 1];
 			if (b2 != 0x7f && 0x40 <= b2 && b2 <= 0xfc) sjis += 2, ++i;
 		}
@@ -78,12 +63,12 @@ Encoding::EncodingType Encoding::getEncoding(const unsigned char *src, unsigned
 		// 1 byte sequence
 		if (b1 <= 0x7f) ++eucjp;
 		// 3 bytes sequence (JIS X 0213 plane 2)
-		else if (b1 == 0x8f && i < src_size - 2) {
+		else if (b1 == 0x8f && i + 2 < src_size) {
 			b2 = src[i + 1], b3 = src[i + 2];
 			if (0xa1 <= b2 && b2 <= 0xfe && 0xa1 <= b3 && b3 <= 0xfe) eucjp += 3, i += 2;
 		}
 		// 2 bytes sequence
-		else if (i < src_size - 1) {
+		else if (i + 1 < src_size) {
 			b2 = src[i + 1];
 			// JIS X 0201 kana/JIS X 0213 plane 1
 			if (b1 == 0x8e || (0xa1 <= b1 && b1 <= 0xfe && 0xa1 <= b2 && b2 <= 0xfe)) eucjp += 2, ++i;
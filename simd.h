@@ -0,0 +1,85 @@
+// simd.h
+#ifndef INCLUDED_SIMD_H_
+#define INCLUDED_SIMD_H_
+
+/* SSE2 is the baseline of every x64 target and of x86 builds with /arch:SSE2,
+ * so kernels are selected at compile time and need no runtime dispatch.
+ * SSSE3 (byte shuffle) is used when the compiler targets it (-mssse3, /arch:AVX
+ * or later). Other targets use the scalar code only.
+ */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ENCODING_USE_SSE2
+#include <emmintrin.h>
+#if defined(__SSSE3__) || defined(__AVX__)
+#define ENCODING_USE_SSSE3
+#include <tmmintrin.h>
+#endif
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace Encoding {
+	/** Index of the lowest set bit.
+	 *
+	 * x must not be 0.
+	*/
+	inline int ctz(unsigned int x)
+	{
+#ifdef _MSC_VER
+		unsigned long n;
+		_BitScanForward(&n, x);
+		return (int)n;
+#else
+		return __builtin_ctz(x);
+#endif
+	}
+
+	/** Index of the highest set bit.
+	 *
+	 * x must not be 0.
+	*/
+	inline int bsr(unsigned int x)
+	{
+#ifdef _MSC_VER
+		unsigned long n;
+		_BitScanReverse(&n, x);
+		return (int)n;
+#else
+		return 31 - __builtin_clz(x);
+#endif
+	}
+
+	/// Number of set bits
+	inline int popcount(unsigned int x)
+	{
+#ifdef __POPCNT__
+		return __builtin_popcount(x);
+#else
+		// POPCNT is not implied by SSE2, and the library call is slower than this.
+		x = x - ((x >> 1) & 0x55555555);
+		x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
+		x = (x + (x >> 4)) & 0x0f0f0f0f;
+		return (int)((x * 0x01010101) >> 24);
+#endif
+	}
+
+#ifdef ENCODING_USE_SSE2
+	/// Bit mask of the bytes in v which are in [lo, hi] (unsigned comparison)
+	inline unsigned int range_mask(__m128i v, unsigned char lo, unsigned char hi)
+	{
+		const __m128i x = _mm_sub_epi8(v, _mm_set1_epi8((char)lo));
+		return (unsigned int)_mm_movemask_epi8(
+			_mm_cmpeq_epi8(_mm_subs_epu8(x, _mm_set1_epi8((char)(hi - lo))), _mm_setzero_si128()));
+	}
+
+	/// Bit mask of the bytes in v which are equal to b
+	inline unsigned int byte_mask(__m128i v, unsigned char b)
+	{
+		return (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8((char)b)));
+	}
+#endif
+}
+
+#endif // INCLUDED_SIMD_H_
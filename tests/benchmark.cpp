@@ -0,0 +1,314 @@
+// benchmark.cpp
+/* Throughput of the decoders and the encoders.
+ *
+ * USAGE:
+ *   g++ -std=c++17 -O2 -pthread -o benchmark tests/benchmark.cpp *.cpp
+ *   ./benchmark
+ * Each line is the best of 5 runs in million codepoints per second (Mcp/s),
+ * or in GB/s of the encoded text for the "(bytes)" lines of the encoders.
+ * The texts are generated (about 1 million characters of mixed Japanese and
+ * ASCII), so the results of the builds and the revisions can be compared.
+ * For example, -DENCODING_USE_TABLE_DECODER selects the table-driven
+ * Shift_JIS/EUC-JP decoders, and -U__SSE2__ builds the scalar decoders of
+ * the machines without SSE2.
+ */
+#include "../encoding.h"
+#include "../jis2unicode.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+	const unsigned int TEXT_SIZE = 1 << 20;
+	const int RUNS = 5;
+
+	// a character of the generated text (plane 0: ASCII of col)
+	struct Cell {
+		int plane, row, col;
+	};
+
+	/* Mixed Japanese and ASCII text: 30% ASCII, 35% kana (rows 4 and 5),
+	 * 30% kanji of JIS X 0208 (rows 16-83) and 5% of the other cells (symbols,
+	 * rows 85-94 and plane 2) which are scattered over the table.
+	 */
+	std::vector<Cell> make_cells()
+	{
+		std::mt19937 random(2004);
+		std::vector<Cell> cells;
+		cells.reserve(TEXT_SIZE);
+		while (cells.size() < TEXT_SIZE) {
+			const unsigned int kind = random() % 100, r = random(), c = 1 + random() % 94;
+			if (kind < 30) cells.push_back({0, 0, (int)(0x20 + r % 0x5f)});
+			else if (kind < 65) cells.push_back({1, (int)(4 + r % 2), (int)(1 + r % 83)});
+			else if (kind < 95) cells.push_back({1, (int)(16 + r % 68), (int)c});
+			else if (kind < 98) cells.push_back({1, (int)(85 + r % 10), (int)c});
+			else cells.push_back({2, (int)(78 + r % 17), (int)c});
+		}
+		return cells;
+	}
+
+	// Shift_JIS code of a cell (JIS X 0213 Annex 1)
+	void put_shiftjis(std::vector<unsigned char> &text, const Cell &cell)
+	{
+		if (!cell.plane) {
+			text.push_back((unsigned char)cell.col);
+			return;
+		}
+		int b1;
+		bool first;
+		if (cell.plane == 1) {
+			b1 = cell.row <= 62 ? (cell.row + 0x101) / 2 : (cell.row + 0x181) / 2;
+			first = cell.row % 2 == 1;
+		} else {
+			// rows 78-94 of plane 2
+			b1 = cell.row == 78 ? 0xf4 : (cell.row + 0x19b) / 2;
+			first = cell.row != 78 && cell.row % 2 == 1;
+		}
+		text.push_back((unsigned char)b1);
+		text.push_back((unsigned char)(first ? cell.col + 0x3f + (cell.col >= 64) : cell.col + 0x9e));
+	}
+
+	void put_eucjp(std::vector<unsigned char> &text, const Cell &cell)
+	{
+		if (!cell.plane) {
+			text.push_back((unsigned char)cell.col);
+			return;
+		}
+		if (cell.plane == 2) text.push_back(0x8f);
+		text.push_back((unsigned char)(cell.row + 0xa0));
+		text.push_back((unsigned char)(cell.col + 0xa0));
+	}
+
+	/* CP932 code of a cell. The cells of rows 85-94 and plane 2 are replaced with
+	 * the vendor extensions (NEC special characters, NEC selected IBM extensions
+	 * and IBM extensions).
+	 */
+	void put_cp932(std::vector<unsigned char> &text, const Cell &cell)
+	{
+		if (cell.plane == 2 || (cell.plane == 1 && cell.row >= 85)) {
+			static const unsigned char leads[5] = {0x87, 0xed, 0xee, 0xfa, 0xfb};
+			text.push_back(leads[cell.row % 5]);
+			text.push_back((unsigned char)(cell.col + 0x3f + (cell.col >= 64)));
+			return;
+		}
+		put_shiftjis(text, cell);
+	}
+
+	std::vector<unsigned char> make_text(const std::vector<Cell> &cells, Encoding::EncodingType encoding)
+	{
+		std::vector<unsigned char> text;
+		for (const Cell &cell : cells) {
+			if (encoding == Encoding::EUCJP) put_eucjp(text, cell);
+			else if (encoding == Encoding::CP932) put_cp932(text, cell);
+			else put_shiftjis(text, cell);
+		}
+		return text;
+	}
+
+	std::vector<unsigned char> make_utf8(const std::vector<int> &codepoints)
+	{
+		std::vector<unsigned char> text;
+		for (const int codepoint : codepoints) {
+			if (codepoint < 0x80) text.push_back((unsigned char)codepoint);
+			else {
+				if (codepoint < 0x800) text.push_back((unsigned char)(0xc0 | codepoint >> 6));
+				else {
+					if (codepoint < 0x10000) text.push_back((unsigned char)(0xe0 | codepoint >> 12));
+					else {
+						text.push_back((unsigned char)(0xf0 | codepoint >> 18));
+						text.push_back((unsigned char)(0x80 | (codepoint >> 12 & 0x3f)));
+					}
+					text.push_back((unsigned char)(0x80 | (codepoint >> 6 & 0x3f)));
+				}
+				text.push_back((unsigned char)(0x80 | (codepoint & 0x3f)));
+			}
+		}
+		return text;
+	}
+
+	// best of the runs (seconds)
+	template <class Function>
+	double measure(Function function)
+	{
+		double best = 1e9;
+		for (int run = 0; run < RUNS; ++run) {
+			const auto start = std::chrono::steady_clock::now();
+			function();
+			best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+		}
+		return best;
+	}
+
+	// keeps the loops which evict the caches
+	volatile unsigned int sink = 0;
+
+	void report(const char *name, unsigned int count, double seconds)
+	{
+		std::printf("%-32s %8.1f Mcp/s\n", name, count / seconds / 1e6);
+	}
+
+	/* Decoding in blocks of 64 KB (warm) and 1 KB after the caches are evicted
+	 * by 4 MB of other data (cold), which shows the cost of the table misses.
+	 */
+	void bench_decode(const char *name, const std::vector<unsigned char> &text, Encoding::EncodingType encoding)
+	{
+		const unsigned int size = (unsigned int)text.size();
+		std::vector<int> dest(1 << 16);
+		unsigned int count = 0;
+		double seconds = measure([&] {
+			count = 0;
+			for (unsigned int i = 0; i < size; i += 1 << 16)
+				count += Encoding::decode(dest.data(), 1 << 16, text.data() + i, std::min(size - i, 1u << 16), encoding);
+		});
+		report(name, count, seconds);
+
+		std::vector<unsigned char> other(4 << 20);
+		const unsigned int blocks = 1000, block = 1024;
+		seconds = 0.0;
+		count = 0;
+		for (unsigned int k = 0; k < blocks; ++k) {
+			unsigned int sum = 0;
+			for (unsigned int i = 0; i < other.size(); i += 64) sum += other[i] += (unsigned char)k;
+			sink = sink + sum;
+			const auto start = std::chrono::steady_clock::now();
+			count += Encoding::decode(dest.data(), block, text.data() + k * block, block, encoding);
+			seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		}
+		std::printf("%-32s %8.1f Mcp/s (cold)\n", name, count / seconds / 1e6);
+	}
+
+	/* Reverse lookups (Unicode to JIS X 0213 index) of the characters of the
+	 * text, and a linear search of jisx0213_2_unicode for comparison (of 2000
+	 * characters, since it is slow).
+	 */
+	void bench_lookup(const std::vector<int> &codepoints)
+	{
+		const unsigned int size = (unsigned int)codepoints.size(), linear = 2000;
+		int sum = 0;
+		double seconds = measure([&] {
+			for (const int codepoint : codepoints) sum += Encoding::unicode_2_jisx0213(codepoint);
+		});
+		report("unicode_2_jisx0213", size, seconds);
+		const double lookups = size / seconds;
+		seconds = measure([&] {
+			for (unsigned int i = 0; i < linear; ++i) {
+				int index = 2 * 94 * 94 - 1;
+				while (index >= 0 && Encoding::jisx0213_codepoint(index) != codepoints[i]) --index;
+				sum += index;
+			}
+		});
+		// far below 0.1 Mcp/s, so in thousands and as the ratio to the table
+		std::printf("%-32s %8.1f K lookups/s (1/%.0f of the table)\n", "linear search", linear / seconds / 1e3, lookups / (linear / seconds));
+		sink = sink + sum;
+
+		const unsigned int bytes = sizeof(Encoding::unicode_2_jisx0213_bitmap) + sizeof(Encoding::unicode_2_jisx0213_rank) + sizeof(Encoding::unicode_2_jisx0213_value)
+			+ sizeof(Encoding::unicode_2_jisx0213_supplementary_key) + sizeof(Encoding::unicode_2_jisx0213_supplementary_index);
+		std::printf("%-32s %8.1f KB\n", "unicode_2_jisx0213 tables", bytes / 1024.0);
+	}
+
+	void bench_encode(const char *name, const std::vector<int> &codepoints, Encoding::EncodingType encoding)
+	{
+		const unsigned int size = (unsigned int)codepoints.size();
+		std::vector<unsigned char> dest(3 * size);
+		double seconds = measure([&] {
+			Encoding::encode(dest.data(), 3 * size, codepoints.data(), size, encoding);
+		});
+		report(name, size, seconds);
+	}
+
+	// encoding into UTF-8/UTF-16 (also in GB/s of the encoded text)
+	void bench_encode_utf(const char *name, const char *bytes_name, const std::vector<int> &codepoints, Encoding::EncodingType encoding)
+	{
+		const unsigned int size = (unsigned int)codepoints.size();
+		std::vector<unsigned char> dest(Encoding::encode(nullptr, 0, codepoints.data(), size, encoding));
+		unsigned int bytes = 0;
+		const double seconds = measure([&] {
+			bytes = Encoding::encode(dest.data(), (unsigned int)dest.size(), codepoints.data(), size, encoding);
+		});
+		report(name, size, seconds);
+		std::printf("%-32s %8.2f GB/s\n", bytes_name, bytes / seconds / 1e9);
+	}
+
+	/* Many short Shift_JIS texts (like the rows of a database) of min_size to
+	 * max_size bytes: decodeBatch() and decode() of each row
+	 */
+	void bench_batch(const char *batch_name, const char *decode_name, const std::vector<Cell> &cells, unsigned int min_size, unsigned int max_size)
+	{
+		// rows at character boundaries
+		std::mt19937 random(2004);
+		std::vector<unsigned char> text;
+		std::vector<unsigned int> begins(1, 0);
+		unsigned int size = min_size + random() % (max_size - min_size + 1);
+		for (const Cell &cell : cells) {
+			put_shiftjis(text, cell);
+			if (text.size() - begins.back() < size) continue;
+			begins.push_back((unsigned int)text.size());
+			size = min_size + random() % (max_size - min_size + 1);
+		}
+		const unsigned int count = (unsigned int)begins.size() - 1;
+		std::vector<int> buffer(text.size());
+		std::vector<int *> dest(count);
+		std::vector<const unsigned char *> src(count);
+		std::vector<unsigned int> dest_size(count), src_size(count), lengths(count);
+		for (unsigned int k = 0; k < count; ++k) {
+			dest[k] = buffer.data() + begins[k];
+			src[k] = text.data() + begins[k];
+			dest_size[k] = src_size[k] = begins[k + 1] - begins[k];
+		}
+
+		unsigned int total = 0;
+		double seconds = measure([&] {
+			total = Encoding::decodeBatch(dest.data(), dest_size.data(), src.data(), src_size.data(), count, Encoding::SHIFTJIS, lengths.data());
+		});
+		report(batch_name, total, seconds);
+		seconds = measure([&] {
+			total = 0;
+			for (unsigned int k = 0; k < count; ++k) total += Encoding::decode(dest[k], dest_size[k], src[k], src_size[k], Encoding::SHIFTJIS);
+		});
+		report(decode_name, total, seconds);
+	}
+
+	// encoding judgement (scoring the whole text)
+	void bench_judge(const char *name, const std::vector<unsigned char> &text, unsigned int count)
+	{
+		unsigned int sum = 0;
+		double seconds = measure([&] {
+			sum += Encoding::getEncoding(text.data(), (unsigned int)text.size());
+		});
+		report(name, count, seconds);
+		sink = sink + sum;
+	}
+}
+
+int main()
+{
+	const std::vector<Cell> cells = make_cells();
+	const std::vector<unsigned char> shiftjis = make_text(cells, Encoding::SHIFTJIS);
+	const std::vector<unsigned char> eucjp = make_text(cells, Encoding::EUCJP);
+	const std::vector<unsigned char> cp932 = make_text(cells, Encoding::CP932);
+
+	bench_decode("decode Shift_JIS", shiftjis, Encoding::SHIFTJIS);
+	bench_decode("decode CP932", cp932, Encoding::CP932);
+	bench_decode("decode EUC-JP", eucjp, Encoding::EUCJP);
+	bench_batch("decodeBatch 16-64 B rows", "decode 16-64 B rows", cells, 16, 64);
+	bench_batch("decodeBatch 64-256 B rows", "decode 64-256 B rows", cells, 64, 256);
+
+	const std::vector<int> codepoints = Encoding::decode(shiftjis.data(), (unsigned int)shiftjis.size(), Encoding::SHIFTJIS);
+	bench_lookup(codepoints);
+	bench_encode("encode Shift_JIS", codepoints, Encoding::SHIFTJIS);
+	bench_encode("encode EUC-JP", codepoints, Encoding::EUCJP);
+	std::vector<int> ascii;
+	for (const int codepoint : codepoints)
+		if (codepoint < 0x80) ascii.push_back(codepoint);
+	bench_encode_utf("encode UTF-8", "encode UTF-8 (bytes)", codepoints, Encoding::UTF8);
+	bench_encode_utf("encode UTF-8 ASCII", "encode UTF-8 ASCII (bytes)", ascii, Encoding::UTF8);
+	bench_encode_utf("encode UTF-16", "encode UTF-16 (bytes)", codepoints, Encoding::UTF16);
+	bench_encode_utf("encode UTF-16 ASCII", "encode UTF-16 ASCII (bytes)", ascii, Encoding::UTF16);
+
+	const std::vector<unsigned char> utf8 = make_utf8(codepoints);
+	bench_decode("decode UTF-8", utf8, Encoding::UTF8);
+	bench_judge("getEncoding UTF-8", utf8, (unsigned int)codepoints.size());
+	return 0;
+}
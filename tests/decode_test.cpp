@@ -0,0 +1,338 @@
+// decode_test.cpp
+/* Tests of the decoders.
+ *
+ * USAGE:
+ *   g++ -std=c++17 -pthread -o decode_test tests/decode_test.cpp *.cpp
+ *   ./decode_test
+ * The failed checks are printed, and the exit status is 1 if any.
+ */
+#include "../encoding.h"
+#include "../decode_literal.h"
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+namespace {
+	int failures = 0;
+
+	void check(bool ok, const char *name, int detail)
+	{
+		if (ok) return;
+		std::fprintf(stderr, "FAILED: %s (%x)\n", name, detail);
+		++failures;
+	}
+
+	std::vector<int> decode_bytes(std::vector<unsigned char> src, Encoding::EncodingType encoding)
+	{
+		return Encoding::decode(src.data(), (unsigned int)src.size(), encoding);
+	}
+
+	// plane 2 of Shift_JIS: the rows of the first bytes 0xf0-0xfc (second byte < 0x9f, >= 0x9f)
+	void test_shiftjis_plane2()
+	{
+		const int rows[13][2] = {
+			{1, 8}, {3, 4}, {5, 12}, {13, 14}, {15, 78}, {79, 80}, {81, 82},
+			{83, 84}, {85, 86}, {87, 88}, {89, 90}, {91, 92}, {93, 94}
+		};
+		for (int b1 = 0xf0; b1 <= 0xfc; ++b1) {
+			for (int b2 = 0x40; b2 <= 0xfc; ++b2) {
+				if (b2 == 0x7f) continue;
+				const int row = rows[b1 - 0xf0][b2 >= 0x9f];
+				const int col = b2 >= 0x9f ? b2 - 0x9e : b2 < 0x7f ? b2 - 0x3f : b2 - 0x40;
+				// the same character in EUC-JP (0x8f, row + 0xa0, col + 0xa0)
+				const std::vector<int> sjis = decode_bytes({(unsigned char)b1, (unsigned char)b2}, Encoding::SHIFTJIS);
+				const std::vector<int> euc = decode_bytes({0x8f, (unsigned char)(row + 0xa0), (unsigned char)(col + 0xa0)}, Encoding::EUCJP);
+				check(sjis == euc, "Shift_JIS plane 2 same as EUC-JP", b1 << 8 | b2);
+			}
+		}
+		check(decode_bytes({0xf0, 0x80}, Encoding::SHIFTJIS) == std::vector<int>{0x5046}, "Shift_JIS F080", 0xf080);
+		check(decode_bytes({0xf2, 0x9e}, Encoding::SHIFTJIS) == std::vector<int>{0x219c3}, "Shift_JIS F29E", 0xf29e);
+		check(decode_bytes({0xf4, 0x80}, Encoding::SHIFTJIS) == std::vector<int>{0x6aa1}, "Shift_JIS F480", 0xf480);
+	}
+
+	// decodeParallel() is the same as decode(), also with a short dest
+	void test_parallel()
+	{
+		// 2.5 MB of U+304B U+309A (two character sequence) and ASCII
+		std::vector<unsigned char> src;
+		for (int n = 0; src.size() < (5u << 19); ++n) {
+			src.push_back(0x82), src.push_back(0xf5);
+			if (n % 7 == 0) src.push_back('a');
+		}
+		const unsigned int size = (unsigned int)src.size();
+		const unsigned int count = Encoding::decode(nullptr, 0, src.data(), size, Encoding::SHIFTJIS);
+		check(Encoding::decodeParallel(nullptr, 0, src.data(), size, Encoding::SHIFTJIS, 4) == count, "decodeParallel count", count);
+
+		// the sequences are cut by the odd sizes
+		for (const unsigned int dest_size : {count, count - 1, count / 2 + 1, count / 3, 1u, 0u}) {
+			std::vector<int> expected(count + 1, -1), actual(count + 1, -1);
+			const unsigned int n = Encoding::decode(expected.data(), dest_size, src.data(), size, Encoding::SHIFTJIS);
+			const unsigned int m = Encoding::decodeParallel(actual.data(), dest_size, src.data(), size, Encoding::SHIFTJIS, 4);
+			check(m == n, "decodeParallel length", dest_size);
+			check(std::equal(expected.begin(), expected.begin() + n, actual.begin()), "decodeParallel text", dest_size);
+		}
+	}
+
+	// decodeToUtf8Bound() is reached by JIS X 0201 kana
+	void test_utf8_bound()
+	{
+		const unsigned char kana[] = {0xb1, 0xb2, 0xb3, 0xdf};
+		const unsigned char euc[] = {0x8e, 0xb1, 0x80, 0xff};
+		check(Encoding::decodeToUtf8(nullptr, 0, kana, 4, Encoding::SHIFTJIS) == Encoding::decodeToUtf8Bound(4, Encoding::SHIFTJIS), "utf8 bound shiftjis", 0);
+		check(Encoding::decodeToUtf8(nullptr, 0, euc, 4, Encoding::EUCJP) <= Encoding::decodeToUtf8Bound(4, Encoding::EUCJP), "utf8 bound eucjp", 0);
+		check(Encoding::decodeToUtf8Bound(4, Encoding::UTF8) == 0 && Encoding::decodeToUtf8Bound(4, Encoding::UTF16) == 0, "utf8 bound unsupported", 0);
+	}
+
+	// decodeLiteral() decodes every 2 bytes (and EUC-JP 3 bytes) text as decode()
+	void test_literal()
+	{
+		const Encoding::EncodingType encodings[] = {Encoding::SHIFTJIS, Encoding::CP932, Encoding::EUCJP};
+		for (const Encoding::EncodingType encoding : encodings) {
+			for (unsigned int code = 0; code < 0x20000; ++code) {
+				// 0x1XXXX: 0x8f XX XX (EUC-JP plane 2 and bad sequences)
+				if (code >= 0x10000 && encoding != Encoding::EUCJP) break;
+				const unsigned char bytes[4] = {0x8f, (unsigned char)(code >> 8), (unsigned char)code, 'a'};
+				const unsigned char *src = code >= 0x10000 ? bytes : bytes + 1;
+				const unsigned int size = code >= 0x10000 ? 4 : 3;
+				for (unsigned int src_size = 1; src_size <= size; ++src_size) {
+					int expected[8] = {};
+					char32_t actual[8] = {};
+					const unsigned int n = Encoding::decode(expected, 8, src, src_size, encoding);
+					const unsigned int m = Encoding::decodeLiteral(actual, 8, (const char *)src, src_size, encoding);
+					bool same = m == n && Encoding::decodeLiteral(nullptr, 0, (const char *)src, src_size, encoding) == n;
+					for (unsigned int i = 0; i < n; ++i) same = same && (int)actual[i] == expected[i];
+					check(same, "decodeLiteral", code);
+				}
+			}
+		}
+		// a two character sequence which doesn't fit
+		char32_t dest[2] = {};
+		check(Encoding::decodeLiteral(dest, 2, "a\x82\xf5", 3, Encoding::SHIFTJIS) == 1 && dest[1] == 0, "decodeLiteral sequence", 0);
+	}
+
+	/* Feeds src in the chunks which end at the offsets of cuts. Each chunk is a
+	 * copy, so the decoder can't read the bytes of the other chunks.
+	 */
+	std::vector<int> feed_chunks(Encoding::Decoder &decoder, const std::vector<unsigned char> &src, std::vector<unsigned int> cuts)
+	{
+		std::vector<int> dest;
+		unsigned int begin = 0;
+		cuts.push_back((unsigned int)src.size());
+		for (const unsigned int end : cuts) {
+			const std::vector<unsigned char> chunk(src.begin() + begin, src.begin() + end);
+			decoder.feed(dest, chunk.data(), (unsigned int)chunk.size());
+			begin = end;
+		}
+		decoder.finish(dest);
+		return dest;
+	}
+
+	/* Decoder gives the same result as decode() of the whole text, where the
+	 * text is split at every pair of offsets and fed 1 byte at a time. The samples
+	 * have BOM, multibyte sequences, two character sequences, bad sequences and
+	 * a NUL which ends the text (the bytes after it are ignored).
+	 */
+	void test_decoder()
+	{
+		const struct {
+			Encoding::EncodingType encoding;
+			std::vector<unsigned char> text;
+		} samples[] = {
+			{Encoding::SHIFTJIS, {'a', 0x82, 0xa0, 0x82, 0xf5, 0xb1, 0xf0, 0x80, 0x82, 0x20, 0xfc, 0xfc, 0x82}},
+			{Encoding::SHIFTJIS, {0x82, 0xf5, 0x00, 0x82, 0xa0, 'b'}},
+			{Encoding::CP932, {0x87, 0x40, 'a', 0xed, 0x40, 0xfa, 0x40, 0x81}},
+			{Encoding::EUCJP, {'a', 0xa4, 0xa2, 0x8e, 0xb1, 0x8f, 0xa1, 0xa1, 0xa4, 0xf7, 0x8f, 0x20, 0x8e}},
+			{Encoding::EUCJP, {0xa4, 0xf7, 0x8e, 0x00, 0xa4, 0xa2, 0x00, 'b'}},
+			{Encoding::UTF8, {0xef, 0xbb, 0xbf, 'a', 0xe3, 0x81, 0x82, 0xf0, 0xa0, 0x80, 0x89, 0xc0, 0x80, 0xe3, 0x81}},
+			{Encoding::UTF8, {0xe3, 0x81, 0x82, 0x00, 0xef, 0xbb, 0xbf}},
+			{Encoding::UTF8, {0xef, 0xbb}},
+			{Encoding::UTF16, {0xff, 0xfe, 'a', 0x00, 0x42, 0x30, 0x40, 0xd8, 0x89, 0xdc, 0x00, 0xdc, 0x42}},
+			{Encoding::UTF16, {0xfe, 0xff, 0x30, 0x42, 0xd8, 0x40, 0xdc, 0x89, 0x00, 0x00, 0x30, 0x44}},
+			{Encoding::UTF16, {'a', 0x00, 0x00, 0x30, 0x00, 0x00, 0x42, 0x30}},
+			{Encoding::UTF16, {0xff}}
+		};
+		int n = 0;
+		for (const auto &sample : samples) {
+			const std::vector<unsigned char> &text = sample.text;
+			const unsigned int size = (unsigned int)text.size();
+			const std::vector<int> expected = Encoding::decode(text.data(), size, sample.encoding);
+			// the decoder is reused after finish()
+			Encoding::Decoder decoder(sample.encoding);
+			for (unsigned int i = 0; i <= size; ++i)
+				for (unsigned int j = i; j <= size; ++j)
+					check(feed_chunks(decoder, text, {i, j}) == expected, "Decoder chunks", n << 16 | i << 8 | j);
+			std::vector<unsigned int> bytes;
+			for (unsigned int i = 1; i < size; ++i) bytes.push_back(i);
+			check(feed_chunks(decoder, text, bytes) == expected, "Decoder bytes", n);
+			++n;
+		}
+	}
+
+	/* decodeFile() and getEncodingOfFile() read the same text as decode() and
+	 * getEncoding() of the bytes, also for an empty file, and fail for a missing path.
+	 */
+	void test_file()
+	{
+		const char *path = "decode_test.tmp";
+		const std::vector<unsigned char> texts[] = {
+			{'a', 0x82, 0xa0, 0x82, 0xf5, 0xf0, 0x80, 0x82},
+			{0xa4, 0xa2, 0x8f, 0xa1, 0xa1, 'b', 0xa4, 0xa4, 0xa4, 0xa6},
+			{0xef, 0xbb, 0xbf, 0xe3, 0x81, 0x82, 0x00, 'c'},
+			{}
+		};
+		int n = 0;
+		for (const std::vector<unsigned char> &text : texts) {
+			FILE *fp = std::fopen(path, "wb");
+			if (!fp) {
+				check(false, "file create", n);
+				return;
+			}
+			if (!text.empty()) std::fwrite(text.data(), 1, text.size(), fp);
+			std::fclose(fp);
+
+			const unsigned char empty = 0;
+			const unsigned char *data = text.empty() ? &empty : text.data();
+			const Encoding::EncodingType encoding = Encoding::getEncoding(data, (unsigned int)text.size());
+			check(Encoding::getEncodingOfFile(path) == encoding, "getEncodingOfFile", n);
+			for (const Encoding::EncodingType type : {Encoding::NONE, Encoding::SHIFTJIS, Encoding::EUCJP, Encoding::UTF8}) {
+				std::vector<int> dest = {-1};
+				const std::vector<int> expected = text.empty() ? std::vector<int>() : Encoding::decode(data, (unsigned int)text.size(), type);
+				check(Encoding::decodeFile(dest, path, type) && dest == expected, "decodeFile", n << 8 | type);
+			}
+			++n;
+		}
+		std::remove(path);
+
+		std::vector<int> dest = {-1};
+		check(!Encoding::decodeFile(dest, path, Encoding::SHIFTJIS) && dest.empty(), "decodeFile missing", 0);
+		check(Encoding::getEncodingOfFile(path) == Encoding::NONE, "getEncodingOfFile missing", 0);
+	}
+
+	// UTF-16 of codepoints (surrogate pairs above U+FFFF)
+	std::vector<char16_t> utf16_of(const std::vector<int> &codepoints)
+	{
+		std::vector<char16_t> text;
+		for (const int codepoint : codepoints) {
+			if (codepoint < 0x10000) text.push_back((char16_t)codepoint);
+			else {
+				text.push_back((char16_t)(0xd800 + ((codepoint - 0x10000) >> 10)));
+				text.push_back((char16_t)(0xdc00 + (codepoint & 0x3ff)));
+			}
+		}
+		return text;
+	}
+
+	/* decodeToUtf16() is decode() with surrogate pairs, within decodeToUtf16Bound(),
+	 * and doesn't store a part of a character (or of a two character sequence).
+	 */
+	void test_utf16()
+	{
+		const struct {
+			Encoding::EncodingType encoding;
+			std::vector<unsigned char> text;
+		} samples[] = {
+			// plane 2 (U+20089), U+304B U+309A, kana, bad sequences
+			{Encoding::SHIFTJIS, {'a', 0xf0, 0x40, 0x82, 0xf5, 0xb1, 0x82, 0x20, 0xf0, 0x9f, 0x82}},
+			{Encoding::CP932, {0x87, 0x40, 'a', 0xed, 0x40, 0x82, 0xa0, 0xf0, 0x40}},
+			{Encoding::EUCJP, {0x8f, 0xa1, 0xa1, 0xa4, 0xf7, 0x8e, 0xb1, 'a', 0x8f, 0x20, 0xa4}},
+			{Encoding::UTF8, {0xef, 0xbb, 0xbf, 0xf0, 0xa0, 0x82, 0x89, 0xe3, 0x81, 0x8b, 0xe3, 0x82, 0x9a, 0xc0, 0x80}},
+			{Encoding::UTF16, {0xfe, 0xff, 0xd8, 0x40, 0xdc, 0x89, 0x30, 0x4b, 0xdc, 0x00, 0x00, 'a'}},
+			{Encoding::NONE, {0x82, 0xa0, 0xf0, 0x40, 0x82, 0xf5, 0x82, 0xa2}}
+		};
+		int n = 0;
+		for (const auto &sample : samples) {
+			const unsigned int size = (unsigned int)sample.text.size();
+			const Encoding::EncodingType encoding = sample.encoding == Encoding::NONE ? Encoding::getEncoding(sample.text.data(), size) : sample.encoding;
+			const std::vector<char16_t> expected = utf16_of(Encoding::decode(sample.text.data(), size, encoding));
+			const unsigned int count = (unsigned int)expected.size();
+			check(Encoding::decodeToUtf16(nullptr, 0, sample.text.data(), size, sample.encoding) == count, "decodeToUtf16 count", n);
+			check(count <= Encoding::decodeToUtf16Bound(size, encoding), "decodeToUtf16 bound", n);
+			for (unsigned int dest_size = 0; dest_size <= count; ++dest_size) {
+				std::vector<char16_t> dest(dest_size + 1, 0xeeee);
+				const unsigned int len = Encoding::decodeToUtf16(dest.data(), dest_size, sample.text.data(), size, sample.encoding);
+				bool ok = len <= dest_size && dest[dest_size] == 0xeeee && std::equal(dest.begin(), dest.begin() + len, expected.begin());
+				// a surrogate pair is not split
+				const bool high = len > 0 && expected[len - 1] >= 0xd800 && expected[len - 1] <= 0xdbff;
+				ok = ok && !(high && len < count && expected[len] >= 0xdc00 && expected[len] <= 0xdfff);
+				check(ok && (dest_size < count || len == count), "decodeToUtf16 size", n << 8 | dest_size);
+			}
+			++n;
+		}
+		// U+304B U+309A (0x82 0xf5) doesn't fit into 1 code unit
+		const unsigned char sequence[] = {0x82, 0xf5};
+		char16_t dest[2] = {};
+		check(Encoding::decodeToUtf16(dest, 1, sequence, 2, Encoding::SHIFTJIS) == 0, "decodeToUtf16 sequence", 0);
+		check(Encoding::decodeToUtf16(dest, 2, sequence, 2, Encoding::SHIFTJIS) == 2 && dest[0] == 0x304b && dest[1] == 0x309a, "decodeToUtf16 sequence", 1);
+	}
+
+	/* decodeBatch() is the same as decode() of each text: short texts of
+	 * characters, sequences, bad and truncated sequences and NUL, with short
+	 * dests and counting (dest[k] == nullptr), and the counts around the lanes
+	 */
+	void test_batch()
+	{
+		const std::vector<std::vector<unsigned char> > pieces = {
+			{'a'}, {0xb1}, {0x82, 0xa0}, {0x82, 0xf5}, {0xf0, 0x40}, {0xfc, 0xfc}, {0x87, 0x40},
+			{0xa4, 0xa2}, {0x8e, 0xb1}, {0x8f, 0xa1, 0xa1}, {0x81, 0x20}, {0x80}, {0x00}
+		};
+		unsigned int seed = 1;
+		auto random = [&seed](unsigned int n) {
+			seed = seed * 1103515245 + 12345;
+			return (seed >> 16) % n;
+		};
+		for (const Encoding::EncodingType encoding : {Encoding::SHIFTJIS, Encoding::CP932, Encoding::EUCJP, Encoding::NONE}) {
+			for (const unsigned int count : {0u, 1u, 3u, 4u, 5u, 37u, 200u}) {
+				std::vector<std::vector<unsigned char> > texts(count);
+				std::vector<std::vector<int> > buffers(count);
+				std::vector<int *> dest(count);
+				std::vector<const unsigned char *> src(count);
+				std::vector<unsigned int> dest_size(count), src_size(count), lengths(count, 0xdead);
+				for (unsigned int k = 0; k < count; ++k) {
+					// 0-80 bytes, sometimes a truncated lead at the end
+					const unsigned int size = random(81);
+					while (texts[k].size() < size) {
+						const std::vector<unsigned char> &piece = pieces[random((unsigned int)pieces.size() - (random(4) ? 1 : 0))];
+						texts[k].insert(texts[k].end(), piece.begin(), piece.end());
+					}
+					if (random(8) == 0) texts[k].push_back(0x82);
+					src[k] = texts[k].data();
+					src_size[k] = (unsigned int)texts[k].size();
+					const unsigned int bound = Encoding::decodeBound(src_size[k], Encoding::EUCJP);
+					buffers[k].assign(bound + 1, -1);
+					dest[k] = random(5) == 0 ? nullptr : buffers[k].data();
+					dest_size[k] = random(3) == 0 ? random(bound + 1) : bound;
+				}
+				const unsigned int total = Encoding::decodeBatch(dest.data(), dest_size.data(), src.data(), src_size.data(), count, encoding, lengths.data());
+				unsigned int sum = 0;
+				for (unsigned int k = 0; k < count; ++k) {
+					std::vector<int> expected(buffers[k].size(), -1);
+					const unsigned int n = dest[k] ? Encoding::decode(expected.data(), dest_size[k], src[k], src_size[k], encoding)
+						: Encoding::decode(nullptr, 0, src[k], src_size[k], encoding);
+					check(lengths[k] == n, "decodeBatch length", encoding << 16 | count << 8 | k);
+					if (dest[k]) check(std::equal(expected.begin(), expected.begin() + n, buffers[k].begin()), "decodeBatch text", encoding << 16 | count << 8 | k);
+					sum += n;
+				}
+				check(total == sum, "decodeBatch total", encoding << 16 | count);
+			}
+		}
+	}
+}
+
+int main()
+{
+	test_shiftjis_plane2();
+	test_parallel();
+	test_utf8_bound();
+	test_literal();
+	test_decoder();
+	test_file();
+	test_utf16();
+	test_batch();
+
+	if (failures) {
+		std::fprintf(stderr, "%d checks failed\n", failures);
+		return 1;
+	}
+	std::printf("ok\n");
+	return 0;
+}
@@ -0,0 +1,364 @@
+// encode_test.cpp
+/* Tests of the encoders.
+ *
+ * USAGE:
+ *   g++ -std=c++17 -pthread -o encode_test tests/encode_test.cpp *.cpp
+ *   ./encode_test
+ * The failed checks are printed, and the exit status is 1 if any.
+ */
+#include "../encoding.h"
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+	int failures = 0;
+
+	void check(bool ok, const char *name, int detail)
+	{
+		if (ok) return;
+		std::fprintf(stderr, "FAILED: %s (%x)\n", name, detail);
+		++failures;
+	}
+
+	std::vector<unsigned char> encode_text(const std::vector<int> &src, Encoding::EncodingType encoding)
+	{
+		const unsigned int size = Encoding::encode(nullptr, 0, src.data(), (unsigned int)src.size(), encoding);
+		std::vector<unsigned char> dest(size + 1, 0xee);
+		const unsigned int len = Encoding::encode(dest.data(), size, src.data(), (unsigned int)src.size(), encoding);
+		check(len == size && dest[size] == 0xee, "encode size", size);
+		dest.resize(len);
+		return dest;
+	}
+
+	std::vector<int> decode_text(const std::vector<unsigned char> &src, Encoding::EncodingType encoding)
+	{
+		return Encoding::decode(src.data(), (unsigned int)src.size(), encoding);
+	}
+
+	/* Shift_JIS and EUC-JP codes of a JIS X 0213 cell (plane [1:2], row [1:94], col [1:94]).
+	 * The Shift_JIS code is computed from the row as in JIS X 0213 Annex 1,
+	 * not by the tables of the library.
+	 */
+	std::vector<unsigned char> shiftjis_code(int plane, int row, int col)
+	{
+		// first bytes of the rows of plane 2 (0: the row is not in Shift_JIS)
+		static const unsigned char plane2[95] = {
+			0, 0xf0, 0, 0xf1, 0xf1, 0xf2, 0, 0, 0xf0, 0, 0, 0, 0xf2, 0xf3, 0xf3, 0xf4
+		};
+		int b1;
+		bool first;
+		if (plane == 1) {
+			b1 = row <= 62 ? (row + 0x101) / 2 : (row + 0x181) / 2;
+			first = row % 2 == 1;
+		} else if (row >= 78) {
+			b1 = row == 78 ? 0xf4 : (row + 0x19b) / 2;
+			first = row != 78 && row % 2 == 1;
+		} else {
+			b1 = plane2[row];
+			if (!b1) return {};
+			// the first row of the pair of the first byte
+			first = row == 1 || row == 3 || row == 5 || row == 13 || row == 15;
+		}
+		const int b2 = first ? col + 0x3f + (col >= 64) : col + 0x9e;
+		return {(unsigned char)b1, (unsigned char)b2};
+	}
+
+	std::vector<unsigned char> eucjp_code(int plane, int row, int col)
+	{
+		if (plane == 1) return {(unsigned char)(row + 0xa0), (unsigned char)(col + 0xa0)};
+		return {0x8f, (unsigned char)(row + 0xa0), (unsigned char)(col + 0xa0)};
+	}
+
+	/* Every character of JIS X 0213 is encoded into its own code (decode -> encode),
+	 * and the text decoded from it is the same (decode -> encode -> decode). The
+	 * characters which are decoded to ASCII (see DEVIATIONS of tools/jistable.cpp)
+	 * are encoded into 1 byte.
+	 */
+	void test_round_trip(Encoding::EncodingType encoding)
+	{
+		int mapped = 0;
+		for (int plane = 1; plane <= 2; ++plane) {
+			for (int row = 1; row <= 94; ++row) {
+				for (int col = 1; col <= 94; ++col) {
+					const std::vector<unsigned char> code = encoding == Encoding::SHIFTJIS ? shiftjis_code(plane, row, col) : eucjp_code(plane, row, col);
+					if (code.empty()) continue;
+					const std::vector<int> text = decode_text(code, encoding);
+					// unmapped cell
+					if (text.size() == 1 && text[0] == Encoding::UNICODE_BAD_SEQUENCE) continue;
+					++mapped;
+					const std::vector<unsigned char> encoded = encode_text(text, encoding);
+					const int cell = plane << 16 | row << 8 | col;
+					check(encoded == code || (encoded.size() == 1 && text[0] < 0x80), "round trip code", cell);
+					check(decode_text(encoded, encoding) == text, "round trip text", cell);
+				}
+			}
+		}
+		// 11233 characters of the mapping table (data/jisx0213-2004-8bit-std.txt)
+		check(mapped == 11233, "mapped characters", mapped);
+	}
+
+	/* The fullwidth forms are encoded into the cells of the mapping table,
+	 * though the cells are decoded to ASCII etc. (see DEVIATIONS of tools/jistable.cpp).
+	 */
+	void test_fullwidth(Encoding::EncodingType encoding)
+	{
+		std::vector<std::pair<int, int> > forms = {{0xffe5, 0xa5}, {0x2015, 0x2014}, {0xffe3, 0x203e}, {0x2985, 0xff5f}, {0x2986, 0xff60}};
+		for (int c = 0xff01; c <= 0xff5e; ++c) forms.push_back(std::make_pair(c, c - 0xff01 + 0x21));
+		for (const auto &form : forms) {
+			const std::vector<unsigned char> code = encode_text({form.first}, encoding);
+			check(code.size() == 2 && decode_text(code, encoding) == std::vector<int>{form.second}, "fullwidth", form.first);
+		}
+	}
+
+	// JIS X 0201 (ASCII & kana)
+	void test_jisx0201(Encoding::EncodingType encoding)
+	{
+		for (int b = 0x01; b <= 0xdf; ++b) {
+			if (0x80 <= b && b < 0xa1) continue;
+			std::vector<unsigned char> code = {(unsigned char)b};
+			if (encoding == Encoding::EUCJP && b >= 0x80) code.insert(code.begin(), 0x8e);
+			const std::vector<int> text = decode_text(code, encoding);
+			check(text.size() == 1 && encode_text(text, encoding) == code, "JIS X 0201", b);
+		}
+	}
+
+	// the characters which are not in Shift_JIS/EUC-JP, and the policies
+	void test_unmappable(Encoding::EncodingType encoding)
+	{
+		const std::vector<int> src = {'a', 0x1f600, 'b', 0xd800, -1, 0x110000, 0xfffd, 0x3042};
+		const std::vector<unsigned char> hiragana = encoding == Encoding::SHIFTJIS ? std::vector<unsigned char>{0x82, 0xa0} : std::vector<unsigned char>{0xa4, 0xa2};
+		std::vector<unsigned char> expected = {'a', '?', 'b', '?', '?', '?', '?'};
+		for (const unsigned char b : hiragana) expected.push_back(b);
+		check(encode_text(src, encoding) == expected, "substitute", encoding);
+
+		const unsigned int size = (unsigned int)src.size();
+		std::vector<unsigned char> dest(64);
+		unsigned int read = 0;
+		unsigned int len = Encoding::encodeJis<Encoding::ReferenceUnmappable>(dest.data(), (unsigned int)dest.size(), src.data(), size, encoding, &read);
+		std::string reference(dest.begin(), dest.begin() + len - hiragana.size());
+		check(reference == "a&#128512;b&#65533;&#65533;&#65533;&#65533;" && read == size, "reference", (int)len);
+
+		len = Encoding::encodeJis<Encoding::SkipUnmappable>(dest.data(), (unsigned int)dest.size(), src.data(), size, encoding, &read);
+		check(len == 2 + hiragana.size() && dest[0] == 'a' && dest[1] == 'b' && read == size, "skip", (int)len);
+
+		len = Encoding::encodeJis<Encoding::StopUnmappable>(nullptr, 0, src.data(), size, encoding, &read);
+		check(len == 1 && read == 1, "stop", (int)read);
+	}
+
+	// a character (or a two character sequence) which doesn't fit into dest is not stored
+	void test_truncation(Encoding::EncodingType encoding)
+	{
+		// U+304B U+309A is a character
+		const std::vector<int> src = {0x304b, 0x309a, 'a', 0x20089};
+		const std::vector<unsigned char> full = encode_text(src, encoding);
+		check(decode_text(full, encoding) == src, "sequence round trip", encoding);
+		// ends of the characters (U+20089 is 2 bytes in Shift_JIS, 3 bytes in EUC-JP)
+		const std::vector<unsigned int> ends = {0, 2, 3, (unsigned int)full.size()};
+		for (unsigned int dest_size = 0; dest_size < full.size(); ++dest_size) {
+			std::vector<unsigned char> dest(dest_size + 1, 0xee);
+			const unsigned int len = Encoding::encode(dest.data(), dest_size, src.data(), (unsigned int)src.size(), encoding);
+			unsigned int expected = 0;
+			for (const unsigned int end : ends)
+				if (end <= dest_size) expected = end;
+			check(len == expected && dest[dest_size] == 0xee, "truncation size", dest_size);
+			check(std::equal(dest.begin(), dest.begin() + len, full.begin()), "truncation text", dest_size);
+		}
+	}
+
+	// CP932 is supported only in decoding
+	void test_cp932()
+	{
+		const std::vector<int> src = {'a', 0x3042};
+		unsigned char dest[8] = {};
+		unsigned int read = 1;
+		check(Encoding::encode(nullptr, 0, src.data(), 2, Encoding::CP932) == 0, "cp932 size", 0);
+		check(Encoding::encode(dest, 8, src.data(), 2, Encoding::CP932) == 0 && dest[0] == 0, "cp932 encode", 0);
+		check(Encoding::encodeJis<Encoding::StopUnmappable>(dest, 8, src.data(), 2, Encoding::CP932, &read) == 0 && read == 0, "cp932 encodeJis", read);
+	}
+
+	/* Texts for the UTF encoders: runs of kana, ASCII, 2 bytes characters and a
+	 * supplementary character at every offset, so that the 8 and 16 codepoints
+	 * blocks begin and end at every kind of character, and random texts with
+	 * the bad codepoints (surrogates, negative values and above U+10FFFF)
+	 */
+	std::vector<std::vector<int> > utf_samples()
+	{
+		const std::vector<int> pool = {'a', 0x7f, 0x80, 0x3b1, 0x7ff, 0x800, 0x3042, 0x9fa0, 0xfffd, 0xffff, 0x10000, 0x20089, 0x10ffff};
+		const std::vector<int> bad = {0xd800, 0xdbff, 0xdc00, 0xdfff, -1, -0x7fffffff - 1, 0x110000, 0x7fffffff};
+		std::vector<std::vector<int> > samples;
+		for (int offset = 0; offset < 18; ++offset) {
+			std::vector<int> text(offset, 'x');
+			for (int k = 0; k < 8; ++k) text.push_back(0x3042 + k);
+			for (int k = 0; k < 16; ++k) text.push_back('A' + k);
+			for (int k = 0; k < 8; ++k) text.push_back(0x3b1 + k);
+			text.push_back(0x20089);
+			for (int k = 0; k < 20; ++k) text.push_back('a' + k);
+			samples.push_back(text);
+			// a bad codepoint in a block
+			text[offset + 3] = bad[offset % bad.size()];
+			samples.push_back(text);
+		}
+
+		unsigned int seed = 1;
+		auto random = [&seed](unsigned int n) {
+			seed = seed * 1103515245 + 12345;
+			return (seed >> 16) % n;
+		};
+		for (int n = 0; n < 200; ++n) {
+			std::vector<int> text;
+			const unsigned int size = random(70);
+			while (text.size() < size) {
+				const int codepoint = random(8) ? pool[random((unsigned int)pool.size())] : bad[random((unsigned int)bad.size())];
+				text.insert(text.end(), random(4) ? 1 : random(20), codepoint);
+			}
+			samples.push_back(text);
+		}
+		// U+0000 ends the text
+		samples.push_back({'a', 0x3042, 0, 'b'});
+		std::vector<int> ascii(40, 'a');
+		ascii[21] = 0;
+		samples.push_back(ascii);
+		return samples;
+	}
+
+	// the codepoints which are encoded (U+FFFD for the bad codepoints, until U+0000)
+	std::vector<int> scalar_values(const std::vector<int> &src)
+	{
+		std::vector<int> values;
+		for (const int codepoint : src) {
+			if (codepoint == 0) break;
+			const bool bad = codepoint < 0 || codepoint > 0x10ffff || (0xd800 <= codepoint && codepoint <= 0xdfff);
+			values.push_back(bad ? 0xfffd : codepoint);
+		}
+		return values;
+	}
+
+	// UTF-8 by the definition, and the ends of the characters
+	std::vector<unsigned char> utf8_reference(const std::vector<int> &src, std::vector<unsigned int> &ends)
+	{
+		std::vector<unsigned char> text;
+		ends.assign(1, 0);
+		for (const int codepoint : scalar_values(src)) {
+			if (codepoint < 0x80) {
+				text.push_back((unsigned char)codepoint);
+			} else if (codepoint < 0x800) {
+				text.push_back((unsigned char)(0xc0 | codepoint >> 6));
+				text.push_back((unsigned char)(0x80 | (codepoint & 0x3f)));
+			} else if (codepoint < 0x10000) {
+				text.push_back((unsigned char)(0xe0 | codepoint >> 12));
+				text.push_back((unsigned char)(0x80 | (codepoint >> 6 & 0x3f)));
+				text.push_back((unsigned char)(0x80 | (codepoint & 0x3f)));
+			} else {
+				text.push_back((unsigned char)(0xf0 | codepoint >> 18));
+				text.push_back((unsigned char)(0x80 | (codepoint >> 12 & 0x3f)));
+				text.push_back((unsigned char)(0x80 | (codepoint >> 6 & 0x3f)));
+				text.push_back((unsigned char)(0x80 | (codepoint & 0x3f)));
+			}
+			ends.push_back((unsigned int)text.size());
+		}
+		return text;
+	}
+
+	/* An encoder (dest, dest_size) against the expected text: the size with
+	 * dest == nullptr, and every dest_size stores the characters which fit
+	 * (no partial character) and nothing after dest_size.
+	 */
+	template <class Encoder>
+	void check_utf(Encoder encoder, const std::vector<unsigned char> &expected, const std::vector<unsigned int> &ends, const char *name, int detail)
+	{
+		check(encoder(nullptr, 0) == expected.size(), name, detail);
+		for (unsigned int dest_size = 0; dest_size <= expected.size(); ++dest_size) {
+			std::vector<unsigned char> dest(dest_size + 1, 0xee);
+			const unsigned int len = encoder(dest.data(), dest_size);
+			unsigned int fit = 0;
+			for (const unsigned int end : ends)
+				if (end <= dest_size) fit = end;
+			check(len == fit && dest[dest_size] == 0xee, name, detail << 16 | dest_size);
+			check(std::equal(dest.begin(), dest.begin() + len, expected.begin()), name, detail << 16 | dest_size);
+		}
+	}
+
+	// UTF-8 encoder against the definition, and the round trip
+	void test_utf8()
+	{
+		const std::vector<std::vector<int> > samples = utf_samples();
+		for (unsigned int n = 0; n < samples.size(); ++n) {
+			const std::vector<int> &src = samples[n];
+			std::vector<unsigned int> ends;
+			const std::vector<unsigned char> expected = utf8_reference(src, ends);
+			check_utf([&src](unsigned char *dest, unsigned int dest_size) {
+				return Encoding::encode(dest, dest_size, src.data(), (unsigned int)src.size(), Encoding::UTF8);
+			}, expected, ends, "UTF-8", n);
+			check(decode_text(expected, Encoding::UTF8) == scalar_values(src), "UTF-8 round trip", n);
+		}
+	}
+
+	// UTF-16 by the definition, and the ends of the characters (BOM is the first)
+	std::vector<unsigned char> utf16_reference(const std::vector<int> &src, bool big_endian, bool bom, std::vector<unsigned int> &ends)
+	{
+		std::vector<unsigned char> text;
+		auto put = [&](int unit) {
+			text.push_back((unsigned char)(big_endian ? unit >> 8 : unit & 0xff));
+			text.push_back((unsigned char)(big_endian ? unit & 0xff : unit >> 8));
+		};
+		if (bom) put(0xfeff);
+		ends.assign(1, (unsigned int)text.size());
+		for (const int codepoint : scalar_values(src)) {
+			if (codepoint < 0x10000) {
+				put(codepoint);
+			} else {
+				put(0xd800 | (codepoint - 0x10000) >> 10);
+				put(0xdc00 | (codepoint & 0x3ff));
+			}
+			ends.push_back((unsigned int)text.size());
+		}
+		return text;
+	}
+
+	// UTF-16 encoder against the definition in both byte orders, with and without BOM
+	void test_utf16()
+	{
+		const std::vector<std::vector<int> > samples = utf_samples();
+		for (unsigned int n = 0; n < samples.size(); ++n) {
+			const std::vector<int> &src = samples[n];
+			for (const bool big_endian : {false, true}) {
+				for (const bool bom : {false, true}) {
+					std::vector<unsigned int> ends;
+					const std::vector<unsigned char> expected = utf16_reference(src, big_endian, bom, ends);
+					check_utf([&](unsigned char *dest, unsigned int dest_size) {
+						return Encoding::encodeUtf16(dest, dest_size, src.data(), (unsigned int)src.size(), big_endian, bom);
+					}, expected, ends, big_endian ? "UTF-16BE" : "UTF-16LE", n << 1 | bom);
+					// the decoder reads the byte order from BOM
+					if (bom) check(decode_text(expected, Encoding::UTF16) == scalar_values(src), "UTF-16 round trip", n << 1 | big_endian);
+				}
+			}
+			// encode() is little endian with BOM
+			std::vector<unsigned int> ends;
+			check(encode_text(src, Encoding::UTF16) == utf16_reference(src, false, true, ends), "UTF-16 encode", n);
+		}
+	}
+}
+
+int main()
+{
+	for (const Encoding::EncodingType encoding : {Encoding::SHIFTJIS, Encoding::EUCJP}) {
+		test_round_trip(encoding);
+		test_fullwidth(encoding);
+		test_jisx0201(encoding);
+		test_unmappable(encoding);
+		test_truncation(encoding);
+	}
+	test_cp932();
+	test_utf8();
+	test_utf16();
+
+	if (failures) {
+		std::fprintf(stderr, "%d checks failed\n", failures);
+		return 1;
+	}
+	std::printf("ok\n");
+	return 0;
+}
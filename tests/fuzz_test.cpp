@@ -0,0 +1,493 @@
+// fuzz_test.cpp
+/* Differential tests of the decoders and the encoders on random texts.
+ *
+ * USAGE:
+ *   g++ -std=c++17 -pthread -o fuzz_test tests/fuzz_test.cpp *.cpp
+ *   ./fuzz_test [iterations]
+ * Every decoding function (decode, Decoder, decodeParallel, decodeBatch,
+ * decodeToUtf16, decodeToUtf8 and decodeLiteral) is compared with the
+ * reference decoders of this file, which decode a character at a time
+ * without SIMD nor the tables of the forms. encodeJis is compared with a
+ * reference encoder for each policy. Build it also with -U__SSE2__, -mssse3,
+ * -DENCODING_USE_TABLE_DECODER and -DENCODING_PARALLEL_CHUNK_SIZE=16 (which
+ * makes decodeParallel split the short texts) to compare the other decoders.
+ * The failed checks are printed, and the exit status is 1 if any.
+ */
+#include "../encoding.h"
+#include "../decode_literal.h"
+#include "../jis2unicode.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace {
+	int failures = 0;
+
+	void check(bool ok, const char *name, int detail)
+	{
+		if (ok) return;
+		std::fprintf(stderr, "FAILED: %s (%x)\n", name, detail);
+		++failures;
+	}
+
+	// random numbers (LCG, the same sequence on every platform)
+	unsigned int seed = 2004;
+	unsigned int next(unsigned int n)
+	{
+		seed = seed * 1103515245 + 12345;
+		return (seed >> 16) % n;
+	}
+
+	// decoded text in code units, and the ends of the characters (a two character sequence is a character)
+	template <class Unit>
+	struct Units {
+		std::vector<Unit> units;
+		std::vector<unsigned int> ends = std::vector<unsigned int>(1, 0);
+	};
+
+	// add a character (a negative value of jisx0213_codepoint() is a two character sequence)
+	void add(Units<int> &text, int codepoint)
+	{
+		if (codepoint < 0) {
+			const int *sequence = Encoding::jisx0213_sequence(codepoint);
+			text.units.push_back(sequence[0]);
+			text.units.push_back(sequence[1]);
+		}
+		else text.units.push_back(codepoint);
+		text.ends.push_back((unsigned int)text.units.size());
+	}
+
+	// Shift_JIS and CP932 by the profile of jis2unicode.h
+	template <class Profile>
+	Units<int> reference_shiftjis(const std::vector<unsigned char> &src)
+	{
+		Units<int> text;
+		for (unsigned int i = 0; i < src.size() && src[i]; ++i) {
+			// 1 byte sequence (ASCII & JIS X 0201)
+			if (Encoding::jisx0201_2_unicode[src[i]] != Encoding::UNICODE_BAD_SEQUENCE) {
+				add(text, Encoding::jisx0201_2_unicode[src[i]]);
+				continue;
+			}
+			// truncated sequence
+			if (i + 1 >= src.size()) break;
+			const int index = Profile::index(src[i], src[i + 1]);
+			// a bad sequence consumes 1 byte
+			if (index < 0) {
+				add(text, Encoding::UNICODE_BAD_SEQUENCE);
+				continue;
+			}
+			add(text, Profile::codepoint(index));
+			++i;
+		}
+		return text;
+	}
+
+	Units<int> reference_eucjp(const std::vector<unsigned char> &src)
+	{
+		auto jis = [](unsigned char b) { return 0xa1 <= b && b <= 0xfe; };
+		Units<int> text;
+		for (unsigned int i = 0; i < src.size() && src[i]; ++i) {
+			const unsigned char b1 = src[i];
+			if (b1 < 0x80) {
+				add(text, b1);
+				continue;
+			}
+			// truncated sequence
+			const unsigned int size = b1 == 0x8f ? 3 : 2;
+			if (i + size > src.size()) break;
+			const unsigned char b2 = src[i + 1], b3 = size == 3 ? src[i + 2] : 0;
+			// JIS X 0213 plane 2, JIS X 0201 kana and plane 1 (a bad sequence consumes 1 byte)
+			if (size == 3 && jis(b2) && jis(b3)) add(text, Encoding::jisx0213_codepoint((b2 - 0xa1 + 94) * 94 + (b3 - 0xa1)));
+			else if (b1 == 0x8e) add(text, Encoding::jisx0201_2_unicode[b2]);
+			else if (size == 2 && jis(b1) && jis(b2)) add(text, Encoding::jisx0213_codepoint((b1 - 0xa1) * 94 + (b2 - 0xa1)));
+			else {
+				add(text, Encoding::UNICODE_BAD_SEQUENCE);
+				continue;
+			}
+			i += size - 1;
+		}
+		return text;
+	}
+
+	// UTF-8 of RFC 3629 (a bad or truncated sequence consumes 1 byte)
+	Units<int> reference_utf8(const std::vector<unsigned char> &src)
+	{
+		Units<int> text;
+		unsigned int i = 0;
+		if (src.size() > 3 && src[0] == 0xef && src[1] == 0xbb && src[2] == 0xbf) i = 3;
+		for (; i < src.size() && src[i]; ++i) {
+			const unsigned char b1 = src[i];
+			if (b1 < 0x80) {
+				add(text, b1);
+				continue;
+			}
+			// length and the range of the second byte
+			unsigned int length = 0;
+			int low = 0x80, high = 0xbf;
+			if (0xc2 <= b1 && b1 <= 0xdf) length = 2;
+			else if (0xe0 <= b1 && b1 <= 0xef) length = 3, low = b1 == 0xe0 ? 0xa0 : 0x80, high = b1 == 0xed ? 0x9f : 0xbf;
+			else if (0xf0 <= b1 && b1 <= 0xf4) length = 4, low = b1 == 0xf0 ? 0x90 : 0x80, high = b1 == 0xf4 ? 0x8f : 0xbf;
+			bool valid = length > 0 && i + length <= src.size();
+			int codepoint = b1 & (0xff >> (length + 1));
+			for (unsigned int k = 1; valid && k < length; ++k) {
+				const unsigned char b = src[i + k];
+				valid = (k == 1 ? low : 0x80) <= b && b <= (k == 1 ? high : 0xbf);
+				codepoint = codepoint << 6 | (b & 0x3f);
+			}
+			if (!valid) {
+				add(text, Encoding::UNICODE_BAD_SEQUENCE);
+				continue;
+			}
+			add(text, codepoint);
+			i += length - 1;
+		}
+		return text;
+	}
+
+	// UTF-16 (little endian without BOM, a lone surrogate is kept unless a high one is followed by another unit)
+	Units<int> reference_utf16(const std::vector<unsigned char> &src)
+	{
+		Units<int> text;
+		if (src.size() < 2) return text;
+		unsigned int i = 0;
+		bool big_endian = false;
+		if (src[0] == 0xff && src[1] == 0xfe) i = 2;
+		else if (src[0] == 0xfe && src[1] == 0xff) i = 2, big_endian = true;
+		auto unit = [&](unsigned int k) { return big_endian ? src[k] << 8 | src[k + 1] : src[k + 1] << 8 | src[k]; };
+		for (; i + 1 < src.size(); i += 2) {
+			const int code = unit(i);
+			if (code == 0) break;
+			if ((code & 0xfc00) == 0xd800 && i + 3 < src.size()) {
+				const int next = unit(i + 2);
+				if ((next & 0xfc00) == 0xdc00) {
+					add(text, 0x10000 + ((code & 0x3ff) << 10 | (next & 0x3ff)));
+					i += 2;
+				}
+				else add(text, Encoding::UNICODE_BAD_SEQUENCE);
+			}
+			else add(text, code);
+		}
+		return text;
+	}
+
+	Units<int> reference(const std::vector<unsigned char> &src, Encoding::EncodingType encoding)
+	{
+		switch (encoding) {
+		case Encoding::SHIFTJIS: return reference_shiftjis<Encoding::ShiftjisProfile>(src);
+		case Encoding::CP932: return reference_shiftjis<Encoding::Cp932Profile>(src);
+		case Encoding::EUCJP: return reference_eucjp(src);
+		case Encoding::UTF8: return reference_utf8(src);
+		default: return reference_utf16(src);
+		}
+	}
+
+	// UTF-16 and UTF-8 of the characters of a decoded text
+	Units<char16_t> utf16_of(const Units<int> &text)
+	{
+		Units<char16_t> utf16;
+		for (unsigned int k = 0; k + 1 < text.ends.size(); ++k) {
+			for (unsigned int n = text.ends[k]; n < text.ends[k + 1]; ++n) {
+				const int codepoint = text.units[n];
+				if (codepoint < 0x10000) utf16.units.push_back((char16_t)codepoint);
+				else {
+					utf16.units.push_back((char16_t)(0xd800 | (codepoint - 0x10000) >> 10));
+					utf16.units.push_back((char16_t)(0xdc00 | (codepoint & 0x3ff)));
+				}
+			}
+			utf16.ends.push_back((unsigned int)utf16.units.size());
+		}
+		return utf16;
+	}
+
+	Units<unsigned char> utf8_of(const Units<int> &text)
+	{
+		Units<unsigned char> utf8;
+		for (unsigned int k = 0; k + 1 < text.ends.size(); ++k) {
+			for (unsigned int n = text.ends[k]; n < text.ends[k + 1]; ++n) {
+				const int codepoint = text.units[n];
+				if (codepoint < 0x80) utf8.units.push_back((unsigned char)codepoint);
+				else if (codepoint < 0x800) {
+					utf8.units.push_back((unsigned char)(0xc0 | codepoint >> 6));
+					utf8.units.push_back((unsigned char)(0x80 | (codepoint & 0x3f)));
+				} else if (codepoint < 0x10000) {
+					utf8.units.push_back((unsigned char)(0xe0 | codepoint >> 12));
+					utf8.units.push_back((unsigned char)(0x80 | (codepoint >> 6 & 0x3f)));
+					utf8.units.push_back((unsigned char)(0x80 | (codepoint & 0x3f)));
+				} else {
+					utf8.units.push_back((unsigned char)(0xf0 | codepoint >> 18));
+					utf8.units.push_back((unsigned char)(0x80 | (codepoint >> 12 & 0x3f)));
+					utf8.units.push_back((unsigned char)(0x80 | (codepoint >> 6 & 0x3f)));
+					utf8.units.push_back((unsigned char)(0x80 | (codepoint & 0x3f)));
+				}
+			}
+			utf8.ends.push_back((unsigned int)utf8.units.size());
+		}
+		return utf8;
+	}
+
+	/* A decoder (dest, dest_size) against the expected text: the size with
+	 * dest == nullptr, and the full dest and a random dest_size store the
+	 * characters which fit and nothing after dest_size.
+	 */
+	template <class Unit, class Decoder>
+	void check_decoder(Decoder decoder, const Units<Unit> &expected, const char *name, int detail)
+	{
+		const unsigned int size = (unsigned int)expected.units.size();
+		check(decoder(nullptr, 0) == size, name, detail);
+		for (const unsigned int dest_size : {size, next(size + 2)}) {
+			std::vector<Unit> dest(dest_size + 1, (Unit)-2);
+			const unsigned int len = decoder(dest.data(), dest_size);
+			unsigned int fit = 0;
+			for (const unsigned int end : expected.ends)
+				if (end <= dest_size) fit = end;
+			check(len == fit && dest[dest_size] == (Unit)-2, name, detail);
+			check(std::equal(dest.begin(), dest.begin() + std::min(len, fit), expected.units.begin()), name, detail);
+		}
+	}
+
+	// random text of an encoding: characters, bad bytes and NUL
+	std::vector<unsigned char> random_text(Encoding::EncodingType encoding, unsigned int size)
+	{
+		std::vector<unsigned char> text;
+		auto put = [&text](std::initializer_list<unsigned int> bytes) {
+			for (const unsigned int b : bytes) text.push_back((unsigned char)b);
+		};
+		// BOM (which may be truncated)
+		if (encoding == Encoding::UTF8 && next(4) == 0) put({0xef, 0xbb, 0xbf});
+		if (encoding == Encoding::UTF16 && next(4) == 0) put({next(2) ? 0xffu : 0xfeu, next(2) ? 0xfeu : 0xffu});
+		while (text.size() < size) {
+			const unsigned int kind = next(100);
+			if (kind < 30) put({0x20 + next(0x5f)});
+			else if (kind < 32) put({next(0x100)});
+			else if (kind < 33) put({0x00});
+			else if (encoding == Encoding::UTF8) {
+				const unsigned int form = next(6);
+				if (form == 0) put({0xc2 + next(30), 0x80 + next(64)});
+				else if (form < 4) put({0xe0 + next(16), 0x80 + next(64), 0x80 + next(64)});
+				else if (form == 4) put({0xf0 + next(5), 0x80 + next(64), 0x80 + next(64), 0x80 + next(64)});
+				else put({0x80 + next(0x80)});
+			} else if (encoding == Encoding::UTF16) {
+				const unsigned int form = next(5);
+				const unsigned int unit = form == 0 ? 0xd800 + next(0x800) : form == 1 ? next(0x80) : next(0x10000);
+				put({unit & 0xff, unit >> 8});
+			} else if (encoding == Encoding::EUCJP) {
+				const unsigned int form = next(8);
+				if (form == 0) put({0x8e, 0xa1 + next(63)});
+				else if (form == 1) put({0x8f, 0xa0 + next(96), 0xa0 + next(96)});
+				else if (form == 2) put({0xa4, 0xf7}); // U+304B U+309A
+				else put({0xa0 + next(96), 0xa0 + next(96)});
+			} else {
+				const unsigned int form = next(8);
+				if (form == 0) put({0xa1 + next(63)});
+				else if (form == 1) put({0x82, 0xf5}); // U+304B U+309A
+				else put({next(2) ? 0x81 + next(31) : 0xe0 + next(29), 0x40 + next(0xc0)});
+			}
+		}
+		text.resize(size);
+		return text;
+	}
+
+	// all decoding functions of a text against the reference
+	void test_decode(const std::vector<unsigned char> &text, Encoding::EncodingType encoding, int detail)
+	{
+		const unsigned char *src = text.empty() ? (const unsigned char *)"" : text.data();
+		const unsigned int src_size = (unsigned int)text.size();
+		const Units<int> expected = reference(text, encoding);
+
+		check_decoder([&](int *dest, unsigned int dest_size) {
+			return Encoding::decode(dest, dest_size, src, src_size, encoding);
+		}, expected, "decode", detail);
+		check(expected.units.size() <= Encoding::decodeBound(src_size, encoding), "decodeBound", detail);
+		check(Encoding::decode(src, src_size, encoding) == expected.units, "decode vector", detail);
+		check_decoder([&](int *dest, unsigned int dest_size) {
+			return Encoding::decodeParallel(dest, dest_size, src, src_size, encoding, 4);
+		}, expected, "decodeParallel", detail);
+
+		// streaming in random chunks (copies, so that the decoder can't read the previous chunk)
+		Encoding::Decoder decoder(encoding);
+		std::vector<int> streamed;
+		for (unsigned int i = 0; i < src_size; ) {
+			const unsigned int n = std::min(1 + next(9), src_size - i);
+			const std::vector<unsigned char> chunk(src + i, src + i + n);
+			decoder.feed(streamed, chunk.data(), n);
+			i += n;
+		}
+		decoder.finish(streamed);
+		check(streamed == expected.units, "Decoder", detail);
+
+		const Units<char16_t> utf16 = utf16_of(expected);
+		check_decoder([&](char16_t *dest, unsigned int dest_size) {
+			return Encoding::decodeToUtf16(dest, dest_size, src, src_size, encoding);
+		}, utf16, "decodeToUtf16", detail);
+		check(utf16.units.size() <= Encoding::decodeToUtf16Bound(src_size, encoding), "decodeToUtf16Bound", detail);
+		if (encoding == Encoding::UTF8 || encoding == Encoding::UTF16) return;
+
+		const Units<unsigned char> utf8 = utf8_of(expected);
+		check_decoder([&](unsigned char *dest, unsigned int dest_size) {
+			return Encoding::decodeToUtf8(dest, dest_size, src, src_size, encoding);
+		}, utf8, "decodeToUtf8", detail);
+		check(utf8.units.size() <= Encoding::decodeToUtf8Bound(src_size, encoding), "decodeToUtf8Bound", detail);
+
+		Units<char32_t> literal;
+		literal.units.assign(expected.units.begin(), expected.units.end());
+		literal.ends = expected.ends;
+		check_decoder([&](char32_t *dest, unsigned int dest_size) {
+			return Encoding::decodeLiteral(dest, dest_size, (const char *)src, src_size, encoding);
+		}, literal, "decodeLiteral", detail);
+	}
+
+	// decodeBatch of the texts against the reference
+	void test_batch(const std::vector<std::vector<unsigned char> > &texts, Encoding::EncodingType encoding)
+	{
+		const unsigned int count = (unsigned int)texts.size();
+		std::vector<Units<int> > expected;
+		std::vector<std::vector<int> > buffers(count);
+		std::vector<int *> dest(count);
+		std::vector<const unsigned char *> src(count);
+		std::vector<unsigned int> dest_size(count), src_size(count), lengths(count);
+		for (unsigned int k = 0; k < count; ++k) {
+			expected.push_back(reference(texts[k], encoding));
+			const unsigned int size = (unsigned int)expected[k].units.size();
+			dest_size[k] = next(4) ? size : next(size + 1);
+			buffers[k].assign(dest_size[k] + 1, -2);
+			dest[k] = next(8) ? buffers[k].data() : nullptr;
+			src[k] = texts[k].empty() ? (const unsigned char *)"" : texts[k].data();
+			src_size[k] = (unsigned int)texts[k].size();
+		}
+		const unsigned int total = Encoding::decodeBatch(dest.data(), dest_size.data(), src.data(), src_size.data(), count, encoding, lengths.data());
+		unsigned int sum = 0;
+		for (unsigned int k = 0; k < count; ++k) {
+			unsigned int fit = (unsigned int)expected[k].units.size();
+			if (dest[k]) {
+				fit = 0;
+				for (const unsigned int end : expected[k].ends)
+					if (end <= dest_size[k]) fit = end;
+				check(buffers[k][dest_size[k]] == -2 && std::equal(buffers[k].begin(), buffers[k].begin() + std::min(fit, lengths[k]), expected[k].units.begin()), "decodeBatch text", k);
+			}
+			check(lengths[k] == fit, "decodeBatch length", k);
+			sum += fit;
+		}
+		check(total == sum, "decodeBatch total", encoding);
+	}
+
+	/* Reference of encodeJis<Policy>
+	 * policy: 0 substitute, 1 reference, 2 skip, 3 stop
+	 */
+	std::string reference_jis(const std::vector<int> &src, bool euc, int policy, unsigned int &read)
+	{
+		std::string text;
+		unsigned int i;
+		for (i = 0; i < src.size() && src[i]; ++i) {
+			const int codepoint = src[i];
+			int code = euc ? Encoding::unicode_2_eucjp(codepoint) : Encoding::unicode_2_shiftjis(codepoint), second = 0;
+			if (i + 1 < src.size()) {
+				const int sequence = Encoding::unicode_2_jisx0213_sequence(codepoint, src[i + 1]);
+				if (sequence >= 0) code = euc ? Encoding::jisx0213_2_eucjp(sequence) : Encoding::jisx0213_2_shiftjis(sequence), second = 1;
+			}
+			if (code < 0) {
+				if (policy == 3) break;
+				if (policy == 0) text += '?';
+				if (policy == 1) {
+					const bool valid = 0 <= codepoint && codepoint <= 0x10ffff && (codepoint & 0xfffff800) != 0xd800;
+					text += "&#" + std::to_string(valid ? codepoint : 0xfffd) + ";";
+				}
+				continue;
+			}
+			if (code < 0x80) text += (char)code;
+			else if (!euc || code & 0x80) {
+				if (euc || code > 0xff) text += (char)(code >> 8);
+				text += (char)(code & 0xff);
+			} else {
+				text += (char)0x8f;
+				text += (char)(code >> 8);
+				text += (char)((code & 0xff) | 0x80);
+			}
+			i += second;
+		}
+		read = i;
+		return text;
+	}
+
+	// encodeJis<Policy> of the codepoints: the size and read, the text, and a random dest_size
+	template <class Policy>
+	void test_encode_policy(const std::vector<int> &src, Encoding::EncodingType encoding, int policy, int detail)
+	{
+		const unsigned int src_size = (unsigned int)src.size();
+		unsigned int expected_read, read = 0xdead;
+		const std::string expected = reference_jis(src, encoding == Encoding::EUCJP, policy, expected_read);
+		const unsigned int size = Encoding::encodeJis<Policy>(nullptr, 0, src.data(), src_size, encoding, &read);
+		check(size == expected.size() && read == expected_read, "encodeJis count", detail);
+
+		std::vector<unsigned char> dest(expected.size() + 1, 0xee);
+		unsigned int len = Encoding::encodeJis<Policy>(dest.data(), (unsigned int)expected.size(), src.data(), src_size, encoding, &read);
+		check(len == expected.size() && read == expected_read && dest.back() == 0xee && std::equal(expected.begin(), expected.end(), dest.begin(), [](char a, unsigned char b) { return (unsigned char)a == b; }), "encodeJis text", detail);
+		if (policy == 0) check(Encoding::encode(nullptr, 0, src.data(), src_size, encoding) == size, "encode count", detail);
+
+		// a short dest stops at a character, and read is where it stopped
+		const unsigned int dest_size = next((unsigned int)expected.size() + 2);
+		std::vector<unsigned char> truncated(dest_size + 1, 0xee);
+		len = Encoding::encodeJis<Policy>(truncated.data(), dest_size, src.data(), src_size, encoding, &read);
+		check(len <= dest_size && truncated[dest_size] == 0xee && read <= expected_read, "encodeJis truncation", detail);
+		check(std::equal(truncated.begin(), truncated.begin() + std::min(len, (unsigned int)expected.size()), expected.begin(), [](unsigned char a, char b) { return a == (unsigned char)b; }), "encodeJis truncation text", detail);
+		unsigned int prefix_read;
+		check(Encoding::encodeJis<Policy>(nullptr, 0, src.data(), read, encoding, &prefix_read) == len && prefix_read == read, "encodeJis truncation read", detail);
+	}
+
+	// random codepoints: ASCII, kana, kanji, sequences, plane 2, unmappable and bad codepoints
+	std::vector<int> random_codepoints(unsigned int size)
+	{
+		std::vector<int> codepoints;
+		const bool ascii = next(3) == 0;
+		while (codepoints.size() < size) {
+			const unsigned int kind = next(100);
+			int codepoint;
+			if (kind < (ascii ? 70u : 30u)) codepoint = (int)(0x20 + next(0x5f));
+			else if (kind < 80) codepoint = (int)(0x3000 + next(0x6000));
+			else if (kind < 84) codepoint = next(2) ? 0x309a : (int)(0x2e5 + next(0x1d));
+			else if (kind < 86) codepoint = (int)(0xff61 + next(0x3f));
+			else if (kind < 88) codepoint = (int)(0x20000 + next(0x3000));
+			else if (kind < 89) codepoint = next(4) ? -(int)next(5) - 1 : 0;
+			else if (kind < 91) codepoint = (int)(0xd800 + next(0x800));
+			else if (kind < 92) codepoint = (int)(0x110000 + next(5));
+			else codepoint = (int)next(0x10000);
+			codepoints.push_back(codepoint);
+		}
+		return codepoints;
+	}
+}
+
+int main(int argc, char **argv)
+{
+	const int iterations = argc > 1 ? std::atoi(argv[1]) : 10000;
+	const Encoding::EncodingType encodings[] = {Encoding::SHIFTJIS, Encoding::CP932, Encoding::EUCJP, Encoding::UTF8, Encoding::UTF16};
+
+	for (const Encoding::EncodingType encoding : encodings) {
+		std::vector<std::vector<unsigned char> > texts;
+		for (int n = 0; n < iterations; ++n) {
+			// mostly short texts, sometimes a few blocks of SIMD
+			const unsigned int size = next(4) ? next(40) : next(300);
+			texts.push_back(random_text(encoding, size));
+			test_decode(texts.back(), encoding, n);
+		}
+		test_batch(texts, encoding);
+	}
+
+	for (int n = 0; n < iterations; ++n) {
+		const std::vector<int> src = random_codepoints(next(3) ? next(60) : next(400));
+		for (const Encoding::EncodingType encoding : {Encoding::SHIFTJIS, Encoding::EUCJP}) {
+			test_encode_policy<Encoding::SubstituteUnmappable>(src, encoding, 0, n);
+			test_encode_policy<Encoding::ReferenceUnmappable>(src, encoding, 1, n);
+			test_encode_policy<Encoding::SkipUnmappable>(src, encoding, 2, n);
+			test_encode_policy<Encoding::StopUnmappable>(src, encoding, 3, n);
+		}
+	}
+
+	if (failures) {
+		std::fprintf(stderr, "%d checks failed\n", failures);
+		return 1;
+	}
+	std::printf("ok\n");
+	return 0;
+}
@@ -0,0 +1,123 @@
+// cp932table.cpp
+/* Generator of cp932_table.h from the CP932 mapping table of Microsoft.
+ *
+ * USAGE:
+ *   cp932table data/CP932.TXT cp932_table.h
+ *
+ * Each line of the mapping table is "<CP932 code> <Unicode> [# comment]".
+ *   CP932 code: 0x00-0xFF (1 byte) or 0x8140-0xFCFC (2 bytes)
+ *   Unicode   : 0xXXXX or empty (undefined)
+ * Lines beginning with '#' are ignored. The 1 byte characters are the same as
+ * JIS X 0201 (jisx0201_2_unicode of jis2unicode.h), so only the 2 bytes
+ * characters are written.
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+	const int KU_SIZE = 94;
+	// 60 first bytes (0x81-0x9F, 0xE0-0xFC) of 2 rows
+	const int ROW_SIZE = 120;
+	const int TABLE_SIZE = ROW_SIZE * KU_SIZE;
+	const int UNICODE_BAD_SEQUENCE = 0xfffd;
+
+	// index of a 2 bytes code (-1 for an invalid code), same as cp932_index() of jis2unicode.h
+	int code_index(long code)
+	{
+		const int b1 = (int)(code >> 8), b2 = (int)(code & 0xff);
+		int lead;
+		if (0x81 <= b1 && b1 <= 0x9f) lead = b1 - 0x81;
+		else if (0xe0 <= b1 && b1 <= 0xfc) lead = b1 - 0xe0 + 31;
+		else return -1;
+		if (b2 < 0x40 || 0xfc < b2 || b2 == 0x7f) return -1;
+		return lead * 2 * KU_SIZE + (b2 < 0x80 ? b2 - 0x40 : b2 - 0x41);
+	}
+
+	bool read_table(const char *path, std::vector<int> &table)
+	{
+		FILE *fp = std::fopen(path, "r");
+		if (!fp) return false;
+
+		char line[1024];
+		table.assign(TABLE_SIZE, UNICODE_BAD_SEQUENCE);
+		while (std::fgets(line, sizeof(line), fp)) {
+			const char *p = line;
+			char *end;
+			if (*p == '#') continue;
+			const long code = std::strtol(p, &end, 16);
+			if (end == p) continue;
+			p = end;
+			// 1 byte characters
+			if (code <= 0xff) continue;
+			const int index = code_index(code);
+			if (index < 0) continue;
+			while (*p == ' ' || *p == '\t') ++p;
+			// undefined
+			if (p[0] != '0' || (p[1] != 'x' && p[1] != 'X')) continue;
+			table[index] = (int)std::strtol(p, nullptr, 16);
+		}
+		std::fclose(fp);
+		return true;
+	}
+
+	void write_header(FILE *fp, const std::vector<int> &table)
+	{
+		std::fprintf(fp,
+			"// cp932_table.h\n"
+			"// This file is generated by tools/cp932table.cpp from data/CP932.TXT.\n"
+			"#ifndef INCLUDED_CP932_TABLE_H_\n"
+			"#define INCLUDED_CP932_TABLE_H_\n"
+			"\n"
+			"namespace Encoding {\n"
+			"\t// CP932 (Windows-31J) to Unicode (see jis2unicode.h)\n"
+			"\tinline constexpr unsigned short cp932_2_unicode[%d] = {\n", TABLE_SIZE);
+		for (int i = 0; i < TABLE_SIZE; ++i) {
+			if (i % (2 * KU_SIZE) == 0) {
+				const int lead = i / (2 * KU_SIZE);
+				std::fprintf(fp, "\t// first byte 0x%02X\n", lead < 31 ? 0x81 + lead : 0xe0 + lead - 31);
+			}
+			// 8 values in a line, a row begins at a new line
+			const int col = i % KU_SIZE;
+			if (col % 8 == 0) std::fputc('\t', fp);
+			std::fprintf(fp, "0x%04x", table[i]);
+			if (i + 1 < TABLE_SIZE) std::fputc(',', fp);
+			std::fputc(col % 8 == 7 || col == KU_SIZE - 1 ? '\n' : ' ', fp);
+		}
+		std::fprintf(fp,
+			"\t};\n"
+			"}\n"
+			"\n"
+			"#endif // INCLUDED_CP932_TABLE_H_\n");
+	}
+}
+
+int main(int argc, char **argv)
+{
+	if (argc != 3) {
+		std::fprintf(stderr, "usage: %s <mapping table> <output header>\n", argv[0]);
+		return 1;
+	}
+
+	std::vector<int> table;
+	if (!read_table(argv[1], table)) {
+		std::fprintf(stderr, "%s: can't read %s\n", argv[0], argv[1]);
+		return 1;
+	}
+	// the decoders expect codepoints in the BMP
+	for (int unicode : table) {
+		if (unicode > 0xffff) {
+			std::fprintf(stderr, "%s: character above U+FFFF\n", argv[0]);
+			return 1;
+		}
+	}
+
+	FILE *fp = std::fopen(argv[2], "w");
+	if (!fp) {
+		std::fprintf(stderr, "%s: can't write %s\n", argv[0], argv[2]);
+		return 1;
+	}
+	write_header(fp, table);
+	std::fclose(fp);
+	return 0;
+}
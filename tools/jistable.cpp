@@ -0,0 +1,338 @@
+// jistable.cpp
+/* Generator of jisx0213_table.h from the JIS X 0213 mapping table of x0213.org.
+ *
+ * USAGE:
+ *   jistable data/jisx0213-2004-8bit-std.txt jisx0213_table.h
+ *
+ * Each line of the mapping table is "<JIS X 0213 code> <Unicode> [# comment]".
+ *   JIS X 0213 code: 0x2121-0x7E7E (plane 1), 0xA1A1-0xFEFE (plane 2),
+ *                    or 3-2121/4-2121 (plane 1/2)
+ *   Unicode        : U+XXXX, U+XXXX+XXXX (sequence) or empty (unmapped)
+ * Lines beginning with '#' are ignored.
+ * The library decodes some codes differently from the mapping table (see
+ * DEVIATIONS), and the generator checks that the table has the expected
+ * codepoints before they are replaced.
+ */
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+	const int KU_SIZE = 94;
+	const int TABLE_SIZE = 2 * KU_SIZE * KU_SIZE;
+	const int UNICODE_BAD_SEQUENCE = 0xfffd;
+	// reverse table: index of JIS X 0201 byte b is JISX0201_INDEX + b
+	const int JISX0201_INDEX = TABLE_SIZE;
+	// reverse table: codepoints in a word of the bitmap of the BMP
+	const int WORD_BITS = 64;
+
+	/* Codes which the library decodes differently from the mapping table
+	 * {JIS X 0213 code, codepoint of the mapping table, codepoint of the library}
+	 * The fullwidth forms of ASCII symbols are decoded to ASCII, and a few
+	 * symbols to other forms, as the tables which were converted by hand. The
+	 * fullwidth digits and Latin letters of row 3 are decoded to ASCII too
+	 * (see apply_deviations()).
+	 */
+	const int DEVIATIONS[][3] = {
+		{0x2124, 0xff0c, 0x002c}, {0x2125, 0xff0e, 0x002e}, {0x2127, 0xff1a, 0x003a},
+		{0x2128, 0xff1b, 0x003b}, {0x2129, 0xff1f, 0x003f}, {0x212a, 0xff01, 0x0021},
+		{0x212e, 0xff40, 0x0060}, {0x2130, 0xff3e, 0x005e}, {0x2131, 0xffe3, 0x203e},
+		{0x2132, 0xff3f, 0x005f}, {0x213d, 0x2015, 0x2014}, {0x213f, 0xff0f, 0x002f},
+		{0x2140, 0xff3c, 0x005c}, {0x2143, 0xff5c, 0x007c}, {0x214a, 0xff08, 0x0028},
+		{0x214b, 0xff09, 0x0029}, {0x214e, 0xff3b, 0x005b}, {0x214f, 0xff3d, 0x005d},
+		{0x2150, 0xff5b, 0x007b}, {0x2151, 0xff5d, 0x007d}, {0x215c, 0xff0b, 0x002b},
+		{0x2161, 0xff1d, 0x003d}, {0x2163, 0xff1c, 0x003c}, {0x2164, 0xff1e, 0x003e},
+		{0x216f, 0xffe5, 0x00a5}, {0x2170, 0xff04, 0x0024}, {0x2173, 0xff05, 0x0025},
+		{0x2174, 0xff03, 0x0023}, {0x2175, 0xff06, 0x0026}, {0x2176, 0xff0a, 0x002a},
+		{0x2177, 0xff20, 0x0040}, {0x222f, 0xff07, 0x0027}, {0x2230, 0xff02, 0x0022},
+		{0x2231, 0xff0d, 0x002d}, {0x2232, 0xff5e, 0x007e}, {0x2256, 0x2985, 0xff5f},
+		{0x2257, 0x2986, 0xff60}
+	};
+
+	// one entry of the mapping table
+	struct Mapping {
+		int unicode;  // first codepoint (UNICODE_BAD_SEQUENCE if unmapped)
+		int combined; // second codepoint of a sequence (0 if not a sequence)
+	};
+
+	/* Parse a JIS X 0213 code and return its index (-1 for an unknown form).
+	 * p is moved to the end of the code.
+	 */
+	int parse_code(const char *&p)
+	{
+		char *end;
+		int plane = 1;
+		// 3-XXXX/4-XXXX
+		if ((p[0] == '3' || p[0] == '4') && p[1] == '-') {
+			plane = p[0] - '2';
+			p += 2;
+		}
+		const long code = std::strtol(p, &end, 16);
+		if (end == p) return -1;
+		p = end;
+		if (code & 0x8080) plane = 2;
+		const int row = (int)(code >> 8 & 0x7f) - 0x20, col = (int)(code & 0x7f) - 0x20;
+		if (row < 1 || KU_SIZE < row || col < 1 || KU_SIZE < col) return -1;
+		return (plane - 1) * KU_SIZE * KU_SIZE + (row - 1) * KU_SIZE + (col - 1);
+	}
+
+	// parse "U+XXXX" and return the codepoint (-1 if p is not "U+")
+	int parse_unicode(const char *&p)
+	{
+		char *end;
+		if (p[0] != 'U' || p[1] != '+') return -1;
+		const long codepoint = std::strtol(p + 2, &end, 16);
+		p = end;
+		return (int)codepoint;
+	}
+
+	bool read_table(const char *path, std::vector<Mapping> &table)
+	{
+		FILE *fp = std::fopen(path, "r");
+		if (!fp) return false;
+
+		char line[1024];
+		table.assign(TABLE_SIZE, Mapping{UNICODE_BAD_SEQUENCE, 0});
+		while (std::fgets(line, sizeof(line), fp)) {
+			const char *p = line;
+			if (*p == '#') continue;
+			const int index = parse_code(p);
+			if (index < 0) continue;
+			while (*p == ' ' || *p == '\t') ++p;
+			const int unicode = parse_unicode(p);
+			// unmapped
+			if (unicode < 0) continue;
+			table[index].unicode = unicode;
+			// sequence
+			if (*p == '+') table[index].combined = (int)std::strtol(p + 1, nullptr, 16);
+		}
+		std::fclose(fp);
+		return true;
+	}
+
+	/* Replace the codepoints of DEVIATIONS (false if the mapping table has
+	 * unexpected codepoints). The codepoints of the mapping table are kept in
+	 * alternates ({codepoint, index}), and the reverse table maps them too, so
+	 * that U+FF01 is encoded into 0x212A as well as U+0021 is into 0x21.
+	 */
+	bool apply_deviations(std::vector<Mapping> &table, std::vector<std::pair<int, int> > &alternates)
+	{
+		// {code, codepoint of the mapping table, codepoint of the library}
+		std::vector<std::vector<int> > deviations;
+		for (const auto &d : DEVIATIONS) deviations.push_back({d[0], d[1], d[2]});
+		// row 3: fullwidth digits and Latin letters
+		for (int b = 0x30; b <= 0x7a; ++b)
+			if (b <= 0x39 || (0x41 <= b && b <= 0x5a) || 0x61 <= b) deviations.push_back({0x2300 | b, 0xff00 + b - 0x20, b});
+
+		for (const auto &d : deviations) {
+			// plane 1 only
+			const int index = ((d[0] >> 8) - 0x21) * KU_SIZE + (d[0] & 0xff) - 0x21;
+			Mapping &m = table[index];
+			if (m.unicode != d[1] || m.combined) return false;
+			m.unicode = d[2];
+			alternates.push_back(std::make_pair(d[1], index));
+		}
+		return true;
+	}
+
+	// print values as a C++ initializer, 8 values in a line
+	void print_values(FILE *fp, const std::vector<int> &values, const char *format, int begin, int end)
+	{
+		for (int i = begin; i < end; ++i) {
+			if ((i - begin) % 8 == 0) std::fputc('\t', fp);
+			std::fprintf(fp, format, values[i]);
+			if (i + 1 < (int)values.size()) std::fputc(',', fp);
+			std::fputc((i - begin) % 8 == 7 || i + 1 == end ? '\n' : ' ', fp);
+		}
+	}
+
+	void write_header(FILE *fp, const std::vector<Mapping> &table, const std::vector<std::pair<int, int> > &alternates)
+	{
+		// forward table (16 bits, characters above U+FFFF and sequences are escaped)
+		std::vector<int> compact, supplementary, sequence;
+		for (const Mapping &m : table) {
+			if (m.combined) {
+				compact.push_back(0xdc00 + (int)sequence.size() / 2);
+				sequence.push_back(m.unicode);
+				sequence.push_back(m.combined);
+			}
+			else if (m.unicode > 0xffff) {
+				compact.push_back(0xd800 + (int)supplementary.size());
+				supplementary.push_back(m.unicode);
+			}
+			else compact.push_back(m.unicode);
+		}
+
+		// reverse table (the first index for the same codepoint)
+		// JIS X 0201 (same as jisx0201_2_unicode of jis2unicode.cpp) comes first
+		std::vector<int> reverse(0x10000, -1);
+		std::vector<std::pair<int, int> > reverse_supplementary;
+		for (int b = 0x00; b <= 0x7f; ++b) reverse[b] = JISX0201_INDEX + b;
+		for (int b = 0xa1; b <= 0xdf; ++b) reverse[0xff61 + b - 0xa1] = JISX0201_INDEX + b;
+		for (int i = 0; i < TABLE_SIZE; ++i) {
+			const Mapping &m = table[i];
+			if (m.combined || m.unicode == UNICODE_BAD_SEQUENCE) continue;
+			if (m.unicode > 0xffff) reverse_supplementary.push_back(std::make_pair(m.unicode, i));
+			else if (reverse[m.unicode] < 0) reverse[m.unicode] = i;
+		}
+		// codepoints of the mapping table which the library decodes differently
+		for (const auto &a : alternates) {
+			if (a.first > 0xffff) reverse_supplementary.push_back(a);
+			else if (reverse[a.first] < 0) reverse[a.first] = a.second;
+		}
+		std::stable_sort(reverse_supplementary.begin(), reverse_supplementary.end(),
+			[](const std::pair<int, int> &a, const std::pair<int, int> &b) { return a.first < b.first; });
+		reverse_supplementary.erase(std::unique(reverse_supplementary.begin(), reverse_supplementary.end(),
+			[](const std::pair<int, int> &a, const std::pair<int, int> &b) { return a.first == b.first; }), reverse_supplementary.end());
+		std::vector<int> keys, indices;
+		for (const auto &r : reverse_supplementary) keys.push_back(r.first), indices.push_back(r.second);
+
+		// bitmap of the mapped codepoints of the BMP, the number of the mapped
+		// codepoints before each word (rank) and the indices of the mapped codepoints
+		std::vector<unsigned long long> bitmap(0x10000 / WORD_BITS, 0);
+		std::vector<int> ranks, values;
+		for (int word = 0; word < 0x10000 / WORD_BITS; ++word) {
+			ranks.push_back((int)values.size());
+			for (int bit = 0; bit < WORD_BITS; ++bit) {
+				const int index = reverse[word * WORD_BITS + bit];
+				if (index < 0) continue;
+				bitmap[word] |= 1ull << bit;
+				values.push_back(index);
+			}
+		}
+
+		std::fprintf(fp,
+			"// jisx0213_table.h\n"
+			"// This file is generated by tools/jistable.cpp from data/jisx0213-2004-8bit-std.txt.\n"
+			"#ifndef INCLUDED_JISX0213_TABLE_H_\n"
+			"#define INCLUDED_JISX0213_TABLE_H_\n"
+			"\n"
+			"namespace Encoding {\n"
+			"\t/* This table is converted by \"JIS X 0213:2004 8-bit code vs Unicode mapping table\" from x0213.org.\n"
+			"\t * License:\n"
+			"\t * \tCopyright (C) 2001 earthian@tama.or.jp, All Rights Reserved.\n"
+			"\t * \tCopyright (C) 2001 I'O, All Rights Reserved.\n"
+			"\t * \tCopyright (C) 2009 Project X0213, All Rights Reserved.\n"
+			"\t * \tYou can use, modify, distribute this table freely.\n"
+			"\t */\n"
+			"\n"
+			"\t// JIS X 0213 to Unicode (see jis2unicode.h)\n"
+			"\tinline constexpr unsigned short jisx0213_2_unicode[%d] = {\n", TABLE_SIZE);
+		for (int plane = 1; plane <= 2; ++plane) {
+			for (int row = 1; row <= KU_SIZE; ++row) {
+				const int begin = ((plane - 1) * KU_SIZE + (row - 1)) * KU_SIZE;
+				std::fprintf(fp, "\t// plane %d row %d\n", plane, row);
+				print_values(fp, compact, "0x%04x", begin, begin + KU_SIZE);
+			}
+		}
+		std::fprintf(fp,
+			"\t};\n"
+			"\n"
+			"\t// JIS X 0213 to Unicode (U+10000 and above)\n"
+			"\tinline constexpr int jisx0213_2_unicode_supplementary[%d] = {\n", (int)supplementary.size());
+		print_values(fp, supplementary, "0x%06x", 0, (int)supplementary.size());
+		std::fprintf(fp,
+			"\t};\n"
+			"\n"
+			"\t// JIS X 0213 to Unicode (two character sequences)\n"
+			"\tinline constexpr int jisx0213_2_unicode_sequence[%d][2] = {\n", (int)sequence.size() / 2);
+		for (int i = 0; i < (int)sequence.size(); i += 2)
+			std::fprintf(fp, "\t\t{0x%04x, 0x%04x}%s\n", sequence[i], sequence[i + 1], i + 2 < (int)sequence.size() ? "," : "");
+		int first = TABLE_SIZE, last = -1;
+		for (int i = 0; i < TABLE_SIZE; ++i)
+			if (table[i].combined) first = std::min(first, i), last = i;
+		std::fprintf(fp,
+			"\t};\n"
+			"\t// range of the indices of the sequences\n"
+			"\tinline constexpr int JISX0213_SEQUENCE_FIRST = %d, JISX0213_SEQUENCE_LAST = %d;\n", first, last);
+		std::fprintf(fp,
+			"\n"
+			"\t// Unicode to JIS X 0213 & JIS X 0201 (see jis2unicode.h)\n"
+			"\tinline constexpr int JISX0201_INDEX = %d;\n"
+			"\tinline constexpr unsigned long long unicode_2_jisx0213_bitmap[%d] = {\n", JISX0201_INDEX, (int)bitmap.size());
+		for (int i = 0; i < (int)bitmap.size(); ++i) {
+			if (i % 4 == 0) std::fputc('\t', fp);
+			std::fprintf(fp, "0x%016llx", bitmap[i]);
+			if (i + 1 < (int)bitmap.size()) std::fputc(',', fp);
+			std::fputc(i % 4 == 3 ? '\n' : ' ', fp);
+		}
+		std::fprintf(fp,
+			"\t};\n"
+			"\tinline constexpr unsigned short unicode_2_jisx0213_rank[%d] = {\n", (int)ranks.size());
+		print_values(fp, ranks, "%5d", 0, (int)ranks.size());
+		std::fprintf(fp,
+			"\t};\n"
+			"\tinline constexpr short unicode_2_jisx0213_value[%d] = {\n", (int)values.size());
+		for (int word = 0; word < (int)bitmap.size(); ++word) {
+			const int begin = ranks[word], end = word + 1 < (int)ranks.size() ? ranks[word + 1] : (int)values.size();
+			if (begin == end) continue;
+			std::fprintf(fp, "\t// U+%04X-U+%04X\n", word * WORD_BITS, word * WORD_BITS + WORD_BITS - 1);
+			print_values(fp, values, "%5d", begin, end);
+		}
+		std::fprintf(fp,
+			"\t};\n"
+			"\n"
+			"\t// Unicode (U+10000 and above) to JIS X 0213 (sorted codepoints and their indices)\n"
+			"\tinline constexpr int UNICODE_2_JISX0213_SUPPLEMENTARY_SIZE = %d;\n"
+			"\tinline constexpr int unicode_2_jisx0213_supplementary_key[UNICODE_2_JISX0213_SUPPLEMENTARY_SIZE] = {\n", (int)keys.size());
+		print_values(fp, keys, "0x%06x", 0, (int)keys.size());
+		std::fprintf(fp,
+			"\t};\n"
+			"\tinline constexpr short unicode_2_jisx0213_supplementary_index[UNICODE_2_JISX0213_SUPPLEMENTARY_SIZE] = {\n");
+		print_values(fp, indices, "%5d", 0, (int)indices.size());
+		std::fprintf(fp,
+			"\t};\n"
+			"}\n"
+			"\n"
+			"#endif // INCLUDED_JISX0213_TABLE_H_\n");
+	}
+}
+
+int main(int argc, char **argv)
+{
+	if (argc != 3) {
+		std::fprintf(stderr, "usage: %s <mapping table> <output header>\n", argv[0]);
+		return 1;
+	}
+
+	std::vector<Mapping> table;
+	std::vector<std::pair<int, int> > alternates;
+	if (!read_table(argv[1], table)) {
+		std::fprintf(stderr, "%s: can't read %s\n", argv[0], argv[1]);
+		return 1;
+	}
+	if (!apply_deviations(table, alternates)) {
+		std::fprintf(stderr, "%s: unexpected codepoint in %s\n", argv[0], argv[1]);
+		return 1;
+	}
+	// each escape has 0x400 values
+	int supplementary = 0, sequence = 0;
+	for (const Mapping &m : table) {
+		if (m.combined) ++sequence;
+		else if (m.unicode > 0xffff) ++supplementary;
+	}
+	if (supplementary > 0x400 || sequence > 0x400) {
+		std::fprintf(stderr, "%s: too many characters to escape\n", argv[0]);
+		return 1;
+	}
+	// the decoders expect sequences in plane 1 only
+	for (int i = KU_SIZE * KU_SIZE; i < TABLE_SIZE; ++i) {
+		if (table[i].combined) {
+			std::fprintf(stderr, "%s: sequence in plane 2\n", argv[0]);
+			return 1;
+		}
+	}
+
+	FILE *fp = std::fopen(argv[2], "w");
+	if (!fp) {
+		std::fprintf(stderr, "%s: can't write %s\n", argv[0], argv[2]);
+		return 1;
+	}
+	write_header(fp, table, alternates);
+	std::fclose(fp);
+	return 0;
+}
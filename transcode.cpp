@@ -0,0 +1,388 @@
+// transcode.cpp
+#include "encoding.h"
+#include "jis2unicode.h"
+#include "simd.h"
+#include "utf8.h"
+#include <cstring>
+
+namespace {
+	// length of the run of ASCII characters (without NUL) at the beginning of src
+	unsigned int ascii_length(const unsigned char *src, unsigned int src_size)
+	{
+		unsigned int i = 0;
+#ifdef ENCODING_USE_SSE2
+		for (; src_size - i >= 16; i += 16) {
+			const __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+			const unsigned int other = ~Encoding::range_mask(v, 0x01, 0x7f) & 0xffff;
+			if (other) return i + Encoding::ctz(other);
+		}
+#endif
+		while (i < src_size && (unsigned char)(src[i] - 1) < 0x7f) ++i;
+		return i;
+	}
+
+	/* Output of the transcoders. Each type of code unit has the overloads below.
+	 *   code_length(dest, codepoint): number of code units of codepoint
+	 *   put_code(dest, codepoint): store code_length() code units
+	 *   copy_ascii(dest, dest_size, src, src_size): store (or count if dest is
+	 *     nullptr) a run of ASCII characters, returns the number of characters
+	 */
+
+	// length of the UTF-8 sequence of a codepoint
+	inline unsigned int code_length(const unsigned char *, int codepoint)
+	{
+		return codepoint < 0x80 ? 1 : codepoint < 0x800 ? 2 : codepoint < 0x10000 ? 3 : 4;
+	}
+
+	// store the UTF-8 sequence of a codepoint
+	inline void put_code(unsigned char *dest, int codepoint)
+	{
+		if (codepoint < 0x80) {
+			dest[0] = (unsigned char)codepoint;
+		} else if (codepoint < 0x800) {
+			dest[0] = (unsigned char)(0xc0 | codepoint >> 6);
+			dest[1] = (unsigned char)(0x80 | (codepoint & 0x3f));
+		} else if (codepoint < 0x10000) {
+			dest[0] = (unsigned char)(0xe0 | codepoint >> 12);
+			dest[1] = (unsigned char)(0x80 | (codepoint >> 6 & 0x3f));
+			dest[2] = (unsigned char)(0x80 | (codepoint & 0x3f));
+		} else {
+			dest[0] = (unsigned char)(0xf0 | codepoint >> 18);
+			dest[1] = (unsigned char)(0x80 | (codepoint >> 12 & 0x3f));
+			dest[2] = (unsigned char)(0x80 | (codepoint >> 6 & 0x3f));
+			dest[3] = (unsigned char)(0x80 | (codepoint & 0x3f));
+		}
+	}
+
+	// copy a run of ASCII characters, which are the same in UTF-8
+	inline unsigned int copy_ascii(unsigned char *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size)
+	{
+		unsigned int n = ascii_length(src, src_size);
+		if (dest) {
+			if (n > dest_size) n = dest_size;
+			std::memcpy(dest, src, n);
+		}
+		return n;
+	}
+
+	// length of the UTF-16 sequence of a codepoint (U+FFFD for above U+10FFFF)
+	inline unsigned int code_length(const char16_t *, int codepoint)
+	{
+		return 0x10000 <= codepoint && codepoint <= 0x10ffff ? 2 : 1;
+	}
+
+	// store the UTF-16 sequence of a codepoint
+	inline void put_code(char16_t *dest, int codepoint)
+	{
+		if (codepoint < 0x10000) {
+			dest[0] = (char16_t)codepoint;
+		} else if (codepoint <= 0x10ffff) {
+			// surrogate pair
+			codepoint -= 0x10000;
+			dest[0] = (char16_t)(0xd800 | codepoint >> 10);
+			dest[1] = (char16_t)(0xdc00 | (codepoint & 0x3ff));
+		} else {
+			dest[0] = (char16_t)Encoding::UNICODE_BAD_SEQUENCE;
+		}
+	}
+
+	// widen a run of ASCII characters
+	inline unsigned int copy_ascii(char16_t *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size)
+	{
+		unsigned int n = ascii_length(src, src_size);
+		if (dest) {
+			if (n > dest_size) n = dest_size;
+			unsigned int i = 0;
+#ifdef ENCODING_USE_SSE2
+			for (; n - i >= 16; i += 16) {
+				const __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+				_mm_storeu_si128((__m128i *)(dest + i), _mm_unpacklo_epi8(v, _mm_setzero_si128()));
+				_mm_storeu_si128((__m128i *)(dest + i + 8), _mm_unpackhi_epi8(v, _mm_setzero_si128()));
+			}
+#endif
+			for (; i < n; ++i) dest[i] = (char16_t)src[i];
+		}
+		return n;
+	}
+
+	// UTF-16 LE/BE to UTF-16 transcoder
+	unsigned int transcode_utf16(char16_t *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size)
+	{
+		int high = 1, low = 0; // for endian
+		int code1, code2;
+		unsigned int len = 0;
+
+		if (src_size < 2) return 0;
+
+		// recognize BOM
+		if (src[0] == 0xff && src[1] == 0xfe) {
+			// little endian
+			src += 2, src_size -= 2;
+		} else if (src[0] == 0xfe && src[1] == 0xff) {
+			// big endian
+			src += 2, src_size -= 2;
+			high = 0, low = 1;
+		}
+
+		for (unsigned int i = 0; i + 1 < src_size; i += 2) {
+#ifdef ENCODING_USE_SSE2
+			// 8 code units blocks without surrogates and NUL are copied
+			while (src_size - i >= 16 && (!dest || dest_size - len >= 8)) {
+				__m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+				if (high == 0) v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+				const __m128i surrogate = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16((short)0xf800)), _mm_set1_epi16((short)0xd800));
+				const __m128i nul = _mm_cmpeq_epi16(v, _mm_setzero_si128());
+				if (_mm_movemask_epi8(_mm_or_si128(surrogate, nul))) break;
+				if (dest) _mm_storeu_si128((__m128i *)(dest + len), v);
+				i += 16, len += 8;
+			}
+			if (i + 1 >= src_size || (dest && len >= dest_size)) break;
+#endif
+			code1 = ((int)src[i + high] << 8) | (int)src[i + low];
+			// end of text
+			if (code1 == 0x0000) break;
+			// surrogate pair
+			if ((code1 & 0xfc00) == 0xd800 && i + 3 < src_size) {
+				code2 = ((int)src[i + 2 + high] << 8) | (int)src[i + 2 + low];
+				if ((code2 & 0xfc00) == 0xdc00) {
+					if (dest) {
+						if (dest_size - len < 2) break;
+						dest[len] = (char16_t)code1, dest[len + 1] = (char16_t)code2;
+					}
+					i += 2, len += 2;
+					continue;
+				}
+				code1 = Encoding::UNICODE_BAD_SEQUENCE;
+			}
+			if (dest) {
+				if (len >= dest_size) break;
+				dest[len] = (char16_t)code1;
+			}
+			++len;
+		}
+		return len;
+	}
+
+	// UTF-8 to UTF-16 transcoder
+	unsigned int transcode_utf8(char16_t *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size)
+	{
+		unsigned char b1;
+		int codepoint;
+		unsigned int len = 0, units;
+
+		// recognize BOM
+		if (src_size > 3)
+			if (src[0] == 0xef && src[1] == 0xbb && src[2] == 0xbf)
+				src += 3, src_size -= 3;
+
+		for (unsigned int i = 0; i < src_size; ++i) {
+			// run of ASCII characters
+			if ((unsigned char)(src[i] - 1) < 0x7f) {
+				const unsigned int n = copy_ascii(dest ? dest + len : nullptr, dest_size - len, src + i, src_size - i);
+				i += n, len += n;
+				if (i >= src_size || (dest && len >= dest_size)) break;
+			}
+			b1 = src[i];
+			// end of text
+			if (b1 == 0x00) break;
+			// 1 byte sequence (ASCII compatible)
+			if (b1 <= 0x7f) codepoint = (int)b1;
+			// 2~4 bytes sequence (truncated sequence is also an error, they consume 1 byte)
+			else {
+				const int bytes = Encoding::utf8_sequence(src + i, src_size - i, codepoint);
+				if (bytes > 0) i += bytes - 1;
+				else codepoint = Encoding::UNICODE_BAD_SEQUENCE;
+			}
+			units = code_length(dest, codepoint);
+			if (dest) {
+				if (dest_size - len < units) break;
+				put_code(dest + len, codepoint);
+			}
+			len += units;
+		}
+		return len;
+	}
+
+	// Shift_JIS transcoder (Profile is a mapping profile of jis2unicode.h)
+	template <class Unit, class Profile>
+	unsigned int transcode_shiftjis(Unit *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size)
+	{
+		unsigned char b1, b2;
+		int codepoint, index;
+		unsigned int len = 0, units;
+
+		for (unsigned int i = 0; i < src_size; ++i) {
+			// run of ASCII characters
+			if ((unsigned char)(src[i] - 1) < 0x7f) {
+				const unsigned int n = copy_ascii(dest ? dest + len : nullptr, dest_size - len, src + i, src_size - i);
+				i += n, len += n;
+				if (i >= src_size || (dest && len >= dest_size)) break;
+			}
+			b1 = src[i];
+			// end of text
+			if (b1 == 0x00) break;
+			// 1 byte sequence (ASCII & JIS X 0201)
+			if (Encoding::jisx0201_2_unicode[b1] != Encoding::UNICODE_BAD_SEQUENCE)
+				codepoint = Encoding::jisx0201_2_unicode[b1];
+			// 2 bytes sequence (JIS X 0208)
+			else {
+				if (i + 1 >= src_size) break;
+				b2 = src[++i];
+				index = Profile::index(b1, b2);
+				// correct sequence
+				if (index >= 0) codepoint = Profile::codepoint(index);
+				// bad sequence
+				else {
+					codepoint = Encoding::UNICODE_BAD_SEQUENCE;
+					--i;
+				}
+			}
+			// two character sequence
+			if (codepoint < 0) {
+				const int *sequence = Encoding::jisx0213_sequence(codepoint);
+				units = code_length(dest, sequence[0]) + code_length(dest, sequence[1]);
+				if (dest) {
+					if (dest_size - len < units) break;
+					put_code(dest + len, sequence[0]);
+					put_code(dest + len + code_length(dest, sequence[0]), sequence[1]);
+				}
+				len += units;
+				continue;
+			}
+			units = code_length(dest, codepoint);
+			if (dest) {
+				if (dest_size - len < units) break;
+				put_code(dest + len, codepoint);
+			}
+			len += units;
+		}
+		return len;
+	}
+
+	// EUC-JP transcoder
+	template <class Unit>
+	unsigned int transcode_eucjp(Unit *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size)
+	{
+		unsigned char b1, b2, b3;
+		int codepoint;
+		unsigned int len = 0, units;
+
+		for (unsigned int i = 0; i < src_size; ++i) {
+			// run of ASCII characters
+			if ((unsigned char)(src[i] - 1) < 0x7f) {
+				const unsigned int n = copy_ascii(dest ? dest + len : nullptr, dest_size - len, src + i, src_size - i);
+				i += n, len += n;
+				if (i >= src_size || (dest && len >= dest_size)) break;
+			}
+			b1 = src[i];
+			// end of text
+			if (b1 == 0x00) break;
+			// 1 byte sequence
+			if (b1 <= 0x7f) codepoint = (int)b1;
+			// 3 bytes sequence (JIS X 0213 plane 2)
+			else if (b1 == 0x8f) {
+				if (i + 2 >= src_size) break;
+				i += 2;
+				b2 = src[i - 1], b3 = src[i];
+				if (0xa1 <= b2 && b2 <= 0xfe && 0xa1 <= b3 && b3 <= 0xfe)
+					codepoint = Encoding::jisx0213_codepoint((b2 - 0xa1 + 94) * 94 + (b3 - 0xa1));
+				// bad sequence
+				else {
+					codepoint = Encoding::UNICODE_BAD_SEQUENCE;
+					i -= 2;
+				}
+			}
+			// 2 bytes sequence
+			else /* b1 >= 0x80 */ {
+				if (i + 1 >= src_size) break;
+				b2 = src[++i];
+				// JIS X 0201 kana
+				if (b1 == 0x8e) codepoint = Encoding::jisx0201_2_unicode[b2];
+				// JIS X 0213 plane 1
+				else if (0xa1 <= b1 && b1 <= 0xfe && 0xa1 <= b2 && b2 <= 0xfe)
+					codepoint = Encoding::jisx0213_codepoint((b1 - 0xa1) * 94 + (b2 - 0xa1));
+				// bad sequence
+				else {
+					codepoint = Encoding::UNICODE_BAD_SEQUENCE;
+					--i;
+				}
+			}
+			// two character sequence
+			if (codepoint < 0) {
+				const int *sequence = Encoding::jisx0213_sequence(codepoint);
+				units = code_length(dest, sequence[0]) + code_length(dest, sequence[1]);
+				if (dest) {
+					if (dest_size - len < units) break;
+					put_code(dest + len, sequence[0]);
+					put_code(dest + len + code_length(dest, sequence[0]), sequence[1]);
+				}
+				len += units;
+				continue;
+			}
+			units = code_length(dest, codepoint);
+			if (dest) {
+				if (dest_size - len < units) break;
+				put_code(dest + len, codepoint);
+			}
+			len += units;
+		}
+		return len;
+	}
+}
+
+unsigned int Encoding::decodeToUtf8(unsigned char *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size, EncodingType encoding)
+{
+	// auto encoding judgement
+	if (encoding == NONE) encoding = getEncoding(src, src_size);
+
+	// dispatching
+	switch (encoding) {
+	case SHIFTJIS: return ::transcode_shiftjis<unsigned char, ShiftjisProfile>(dest, dest_size, src, src_size);
+	case CP932: return ::transcode_shiftjis<unsigned char, Cp932Profile>(dest, dest_size, src, src_size);
+	case EUCJP: return ::transcode_eucjp<unsigned char>(dest, dest_size, src, src_size);
+	default: break;
+	}
+
+	// unsupported encoding.
+	return 0;
+}
+
+unsigned int Encoding::decodeToUtf8Bound(unsigned int src_size, EncodingType encoding)
+{
+	switch (encoding) {
+	case UTF16:
+	case UTF8:
+		// not supported by decodeToUtf8
+		return 0;
+	default:
+		// 1 byte (JIS X 0201 kana, bad sequence) becomes 3 bytes at most,
+		// 2 or 3 bytes (JIS X 0213) become 6 bytes at most (two character sequence)
+		return 3 * src_size;
+	}
+}
+
+unsigned int Encoding::decodeToUtf16(char16_t *dest, unsigned int dest_size, const unsigned char *src, unsigned int src_size, EncodingType encoding)
+{
+	// auto encoding judgement
+	if (encoding == NONE) encoding = getEncoding(src, src_size);
+
+	// dispatching
+	switch (encoding) {
+	case UTF16: return ::transcode_utf16(dest, dest_size, src, src_size);
+	case UTF8: return ::transcode_utf8(dest, dest_size, src, src_size);
+	case SHIFTJIS: return ::transcode_shiftjis<char16_t, ShiftjisProfile>(dest, dest_size, src, src_size);
+	case CP932: return ::transcode_shiftjis<char16_t, Cp932Profile>(dest, dest_size, src, src_size);
+	case EUCJP: return ::transcode_eucjp<char16_t>(dest, dest_size, src, src_size);
+	default: break;
+	}
+
+	// unknown encoding.
+	return 0;
+}
+
+unsigned int Encoding::decodeToUtf16Bound(unsigned int src_size, EncodingType encoding)
+{
+	// a surrogate pair needs 4 bytes of any encoding
+	if (encoding == UTF16) return src_size / 2;
+	return src_size;
+}
@@ -0,0 +1,104 @@
+// utf8.h
+#ifndef INCLUDED_UTF8_H_
+#define INCLUDED_UTF8_H_
+
+namespace Encoding {
+	/* UTF-8 DFA (RFC 3629)
+	 *
+	 * A byte is mapped to its class by utf8_class, and the next state is
+	 * utf8_transition[state + class]. The states are multiplied by the number
+	 * of the classes (12) so that a transition is a single lookup.
+	 * Overlong forms, surrogates (U+D800-U+DFFF), codepoints above U+10FFFF and
+	 * the obsolete 5 and 6 bytes forms are rejected.
+	 * USAGE:
+	 *   type = utf8_class[b];
+	 *   codepoint = state == UTF8_ACCEPT ? b & utf8_lead_mask[type] : codepoint << 6 | (b & 0x3f);
+	 *   state = utf8_transition[state + type];
+	 *     state: UTF8_ACCEPT (end of a sequence), UTF8_REJECT (error) or others
+	 *     b    : byte of UTF-8 text
+	*/
+	enum Utf8State {
+		UTF8_ACCEPT = 0,
+		UTF8_REJECT = 12
+	};
+
+	inline constexpr unsigned char utf8_class[256] = {
+		// 00-7f: 1 byte sequence
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		// 80-8f, 90-9f, a0-bf: continuation bytes
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		// c0-c1: invalid, c2-df: 2 bytes sequence
+		4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+		// e0, e1-ec, ed, ee-ef: 3 bytes sequence
+		6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 7, 7,
+		// f0, f1-f3, f4: 4 bytes sequence, f5-ff: invalid
+		9, 10, 10, 10, 11, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4
+	};
+
+	// bits of the codepoint in the first byte of each class
+	inline constexpr unsigned char utf8_lead_mask[12] = {
+		0x7f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x0f, 0x0f, 0x0f, 0x07, 0x07, 0x07
+	};
+
+	inline constexpr unsigned char utf8_transition[9 * 12] = {
+		// class: 00  80  90  a0  c0  c2  e0  e1  ed  f0  f1  f4
+		// accept
+		 0, 12, 12, 12, 12, 24, 48, 36, 60, 84, 72, 96,
+		// reject
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		// 1 continuation byte
+		12,  0,  0,  0, 12, 12, 12, 12, 12, 12, 12, 12,
+		// 2 continuation bytes
+		12, 24, 24, 24, 12, 12, 12, 12, 12, 12, 12, 12,
+		// after e0 (a0-bf, overlong)
+		12, 12, 12, 24, 12, 12, 12, 12, 12, 12, 12, 12,
+		// after ed (80-9f, surrogates)
+		12, 24, 24, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		// 3 continuation bytes
+		12, 36, 36, 36, 12, 12, 12, 12, 12, 12, 12, 12,
+		// after f0 (90-bf, overlong)
+		12, 12, 36, 36, 12, 12, 12, 12, 12, 12, 12, 12,
+		// after f4 (80-8f, above U+10FFFF)
+		12, 36, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+	};
+
+	/** Decode a UTF-8 sequence with the DFA.
+	 *
+	 * @param src Beginning of the sequence.
+	 * @param size Available bytes of src (at least 1).
+	 * @param codepoint Set to the codepoint of a valid sequence.
+	 *
+	 * @retval The length of the valid sequence, 0 for an error, or -1 if src
+	 * is the beginning of a valid sequence which needs more than size bytes.
+	*/
+	inline int utf8_sequence(const unsigned char *src, unsigned int size, int &codepoint)
+	{
+		const unsigned char type = utf8_class[src[0]];
+		unsigned int state = utf8_transition[type];
+		int c = src[0] & utf8_lead_mask[type];
+		unsigned int n = 1;
+
+		while (state > UTF8_REJECT) {
+			if (n >= size) return -1;
+			const unsigned char b = src[n++];
+			state = utf8_transition[state + utf8_class[b]];
+			c = c << 6 | (b & 0x3f);
+		}
+		if (state == UTF8_REJECT) return 0;
+		codepoint = c;
+		return (int)n;
+	}
+}
+
+#endif // INCLUDED_UTF8_H_